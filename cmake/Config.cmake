@@ -74,6 +74,12 @@ if(ENABLE_CMAKE_TESTING)
     include(CTest REQUIRED)
 endif(ENABLE_CMAKE_TESTING)
 
+######################################################################################
+### 4) Benchmarks part
+######################################################################################
+
+set(ENABLE_CMAKE_BENCHMARK "false" CACHE BOOL "ParadisEO performance benchmarks")
+
 ######################################################################################
 ### 5) Build examples ?
 ######################################################################################
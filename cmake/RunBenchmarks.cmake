@@ -0,0 +1,59 @@
+######################################################################################
+### Runs the benchmarks listed in the BENCHMARKS file (see the paradiseo-bench
+### target), each one writing its report to <name>.json, and gathers the reports
+### in OUTPUT:
+###     {"benchmarks": [<report of b-eoBreeder>, <report of b-eoCMAES>, ...]}
+### The arguments of every benchmark can be set in the PARADISEO_BENCH_ARGS
+### environment variable, as "b-eoCMAES=10;50;b-eoPSO=1000;2", to make the run
+### shorter. A benchmark which fails is reported, and the others are run anyway.
+######################################################################################
+
+if(NOT BENCHMARKS OR NOT OUTPUT)
+    message(FATAL_ERROR "Usage: cmake -DBENCHMARKS=<list file> -DOUTPUT=<json file> -P RunBenchmarks.cmake")
+endif()
+
+include(${BENCHMARKS})
+get_filename_component(OUTPUT_DIR ${OUTPUT} DIRECTORY)
+
+set(REPORTS "")
+set(FAILED "")
+foreach(bench ${PARADISEO_BENCHMARKS})
+    get_filename_component(name ${bench} NAME_WE)
+
+    # the arguments of this benchmark, if any: the values following "<name>=", up to the next benchmark
+    set(args "")
+    set(current "")
+    foreach(arg $ENV{PARADISEO_BENCH_ARGS})
+        if(arg MATCHES "^([^=]+)=(.*)$")
+            set(current ${CMAKE_MATCH_1})
+            set(arg ${CMAKE_MATCH_2})
+        endif()
+        if(current STREQUAL name)
+            list(APPEND args ${arg})
+        endif()
+    endforeach(arg)
+
+    set(report ${OUTPUT_DIR}/${name}.json)
+    file(REMOVE ${report})
+    message(STATUS "${name} ${args}")
+    set(ENV{PARADISEO_BENCH_JSON} ${report})
+    execute_process(COMMAND ${bench} ${args} RESULT_VARIABLE result)
+
+    if(result EQUAL 0 AND EXISTS ${report})
+        file(READ ${report} json)
+        string(STRIP "${json}" json)
+        if(REPORTS)
+            set(REPORTS "${REPORTS},\n")
+        endif()
+        set(REPORTS "${REPORTS}${json}")
+    else()
+        list(APPEND FAILED ${name})
+    endif()
+endforeach(bench)
+
+file(WRITE ${OUTPUT} "{\"benchmarks\": [\n${REPORTS}\n]}\n")
+message(STATUS "Benchmark reports written to ${OUTPUT}")
+
+if(FAILED)
+    message(FATAL_ERROR "Failed benchmarks: ${FAILED}")
+endif()
@@ -0,0 +1,94 @@
+/*
+ * Time of the sampling of a population of 1000 to 10000 eoReal from a
+ * multi-normal distribution in 10 and 100 dimensions, by an
+ * edoSamplerNormalMulti drawing the solutions one by one and the whole
+ * population at once, and time of the estimation of the distribution of the
+ * population by an edoEstimatorNormalMulti. The time per population is
+ * reported, in milliseconds.
+ *
+ * Usage: b-edoNormalMulti [maxSize] [calls]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <edo>
+#include <es.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoReal< eoMinimizingFitness > EOT;
+typedef edoNormalMulti< EOT > Distrib;
+
+int main(int argc, char** argv)
+{
+    unsigned maxSize = argc > 1 ? atoi(argv[1]) : 10000;
+    unsigned calls = argc > 2 ? atoi(argv[2]) : 5;
+    eoBenchReport report("b-edoNormalMulti");
+
+    cout << "maxSize=" << maxSize << " calls=" << calls << endl;
+    cout << "time per population (ms)" << endl;
+    cout << setw(6) << "N" << setw(8) << "size" << setw(14) << "one by one" << setw(14) << "population" << setw(14) << "estimation" << endl;
+
+    unsigned dimensions[] = {10, 100};
+    for(unsigned n : dimensions)
+    {
+        // a random covariance matrix, A.A^T + I
+        rng.reseed(42);
+        Distrib::Vector mean(n);
+        Distrib::Matrix a(n, n);
+        for(unsigned i = 0; i < n; ++i)
+        {
+            mean(i) = rng.uniform(-1, 1);
+            for(unsigned j = 0; j < n; ++j)
+                a(i, j) = rng.uniform(-1, 1) / n;
+        }
+        Distrib::Matrix varcovar = a * a.transpose() + Distrib::Matrix::Identity(n, n);
+        Distrib distrib(mean, varcovar);
+
+        edoBounderNo< EOT > bounder;
+        edoSamplerNormalMulti< EOT > sampler(bounder);
+        edoEstimatorNormalMulti< EOT > estimator;
+
+        for(unsigned size = 1000; size <= maxSize; size *= 10)
+        {
+            eoPop< EOT > pop;
+            auto start = chrono::steady_clock::now();
+            for(unsigned c = 0; c < calls; ++c)
+            {
+                pop.clear();
+                for(unsigned k = 0; k < size; ++k)
+                    pop.push_back(sampler(distrib));
+            }
+            auto stop = chrono::steady_clock::now();
+            double single = chrono::duration<double, milli>(stop - start).count() / calls;
+
+            start = chrono::steady_clock::now();
+            for(unsigned c = 0; c < calls; ++c)
+            {
+                pop.clear();
+                sampler(distrib, size, pop);
+            }
+            stop = chrono::steady_clock::now();
+            double batch = chrono::duration<double, milli>(stop - start).count() / calls;
+
+            start = chrono::steady_clock::now();
+            for(unsigned c = 0; c < calls; ++c)
+                estimator(pop);
+            stop = chrono::steady_clock::now();
+            double estimation = chrono::duration<double, milli>(stop - start).count() / calls;
+
+            cout << setw(6) << n << setw(8) << size << setw(14) << single << setw(14) << batch << setw(14) << estimation << endl;
+            report.record("sample one by one").param("N", n).param("size", size).value("time", single, "ms");
+            report.record("sample population").param("N", n).param("size", size).value("time", batch, "ms");
+            report.record("estimate").param("N", n).param("size", size).value("time", estimation, "ms");
+        }
+    }
+
+    return 0;
+}
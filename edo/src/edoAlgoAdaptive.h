@@ -211,11 +211,9 @@ public:
 
             // (3) sampling
             // The sampler produces feasible solutions (@see edoSampler that
-            // encapsulate an edoBounder)
-            current_pop.clear(); current_pop.reserve(pop.size());
-            for( unsigned int i = 0; i < pop.size(); ++i ) {
-                current_pop.push_back( _sampler(_distrib) );
-            }
+            // encapsulate an edoBounder), the whole population at once
+            current_pop.clear();
+            _sampler( _distrib, pop.size(), current_pop );
             // TODO modluraziation: the sampler may generate solution that are
             // not finite. See how to stop right from there instead of
             // performing useless evaluations.
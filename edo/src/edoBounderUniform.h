@@ -51,7 +51,7 @@ public:
         assert( sol.size() > 0);
         assert( sol.size() == this->min().size() );
 
-        eo::log << eo::debug << "BounderUniform: from sol = " << sol;
+        EO_LOG(eo::debug) << "BounderUniform: from sol = " << sol;
         eo::log.flush();
 
         unsigned int size = sol.size();
@@ -63,7 +63,7 @@ public:
             }
         } // for d in size
         
-        eo::log << eo::debug << "\tto sol = " << sol << std::endl;
+        EO_LOG(eo::debug) << "\tto sol = " << sol << std::endl;
     }
 };
 
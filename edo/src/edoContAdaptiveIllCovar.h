@@ -73,7 +73,7 @@ public:
             eo::log << eo::progress << "STOP because the covariance matrix"
                << " cannot be decomposed" << std::endl;
 #ifndef NDEBUG
-            eo::log << eo::xdebug
+            EO_LOG(eo::xdebug)
                 << "mean:\n" << d.mean() << std::endl
                 << "sigma:" << d.sigma() << std::endl
                 << "coord_sys:\n" << d.coord_sys() << std::endl
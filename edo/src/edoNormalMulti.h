@@ -28,6 +28,8 @@ Copyright (C) 2010 Thales group
 #ifndef _edoNormalMulti_h
 #define _edoNormalMulti_h
 
+#include <atomic>
+
 #include "edoDistrib.h"
 
 #ifdef WITH_BOOST
@@ -79,7 +81,8 @@ public:
 
     edoNormalMulti( unsigned int dim = 1 ) :
             _mean( const ublas::vector<AtomType>(0,dim)        ),
-        _varcovar( const ublas::identity_matrix<AtomType>(dim) )
+        _varcovar( const ublas::identity_matrix<AtomType>(dim) ),
+        _stamp( next_stamp() )
     {
         assert(_mean.size() > 0);
         assert(_mean.size() == _varcovar.size1());
@@ -91,7 +94,7 @@ public:
      const ublas::vector< AtomType >& mean,
      const ublas::symmetric_matrix< AtomType, ublas::lower >& varcovar
      )
-        : _mean(mean), _varcovar(varcovar)
+        : _mean(mean), _varcovar(varcovar), _stamp( next_stamp() )
     {
         assert(_mean.size() > 0);
         assert(_mean.size() == _varcovar.size1());
@@ -108,9 +111,18 @@ public:
     ublas::vector< AtomType > mean() const {return _mean;}
     ublas::symmetric_matrix< AtomType, ublas::lower > varcovar() const {return _varcovar;}
 
+    /** Identifier of the parameters of the distribution
+     *
+     * Every new distribution gets a new one, which is kept by its copies.
+     * Samplers use it to know when their factorization of the covariance
+     * matrix is out of date.
+     */
+    unsigned long stamp() const {return _stamp;}
+
 private:
     ublas::vector< AtomType > _mean;
     ublas::symmetric_matrix< AtomType, ublas::lower > _varcovar;
+    unsigned long _stamp;
 
 #else
 #ifdef WITH_EIGEN
@@ -123,7 +135,8 @@ public:
 
     edoNormalMulti( unsigned int dim = 1 ) :
             _mean( Vector::Zero(dim) ),
-        _varcovar( Matrix::Identity(dim,dim) )
+        _varcovar( Matrix::Identity(dim,dim) ),
+        _stamp( next_stamp() )
     {
         assert(_mean.size() > 0);
         assert(_mean.innerSize() == _varcovar.innerSize());
@@ -134,7 +147,7 @@ public:
         const Vector & mean,
         const Matrix & varcovar
     )
-        : _mean(mean), _varcovar(varcovar)
+        : _mean(mean), _varcovar(varcovar), _stamp( next_stamp() )
     {
         assert(_mean.innerSize() > 0);
         assert(_mean.innerSize() == _varcovar.innerSize());
@@ -151,13 +164,28 @@ public:
     Vector mean() const {return _mean;}
     Matrix varcovar() const {return _varcovar;}
 
+    /** Identifier of the parameters of the distribution
+     *
+     * Every new distribution gets a new one, which is kept by its copies.
+     * Samplers use it to know when their factorization of the covariance
+     * matrix is out of date.
+     */
+    unsigned long stamp() const {return _stamp;}
+
 private:
     Vector _mean;
     Matrix _varcovar;
+    unsigned long _stamp;
 
 #endif // WITH_EIGEN
 #endif // WITH_BOOST
 
+    static unsigned long next_stamp()
+    {
+        static std::atomic<unsigned long> counter(0);
+        return ++counter;
+    }
+
 }; // class edoNormalMulti
 
 #endif // !_edoNormalMulti_h
@@ -29,6 +29,7 @@ Authors:
 #define _edoSampler_h
 
 #include <eoFunctor.h>
+#include <eoPop.h>
 
 #include "edoRepairer.h"
 #include "edoBounderNo.h"
@@ -85,10 +86,38 @@ public:
         return solution;
     }
 
+    /** Draw n solutions at once, append them to pop and repair them
+     *
+     * Samplers whose draws share a costly computation (e.g. the
+     * factorization of a covariance matrix) should overload "sample_population",
+     * which defaults to n calls to "sample".
+     */
+    void operator()( D& distrib, unsigned int n, eoPop< EOType >& pop )
+    {
+        assert( distrib.size() > 0 );
+
+        size_t first = pop.size();
+        pop.reserve( first + n );
+        sample_population( distrib, n, pop );
+        assert( pop.size() == first + n );
+
+        for( size_t i = first; i < pop.size(); ++i ) {
+            _repairer(pop[i]);
+        }
+    }
+
 protected:
 
     virtual EOType sample( D& ) = 0;
 
+    //! Append n solutions drawn from distrib to pop
+    virtual void sample_population( D& distrib, unsigned int n, eoPop< EOType >& pop )
+    {
+        for( unsigned int i = 0; i < n; ++i ) {
+            pop.push_back( sample( distrib ) );
+        }
+    }
+
 private:
     edoBounderNo<EOType> _dummy_repairer;
 
@@ -88,8 +88,8 @@ public:
                 if(not is_finite) {
                     eo::log << eo::warnings << "WARNING: sampled solution is not finite"
                        << " (the search should stop after this warning)" << std::endl;
-                    eo::log << eo::debug << sol << std::endl;
-                    eo::log << eo::xdebug
+                    EO_LOG(eo::debug) << sol << std::endl;
+                    EO_LOG(eo::xdebug)
                         << "mean:\n" << distrib.mean() << std::endl
                         << "sigma:" << distrib.sigma() << std::endl
                         << "coord_sys:\n" << distrib.coord_sys() << std::endl
@@ -53,6 +53,10 @@ namespace ublas = boost::numeric::ublas;
  *   - compute the Cholesky decomposition L of V (i.e. such as V=LL*)
  *   - return X = M + LT
  *
+ * The decomposition is computed once per distribution (see edoNormalMulti::stamp)
+ * and whole populations can be drawn at once, as a single matrix product
+ * (with Eigen3).
+ *
  * Exists in two implementations, using either
  * <a href="http://www.boost.org/doc/libs/1_50_0/libs/numeric/ublas/doc/index.htm">Boost::uBLAS</a> (if compiled WITH_BOOST)
  * or <a href="http://eigen.tuxfamily.org">Eigen3</a> (WITH_EIGEN).
@@ -69,9 +73,10 @@ class edoSamplerNormalMulti : public edoSampler< D >
 
 public:
     typedef typename EOT::AtomType AtomType;
+    typedef typename cholesky::CholeskyBase<AtomType>::FactorMat FactorMat;
 
     edoSamplerNormalMulti( edoRepairer<EOT> & repairer ) 
-        : edoSampler< D >( repairer)
+        : edoSampler< D >( repairer), _stamp(0)
     {}
 
 
@@ -81,13 +86,11 @@ public:
         assert(size > 0);
 
         // L = cholesky decomposition of varcovar
-        const typename cholesky::CholeskyBase<AtomType>::FactorMat& L = _cholesky( distrib.varcovar() );
+        const FactorMat& L = factor( distrib );
 
         // T = vector of size elements drawn in N(0,1)
         ublas::vector< AtomType > T( size );
-        for ( unsigned int i = 0; i < size; ++i ) {
-            T( i ) = rng.normal();
-        }
+        rng.fill_normal( T.begin(), T.end() );
 
         // LT = L * T
         ublas::vector< AtomType > LT = ublas::prod( L, T );
@@ -102,8 +105,23 @@ public:
     }
 
 protected:
+    //! The Cholesky factor of the covariance matrix, computed once per distribution
+    const FactorMat& factor( D& distrib )
+    {
+        if( _stamp != distrib.stamp() ) {
+            _L = _cholesky( distrib.varcovar() );
+            _stamp = distrib.stamp();
+        }
+        return _L;
+    }
+
     cholesky::CholeskyLLT<AtomType> _cholesky;
 
+    FactorMat _L;
+
+    //! Stamp of the distribution whose factor is _L, 0 if none
+    unsigned long _stamp;
+
 #else
 #ifdef WITH_EIGEN
 
@@ -114,7 +132,7 @@ public:
     typedef typename D::Matrix Matrix;
 
     edoSamplerNormalMulti( edoRepairer<EOT> & repairer ) 
-        : edoSampler< D >( repairer)
+        : edoSampler< D >( repairer), _stamp(0)
     {}
 
 
@@ -124,60 +142,78 @@ public:
         assert(size > 0);
 
         // LsD = cholesky decomposition of varcovar
-
-        // Computes L and mD such as V = L mD L^T
-        Eigen::LDLT<Matrix> cholesky( distrib.varcovar() );
-        Matrix L = cholesky.matrixL();
-        assert(L.innerSize() == size);
-        assert(L.outerSize() == size);
-
-        Matrix mD = cholesky.vectorD().asDiagonal();
-        assert(mD.innerSize() == size);
-        assert(mD.outerSize() == size);
-
-        // now compute the final symetric matrix: LsD = L mD^1/2
-        // remember that V = ( L mD^1/2) ( L mD^1/2)^T
-        // fortunately, the square root of a diagonal matrix is the square 
-        // root of all its elements
-        Matrix sqrtD = mD.cwiseSqrt();
-        assert(sqrtD.innerSize() == size);
-        assert(sqrtD.outerSize() == size);
-
-        Matrix LsD = L * sqrtD;
-        assert(LsD.innerSize() == size);
-        assert(LsD.outerSize() == size);
+        const Matrix& LsD = factor( distrib );
 
         // T = vector of size elements drawn in N(0,1)
         Vector T( size );
-        for ( unsigned int i = 0; i < size; ++i ) {
-            T( i ) = rng.normal();
-        }
-        assert(T.innerSize() == size);
-        assert(T.outerSize() == 1);
+        rng.fill_normal( T.data(), T.data() + size );
 
-        // LDT = (L mD^1/2) * T
-        Vector LDT = LsD * T;
-        assert(LDT.innerSize() == size);
-        assert(LDT.outerSize() == 1);
-
-        // solution = means + LDT
-        Vector mean = distrib.mean();
-        assert(mean.innerSize() == size);
-        assert(mean.outerSize() == 1);
-
-        Vector typed_solution = mean + LDT;
+        // solution = means + LsD * T
+        Vector typed_solution = distrib.mean() + LsD * T;
         assert(typed_solution.innerSize() == size);
-        assert(typed_solution.outerSize() == 1);
 
         // copy in the EOT structure (more probably a vector)
         EOT solution( size );
-        for( unsigned int i = 0; i < mean.innerSize(); i++ ) {
+        for( unsigned int i = 0; i < size; i++ ) {
             solution[i]= typed_solution(i);
         }
         assert( solution.size() == size );
 
         return solution;
     }
+
+protected:
+    /** Draw the n solutions at once: X = M + LsD Z, with Z a size x n matrix drawn in N(0,1)
+     *
+     * The normal numbers are drawn in the same order as n calls to sample.
+     */
+    void sample_population( D& distrib, unsigned int n, eoPop< EOT >& pop )
+    {
+        unsigned int size = distrib.size();
+        assert(size > 0);
+
+        const Matrix& LsD = factor( distrib );
+
+        // Z is column-major: one column per solution
+        Matrix Z( size, n );
+        rng.fill_normal( Z.data(), Z.data() + Z.size() );
+
+        Matrix X = LsD * Z;
+        X.colwise() += distrib.mean();
+
+        EOT solution( size );
+        for( unsigned int k = 0; k < n; k++ ) {
+            for( unsigned int i = 0; i < size; i++ ) {
+                solution[i] = X(i, k);
+            }
+            pop.push_back( solution );
+        }
+    }
+
+    /** The matrix LsD such as V = LsD LsD^T, computed once per distribution
+     *
+     * Computes L and mD such as V = P^T L mD L^T P, then
+     * LsD = P^T L mD^1/2 (the square root of a diagonal matrix is the square
+     * root of all its elements).
+     */
+    const Matrix& factor( D& distrib )
+    {
+        if( _stamp != distrib.stamp() ) {
+            Eigen::LDLT<Matrix> cholesky( distrib.varcovar() );
+            Vector sqrtD = cholesky.vectorD().cwiseSqrt();
+            _LsD = cholesky.transpositionsP().transpose() * ( Matrix( cholesky.matrixL() ) * sqrtD.asDiagonal() );
+            assert(_LsD.innerSize() == distrib.size());
+            assert(_LsD.outerSize() == distrib.size());
+            _stamp = distrib.stamp();
+        }
+        return _LsD;
+    }
+
+    Matrix _LsD;
+
+    //! Stamp of the distribution whose factor is _LsD, 0 if none
+    unsigned long _stamp;
+
 #endif // WITH_EIGEN
 #endif // WITH_BOOST
 }; // class edoNormalMulti
@@ -0,0 +1,123 @@
+/*
+The Evolving Distribution Objects framework (EDO) is a template-based,
+ANSI-C++ evolutionary computation library which helps you to write your
+own estimation of distribution algorithms.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+
+Copyright (C) 2010 Thales group
+*/
+
+#include <cmath>
+#include <iostream>
+
+#include <eo>
+#include <edo>
+#include <es.h>
+
+typedef eoReal< eoMinimizingFitness > EOT;
+typedef edoNormalMulti< EOT > Distrib;
+typedef EOT::AtomType AtomType;
+
+#ifdef WITH_BOOST
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+    typedef ublas::vector< AtomType > Vector;
+    typedef ublas::symmetric_matrix< AtomType, ublas::lower > Matrix;
+#else
+#ifdef WITH_EIGEN
+#include <Eigen/Dense>
+    typedef edoNormalMulti<EOT>::Vector Vector;
+    typedef edoNormalMulti<EOT>::Matrix Matrix;
+#endif
+#endif
+
+int main()
+{
+    const unsigned int dim = 3;
+    const unsigned int n = 20000;
+
+    // A covariance matrix whose LDLT decomposition is pivoted
+    Vector mean( dim );
+    Matrix varcovar( dim, dim );
+    AtomType values[dim][dim] = { {1.0, 0.5, 0.2}, {0.5, 4.0, 1.0}, {0.2, 1.0, 9.0} };
+    for( unsigned int i = 0; i < dim; ++i ) {
+        mean(i) = i;
+        for( unsigned int j = 0; j <= i; ++j ) {
+            varcovar(i,j) = values[i][j];
+#ifndef WITH_BOOST
+            varcovar(j,i) = values[i][j];
+#endif
+        }
+    }
+    Distrib distrib( mean, varcovar );
+
+    edoBounderNo< EOT > bounder;
+    edoSamplerNormalMulti< EOT > sampler( bounder );
+
+    // (1) drawing a population at once gives the same solutions as drawing them one by one
+    rng.reseed(42);
+    eoPop< EOT > sequential;
+    for( unsigned int k = 0; k < 10; ++k ) {
+        sequential.push_back( sampler( distrib ) );
+    }
+
+    rng.reseed(42);
+    eoPop< EOT > batch;
+    sampler( distrib, 10, batch );
+
+    if( batch.size() != sequential.size() ) {
+        std::cerr << "ERROR: " << batch.size() << " solutions drawn instead of " << sequential.size() << std::endl;
+        return EXIT_FAILURE;
+    }
+    for( unsigned int k = 0; k < batch.size(); ++k ) {
+        for( unsigned int i = 0; i < dim; ++i ) {
+            if( std::abs( batch[k][i] - sequential[k][i] ) > 1e-10 ) {
+                std::cerr << "ERROR: batch and sequential draws differ at " << k << "," << i << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // (2) the sample mean and covariance are the ones of the distribution
+    eoPop< EOT > pop;
+    sampler( distrib, n, pop );
+
+    std::vector< AtomType > m( dim, 0 );
+    for( unsigned int k = 0; k < n; ++k ) {
+        for( unsigned int i = 0; i < dim; ++i ) {
+            m[i] += pop[k][i] / n;
+        }
+    }
+    for( unsigned int i = 0; i < dim; ++i ) {
+        if( std::abs( m[i] - mean(i) ) > 0.1 ) {
+            std::cerr << "ERROR: mean " << i << " is " << m[i] << " instead of " << mean(i) << std::endl;
+            return EXIT_FAILURE;
+        }
+        for( unsigned int j = 0; j <= i; ++j ) {
+            AtomType c = 0;
+            for( unsigned int k = 0; k < n; ++k ) {
+                c += ( pop[k][i] - m[i] ) * ( pop[k][j] - m[j] ) / n;
+            }
+            if( std::abs( c - values[i][j] ) > 0.05 * values[i][i] ) {
+                std::cerr << "ERROR: covariance " << i << "," << j << " is " << c << " instead of " << values[i][j] << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    std::cout << "OK" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+/*
+ * Time of the breeding of a generation of permutations (tours of 1000 to 10000
+ * cities) with an eoOrderXover and an eoSwapMutation, by an eoGeneralBreeder
+ * and by an eoParallelGeneralBreeder, with the number of threads of OpenMP
+ * (OMP_NUM_THREADS). The time per generation is reported, in milliseconds.
+ *
+ * Usage: b-eoBreeder [maxCities] [generations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <eoInt.h>
+#include <eoOrderXover.h>
+#include <eoSwapMutation.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoInt < eoMinimizingFitness > Tour;
+
+/** Time of the breeding of a generation, in milliseconds */
+double time(eoBreed < Tour > & breed, const eoPop < Tour > & parents, unsigned generations)
+{
+    eoPop < Tour > offspring;
+    rng.reseed(42);
+    auto start = chrono::steady_clock::now();
+    for(unsigned g = 0; g < generations; ++g)
+        breed(parents, offspring);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / generations;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxCities = argc > 1 ? atoi(argv[1]) : 10000;
+    unsigned generations = argc > 2 ? atoi(argv[2]) : 5;
+
+    const char* args[] = {argv[0], "--parallelize-loop=1"};
+    eoParser parser(2, const_cast<char**>(args));
+    make_parallel(parser);
+    eoBenchReport report("b-eoBreeder");
+
+    cout << "maxCities=" << maxCities << " generations=" << generations << " population=100" << endl;
+    cout << "time per generation (ms)" << endl;
+    cout << setw(8) << "cities" << setw(14) << "general" << setw(14) << "parallel" << endl;
+
+    unsigned sizes[] = {1000, 10000};
+    for(unsigned cities : sizes)
+    {
+        if(cities > maxCities)
+            break;
+
+        rng.reseed(1);
+        eoInitPermutation < Tour > init(cities);
+        eoPop < Tour > parents(100, init);
+        for(unsigned i = 0; i < parents.size(); ++i)
+            parents[i].fitness(rng.uniform());
+
+        eoDetTournamentSelect < Tour > select(2);
+        eoOrderXover < Tour > xover;
+        eoSwapMutation < Tour > mutation;
+        eoSGAGenOp < Tour > op(xover, 0.9, mutation, 0.5);
+        eoGeneralBreeder < Tour > general(select, op);
+        eoParallelGeneralBreeder < Tour > parallel(select, op);
+
+        double generalTime = time(general, parents, generations);
+        double parallelTime = time(parallel, parents, generations);
+        cout << setw(8) << cities << setw(14) << generalTime << setw(14) << parallelTime << endl;
+        report.record("general").param("cities", cities).value("time", generalTime, "ms");
+        report.record("parallel").param("cities", cities).value("time", parallelTime, "ms");
+    }
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Scaling of the covariance models of the CMA-ES (eo::CMAState), from N=10 to
+ * N=5000, on the ellipsoid f(x) = sum_i 10^(6 i/(N-1)) x_i^2.
+ *
+ * Each model runs a fixed number of generations of eoCMABreed; the time per
+ * generation and the best fitness reached are reported. A model is not run
+ * anymore on larger dimensions once a generation has taken more than a given time.
+ *
+ * Usage: b-eoCMAES [maxN] [generations] [maxSeconds]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eoScalarFitness.h>
+#include <eoVector.h>
+#include <eoPop.h>
+#include <utils/eoRNG.h>
+
+#include <es/CMAState.h>
+#include <es/CMAParams.h>
+#include <es/eoCMAInit.h>
+#include <es/eoCMABreed.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoMinimizingFitness FitT;
+typedef eoVector<FitT, double> EoType;
+
+double ellipsoid(const vector<double>& x)
+{
+    double sum = 0.0;
+    for(unsigned i = 0; i < x.size(); ++i)
+        sum += pow(10., 6. * i / (x.size() - 1.)) * x[i] * x[i];
+    return sum;
+}
+
+/** Time of a generation, in milliseconds, or -1 if the model diverged */
+double run(unsigned n, eo::CMAParams::Variant variant, unsigned eigenInterval, unsigned generations, double& best)
+{
+    eo::CMAParams params;
+    params.defaults(n, 1000);
+    params.variant = variant;
+    if(eigenInterval > 0)
+        params.eigenInterval = eigenInterval;
+
+    rng.reseed(42);
+    eo::CMAState state(params, vector<double>(n, 1.0));
+    eoCMAInit<FitT> init(state);
+    eoCMABreed<FitT> breed(state, params.lambda);
+
+    eoPop<EoType> parents(params.mu, init), offspring;
+    for(unsigned i = 0; i < parents.size(); ++i)
+        parents[i].fitness(ellipsoid(parents[i]));
+
+    auto start = chrono::steady_clock::now();
+    for(unsigned g = 0; g < generations; ++g)
+    {
+        breed(parents, offspring);
+        for(unsigned i = 0; i < offspring.size(); ++i)
+            offspring[i].fitness(ellipsoid(offspring[i]));
+        offspring.nth_element(params.mu);
+        offspring.resize(params.mu);
+        parents.swap(offspring);
+    }
+    auto stop = chrono::steady_clock::now();
+
+    best = parents.best_element().fitness();
+    return chrono::duration<double, milli>(stop - start).count() / generations;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxN = argc > 1 ? atoi(argv[1]) : 5000;
+    unsigned generations = argc > 2 ? atoi(argv[2]) : 20;
+    double maxSeconds = argc > 3 ? atof(argv[3]) : 2.0;
+    eoBenchReport report("b-eoCMAES");
+
+    cout << "maxN=" << maxN << " generations=" << generations << " maxSeconds=" << maxSeconds << endl;
+    cout << "time per generation (ms) and best fitness, '-' when skipped" << endl;
+
+    const char* names[] = {"full (eigen every gen)", "full (lazy eigen)", "separable", "limited memory"};
+    eo::CMAParams::Variant variants[] = {eo::CMAParams::full, eo::CMAParams::full, eo::CMAParams::separable, eo::CMAParams::limited_memory};
+    unsigned intervals[] = {1, 0, 0, 0};
+    bool running[] = {true, true, true, true};
+
+    cout << setw(6) << "N";
+    for(unsigned v = 0; v < 4; ++v)
+        cout << setw(26) << names[v];
+    cout << endl;
+
+    unsigned dimensions[] = {10, 30, 100, 300, 1000, 3000, 5000};
+    for(unsigned n : dimensions)
+    {
+        if(n > maxN)
+            break;
+        cout << setw(6) << n;
+        for(unsigned v = 0; v < 4; ++v)
+        {
+            if(!running[v])
+            {
+                cout << setw(26) << "-";
+                continue;
+            }
+            double best = 0;
+            double time = run(n, variants[v], intervals[v], generations, best);
+            cout << setw(12) << time << " " << setw(13) << best;
+            report.record(names[v]).param("N", n).param("generations", generations)
+                .value("time", time, "ms").value("best", best);
+            running[v] = time * generations < maxSeconds * 1000;
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
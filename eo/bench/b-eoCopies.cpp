@@ -0,0 +1,158 @@
+/*
+ * Cost of the copies of large genomes (eoReal of 2^17 doubles and eoBit of
+ * 2^23 bits, i.e. 1 MB each) between selection, variation and replacement,
+ * with a population of 50 and cheap operators and evaluation:
+ *  - a generation of the SGA, copying the selected parents (eoSelectPerc, as
+ *    eoSGA formerly did) and with eoSGA, which selects by indices and swaps
+ *    each parent with the last offspring which selects it,
+ *  - a plus replacement, copying the parents (eoPlus then eoTruncate) and with
+ *    eoPlusReplacement, which moves them.
+ * The time per generation, or per replacement, is reported in milliseconds.
+ *
+ * Usage: b-eoCopies [generations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <es.h>
+#include <ga.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+/** Evaluation by the first gene only, so that the copies dominate */
+template <class EOT>
+class FirstGene : public eoEvalFunc<EOT>
+{
+public:
+    void operator()(EOT & _eo)
+    {
+        if(_eo.invalid())
+            _eo.fitness(_eo[0] + rng.uniform());
+    }
+};
+
+/** Changes a single gene */
+template <class EOT>
+class OneGene : public eoMonOp<EOT>
+{
+public:
+    bool operator()(EOT & _eo)
+    {
+        unsigned i = rng.random(_eo.size());
+        _eo[i] = !_eo[i];
+        return true;
+    }
+};
+
+/** Exchanges a single gene */
+template <class EOT>
+class OneGeneXover : public eoQuadOp<EOT>
+{
+public:
+    bool operator()(EOT & _a, EOT & _b)
+    {
+        unsigned i = rng.random(_a.size());
+        typename EOT::AtomType tmp = _a[i];
+        _a[i] = _b[i];
+        _b[i] = tmp;
+        return true;
+    }
+};
+
+/** The former eoSGA, which copies the selected parents */
+template <class EOT>
+void copyingSGA(eoSelectOne<EOT> & _select, eoQuadOp<EOT> & _cross, eoMonOp<EOT> & _mutate,
+                eoEvalFunc<EOT> & _eval, unsigned _generations, eoPop<EOT> & _pop)
+{
+    eoSelectPerc<EOT> select(_select);
+    eoPop<EOT> offspring;
+    for(unsigned g = 0; g < _generations; ++g)
+    {
+        select(_pop, offspring);
+        for(unsigned i = 0; i < _pop.size() / 2; ++i)
+            if(rng.flip(0.8) && _cross(offspring[2 * i], offspring[2 * i + 1]))
+            {
+                offspring[2 * i].invalidate();
+                offspring[2 * i + 1].invalidate();
+            }
+        for(unsigned i = 0; i < offspring.size(); ++i)
+            if(rng.flip(0.2) && _mutate(offspring[i]))
+                offspring[i].invalidate();
+        _pop.swap(offspring);
+        apply<EOT>(_eval, _pop);
+    }
+}
+
+template <class EOT>
+void bench(eoBenchReport & _report, const string & _name, unsigned _size, unsigned _generations)
+{
+    FirstGene<EOT> eval;
+    eoPop<EOT> pop;
+    for(unsigned i = 0; i < 50; ++i)
+    {
+        pop.push_back(EOT(_size));
+        eval(pop.back());
+    }
+
+    eoDetTournamentSelect<EOT> select(2);
+    OneGeneXover<EOT> xover;
+    OneGene<EOT> mutation;
+
+    eoPop<EOT> copied(pop);
+    auto start = chrono::steady_clock::now();
+    copyingSGA(select, xover, mutation, eval, _generations, copied);
+    auto middle = chrono::steady_clock::now();
+    eoGenContinue<EOT> continuator(_generations);
+    eoSGA<EOT> sga(select, xover, 0.8, mutation, 0.2, eval, continuator);
+    eoPop<EOT> indexed(pop);
+    sga(indexed);
+    auto stop = chrono::steady_clock::now();
+    double copySGA = chrono::duration<double, milli>(middle - start).count() / _generations;
+    double indexSGA = chrono::duration<double, milli>(stop - middle).count() / _generations;
+
+    eoPlus<EOT> plus;
+    eoTruncate<EOT> truncation;
+    eoReduce<EOT> & truncate = truncation;
+    eoPlusReplacement<EOT> replace;
+    double copyReplace = 0, moveReplace = 0;
+    for(unsigned g = 0; g < _generations; ++g)
+    {
+        eoPop<EOT> parents(pop), offspring(pop);
+        start = chrono::steady_clock::now();
+        plus(parents, offspring);
+        truncate(offspring, parents.size());
+        middle = chrono::steady_clock::now();
+        replace(parents, offspring);
+        stop = chrono::steady_clock::now();
+        copyReplace += chrono::duration<double, milli>(middle - start).count() / _generations;
+        moveReplace += chrono::duration<double, milli>(stop - middle).count() / _generations;
+    }
+
+    cout << setw(8) << _name << setw(14) << copySGA << setw(14) << indexSGA
+         << setw(14) << copyReplace << setw(14) << moveReplace << endl;
+    _report.record("SGA copy").param("genome", _name).value("time", copySGA, "ms");
+    _report.record("SGA index").param("genome", _name).value("time", indexSGA, "ms");
+    _report.record("plus copy").param("genome", _name).value("time", copyReplace, "ms");
+    _report.record("plus move").param("genome", _name).value("time", moveReplace, "ms");
+}
+
+int main(int argc, char** argv)
+{
+    unsigned generations = argc > 1 ? atoi(argv[1]) : 20;
+
+    eoBenchReport report("b-eoCopies");
+    rng.reseed(42);
+    cout << "generations=" << generations << " population=50 genome=1MB" << endl;
+    cout << "time (ms)" << endl;
+    cout << setw(8) << "genome" << setw(14) << "SGA copy" << setw(14) << "SGA index"
+         << setw(14) << "plus copy" << setw(14) << "plus move" << endl;
+    bench< eoReal<double> >(report, "eoReal", 1u << 17, generations);
+    bench< eoBit<double> >(report, "eoBit", 1u << 23, generations);
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * Time of the evaluation of generations of 1000 eoBit of 1000 bits, a given
+ * ratio of them being copies of individuals evaluated earlier, with and
+ * without an eoEvalCache. The evaluation is a OneMax made expensive by
+ * repeating it. The time per generation is reported, in milliseconds.
+ *
+ * Usage: b-eoEvalCache [repeats] [generations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <ga.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoBit<double> Indi;
+
+/** OneMax, computed repeats times */
+class SlowOneMax : public eoEvalFunc<Indi>
+{
+public:
+    SlowOneMax(unsigned _repeats) : repeats(_repeats) {}
+
+    void operator()(Indi & indi)
+    {
+        volatile long count = 0;
+        for(unsigned r = 0; r < repeats; ++r)
+            count = std::count(indi.begin(), indi.end(), true);
+        indi.fitness(count);
+    }
+
+private:
+    unsigned repeats;
+};
+
+/** Time of an evaluation of the generations, in milliseconds per generation */
+double time(eoEvalFunc<Indi> & eval, vector< eoPop<Indi> > generations)
+{
+    auto start = chrono::steady_clock::now();
+    for(unsigned g = 0; g < generations.size(); ++g)
+        for(unsigned i = 0; i < generations[g].size(); ++i)
+            eval(generations[g][i]);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / generations.size();
+}
+
+int main(int argc, char** argv)
+{
+    unsigned repeats = argc > 1 ? atoi(argv[1]) : 1000;
+    unsigned nGenerations = argc > 2 ? atoi(argv[2]) : 5;
+    eoBenchReport report("b-eoEvalCache");
+
+    cout << "repeats=" << repeats << " generations=" << nGenerations << endl;
+    cout << "time per generation (ms)" << endl;
+    cout << setw(12) << "duplicates" << setw(12) << "plain" << setw(12) << "cached" << setw(12) << "hit rate" << endl;
+
+    double ratios[] = {0.0, 0.2, 0.4};
+    for(double ratio : ratios)
+    {
+        // every generation copies individuals of the previous ones
+        rng.reseed(42);
+        eoUniformGenerator<bool> uGen;
+        eoInitFixedLength<Indi> init(1000, uGen);
+        vector< eoPop<Indi> > generations;
+        for(unsigned g = 0; g < nGenerations; ++g)
+        {
+            eoPop<Indi> pop(1000, init);
+            for(unsigned i = 0; g > 0 && i < pop.size(); ++i)
+                if(rng.flip(ratio))
+                {
+                    pop[i] = generations[rng.random(g)][rng.random(1000)];
+                    pop[i].invalidate();
+                }
+            generations.push_back(pop);
+        }
+
+        SlowOneMax eval(repeats);
+        eoEvalCache<Indi> cache(eval);
+        double plain = time(eval, generations);
+        double cached = time(cache, generations);
+        double hitRate = double(cache.hits()) / (cache.hits() + cache.misses());
+
+        cout << setw(12) << ratio << setw(12) << plain << setw(12) << cached << setw(12) << hitRate << endl;
+        report.record("plain").param("duplicates", ratio).value("time", plain, "ms");
+        report.record("cached").param("duplicates", ratio).value("time", cached, "ms").value("hit rate", hitRate, "");
+    }
+
+    return 0;
+}
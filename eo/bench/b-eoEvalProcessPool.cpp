@@ -0,0 +1,88 @@
+/*
+ * Time of the evaluation of a population of 500 eoReal (the sphere in 10
+ * dimensions) by an external awk program: started for every individual by
+ * eoEvalCmd, and kept running by an eoEvalProcessPool of 1 worker and of as
+ * many workers as hardware threads, with requests of 1 and 16 individuals.
+ * The time per evaluation of the population is reported, in milliseconds.
+ *
+ * Usage: b-eoEvalProcessPool [size] [calls]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <eo>
+#include <es.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoReal<eoMinimizingFitness> Indi;
+
+// the sphere of the individual given as arguments: INVALID <size> <values>
+const string command = "awk 'BEGIN { s = 0; for (i = 3; i < ARGC; i++) s += ARGV[i] * ARGV[i]; print s }'";
+
+// the sphere of the individuals of the requests (mawk reads its input by blocks, unless interactive)
+const string worker = "exec awk `awk -W version 2>&1 | grep -q mawk && echo -W interactive` '"
+    "left == 0 { response = $1 \" \" $2; left = $2; next } "
+    "{ s = 0; for (i = 3; i <= NF; i++) s += $i * $i; response = response \"\\n\" s; "
+    "if (--left == 0) { print response; fflush() } }'";
+
+/** Time of an evaluation of the population, in milliseconds */
+double time(eoPopEvalFunc<Indi> & eval, eoPop<Indi> & pop, unsigned calls)
+{
+    eoPop<Indi> parents;
+    auto start = chrono::steady_clock::now();
+    for(unsigned c = 0; c < calls; ++c)
+    {
+        for(unsigned i = 0; i < pop.size(); ++i)
+            pop[i].invalidate();
+        eval(parents, pop);
+    }
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / calls;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned size = argc > 1 ? atoi(argv[1]) : 500;
+    unsigned calls = argc > 2 ? atoi(argv[2]) : 3;
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    eoBenchReport report("b-eoEvalProcessPool");
+
+    rng.reseed(42);
+    eoUniformGenerator<double> uGen(-5.12, 5.12);
+    eoInitFixedLength<Indi> init(10, uGen);
+    eoPop<Indi> pop(size, init);
+
+    cout << "size=" << size << " calls=" << calls << endl;
+    cout << "time per evaluation of the population (ms)" << endl;
+    cout << setw(10) << "evaluator" << setw(10) << "workers" << setw(10) << "batch" << setw(12) << "time" << endl;
+
+    eoEvalCmd<Indi> cmd(command);
+    eoPopLoopEval<Indi> loop(cmd);
+    double t = time(loop, pop, calls);
+    cout << setw(10) << "cmd" << setw(10) << "-" << setw(10) << 1 << setw(12) << t << endl;
+    report.record("cmd").param("size", size).value("time", t, "ms");
+
+    vector<unsigned> workers(1, 1);
+    if(threads > 1)
+        workers.push_back(threads);
+    unsigned batches[] = {1, 16};
+    for(unsigned w : workers)
+        for(unsigned b : batches)
+        {
+            eoEvalProcessPool<Indi> pool(worker, w, b);
+            t = time(pool, pop, calls);
+            cout << setw(10) << "pool" << setw(10) << w << setw(10) << b << setw(12) << t << endl;
+            report.record("pool").param("size", size).param("workers", w).param("batch", b).value("time", t, "ms");
+        }
+
+    return 0;
+}
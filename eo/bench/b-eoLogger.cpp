@@ -0,0 +1,57 @@
+/*
+ * Time of a logging statement like the one of eoEvalFuncCounter, when its
+ * level is not selected (through eo::log and through EO_LOG), and when it is
+ * selected and written to /dev/null by the background thread of eo::log. The
+ * time per statement is reported, in nanoseconds.
+ *
+ * Usage: b-eoLogger [statements]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+/** Time of a statement, in nanoseconds */
+template<class Log>
+double time(Log log, unsigned statements)
+{
+    auto start = chrono::steady_clock::now();
+    for(unsigned i = 0; i < statements; ++i)
+        log(i);
+    eo::log.wait();
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(stop - start).count() / statements;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned statements = argc > 1 ? atoi(argv[1]) : 1000000;
+    eoBenchReport report("b-eoLogger");
+
+    eo::log << eo::setlevel(eo::progress) << eo::file("/dev/null");
+
+    double times[3];
+    times[0] = time([](unsigned i) { eo::log << eo::xdebug << "eoEvalFuncCounter: " << i << std::endl; }, statements);
+    times[1] = time([](unsigned i) { EO_LOG(eo::xdebug) << "eoEvalFuncCounter: " << i << std::endl; }, statements);
+    times[2] = time([](unsigned i) { EO_LOG(eo::progress) << "eoEvalFuncCounter: " << i << std::endl; }, statements);
+
+    eo::log << std::cerr;
+
+    cout << "statements=" << statements << endl;
+    cout << "time per statement (ns)" << endl;
+    const char* names[] = {"disabled stream", "disabled macro", "enabled"};
+    for(unsigned m = 0; m < 3; ++m)
+    {
+        cout << setw(18) << names[m] << setw(12) << times[m] << endl;
+        report.record(names[m]).param("statements", statements).value("time", times[m], "ns");
+    }
+
+    return 0;
+}
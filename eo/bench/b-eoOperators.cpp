@@ -0,0 +1,118 @@
+/*
+ * Time of the variation operators on chromosomes of 100 to 10000 genes: the
+ * 1-point and uniform crossovers and the bit mutation of eoBit, the segment
+ * and hypercube crossovers and the uniform mutation of eoReal, the order and
+ * partially mapped crossovers and the swap and shift mutations of
+ * permutations. Every operator is applied to each individual (or each pair of
+ * individuals) of a population of 100, and the time per application is
+ * reported, in microseconds.
+ *
+ * Usage: b-eoOperators [maxGenes] [rounds]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <eo>
+#include <ga.h>
+#include <es.h>
+#include <eoInt.h>
+#include <eoOrderXover.h>
+#include <eoPartiallyMappedXover.h>
+#include <eoShiftMutation.h>
+#include <eoSwapMutation.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoBit<double> BitIndi;
+typedef eoReal<double> RealIndi;
+typedef eoInt<double> Tour;
+
+const unsigned POP_SIZE = 100;
+
+/** Time of an application of a crossover, in microseconds */
+template <class EOT>
+double time(eoQuadOp<EOT> & xover, eoPop<EOT> & pop, unsigned rounds)
+{
+    rng.reseed(42);
+    auto start = chrono::steady_clock::now();
+    for(unsigned r = 0; r < rounds; ++r)
+        for(unsigned i = 0; i + 1 < pop.size(); i += 2)
+            xover(pop[i], pop[i + 1]);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, micro>(stop - start).count() / (rounds * (pop.size() / 2));
+}
+
+/** Time of an application of a mutation, in microseconds */
+template <class EOT>
+double time(eoMonOp<EOT> & mutation, eoPop<EOT> & pop, unsigned rounds)
+{
+    rng.reseed(42);
+    auto start = chrono::steady_clock::now();
+    for(unsigned r = 0; r < rounds; ++r)
+        for(unsigned i = 0; i < pop.size(); ++i)
+            mutation(pop[i]);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, micro>(stop - start).count() / (rounds * pop.size());
+}
+
+/** Prints and records a time */
+void print(eoBenchReport & report, const string & representation, const string & op, unsigned genes, double t)
+{
+    cout << setw(14) << representation << setw(18) << op << setw(8) << genes << setw(12) << t << endl;
+    report.record(op).param("representation", representation).param("genes", genes).value("time", t, "us");
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxGenes = argc > 1 ? atoi(argv[1]) : 10000;
+    unsigned rounds = argc > 2 ? atoi(argv[2]) : 20;
+    eoBenchReport report("b-eoOperators");
+
+    cout << "maxGenes=" << maxGenes << " rounds=" << rounds << " population=" << POP_SIZE << endl;
+    cout << "time per application (us)" << endl;
+    cout << setw(14) << "representation" << setw(18) << "operator" << setw(8) << "genes" << setw(12) << "time" << endl;
+
+    for(unsigned genes = 100; genes <= maxGenes; genes *= 10)
+    {
+        rng.reseed(1);
+
+        eoUniformGenerator<bool> bGen;
+        eoInitFixedLength<BitIndi> bInit(genes, bGen);
+        eoPop<BitIndi> bits(POP_SIZE, bInit);
+        eo1PtBitXover<BitIndi> onePoint;
+        eoUBitXover<BitIndi> uniform;
+        eoBitMutation<BitIndi> bitMutation(1.0 / genes);
+        print(report, "bit", "1-point", genes, time(onePoint, bits, rounds));
+        print(report, "bit", "uniform", genes, time(uniform, bits, rounds));
+        print(report, "bit", "bit mutation", genes, time(bitMutation, bits, rounds));
+
+        eoUniformGenerator<double> rGen(-1, 1);
+        eoInitFixedLength<RealIndi> rInit(genes, rGen);
+        eoPop<RealIndi> reals(POP_SIZE, rInit);
+        eoSegmentCrossover<RealIndi> segment;
+        eoHypercubeCrossover<RealIndi> hypercube;
+        eoUniformMutation<RealIndi> uniformMutation(0.01);
+        print(report, "real", "segment", genes, time(segment, reals, rounds));
+        print(report, "real", "hypercube", genes, time(hypercube, reals, rounds));
+        print(report, "real", "uniform mutation", genes, time(uniformMutation, reals, rounds));
+
+        eoInitPermutation<Tour> pInit(genes);
+        eoPop<Tour> tours(POP_SIZE, pInit);
+        eoOrderXover<Tour> order;
+        eoPartiallyMappedXover<Tour> pmx;
+        eoSwapMutation<Tour> swap;
+        eoShiftMutation<Tour> shift;
+        print(report, "permutation", "order", genes, time(order, tours, rounds));
+        print(report, "permutation", "partially mapped", genes, time(pmx, tours, rounds));
+        print(report, "permutation", "swap", genes, time(swap, tours, rounds));
+        print(report, "permutation", "shift", genes, time(shift, tours, rounds));
+    }
+
+    return 0;
+}
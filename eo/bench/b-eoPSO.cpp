@@ -0,0 +1,93 @@
+/*
+ * Time of the move of a synchronous swarm (velocities then positions), with
+ * an eoStandardVelocity followed by an eoStandardFlight, and with an
+ * eoFusedStandardVelocity, for swarms of 1000 to 10000 particles in 100 and
+ * 1000 dimensions, with a star topology.
+ *
+ * Usage: b-eoPSO [maxParticles] [moves]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoRealParticle < eoMinimizingFitness > Particle;
+
+/** The flight is done by the fused velocity */
+class DummyFlight : public eoFlight < Particle >
+{
+public:
+    void operator()(Particle &) {}
+};
+
+/** Time of a move of the swarm, in milliseconds */
+double time(eoVelocity < Particle > & velocity, eoFlight < Particle > & flight, eoPop < Particle > & swarm, unsigned moves)
+{
+    auto start = chrono::steady_clock::now();
+    for(unsigned m = 0; m < moves; ++m)
+    {
+        velocity.apply(swarm);
+        flight.apply(swarm);
+    }
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / moves;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxParticles = argc > 1 ? atoi(argv[1]) : 10000;
+    unsigned moves = argc > 2 ? atoi(argv[2]) : 5;
+    eoBenchReport report("b-eoPSO");
+
+    cout << "maxParticles=" << maxParticles << " moves=" << moves << endl;
+    cout << "time per move (ms)" << endl;
+    cout << setw(6) << "N" << setw(10) << "particles" << setw(12) << "standard" << setw(12) << "fused" << endl;
+
+    unsigned dimensions[] = {100, 1000};
+    for(unsigned n : dimensions)
+    {
+        eoRealVectorBounds velocityBounds(n, -1, 1);
+        eoRealVectorBounds flightBounds(n, -5, 5);
+        for(unsigned size = 1000; size <= maxParticles; size *= 10)
+        {
+            rng.reseed(42);
+            eoUniformGenerator < double > uGen(-5, 5);
+            eoInitFixedLength < Particle > random(n, uGen);
+            eoUniformGenerator < double > sGen(-1, 1);
+            eoVelocityInitFixedLength < Particle > veloRandom(n, sGen);
+            eoPop < Particle > swarm(size, random);
+            for(unsigned i = 0; i < size; ++i)
+            {
+                veloRandom(swarm[i]);
+                swarm[i].bestPositions = swarm[i];
+                swarm[i].fitness(i);
+                swarm[i].best(swarm[i].fitness());
+            }
+            eoStarTopology < Particle > topology;
+            topology.setup(swarm);
+
+            eoStandardVelocity < Particle > velocity(topology, 0.7, 1.5, 1.5, velocityBounds);
+            eoStandardFlight < Particle > flight(flightBounds);
+            eoFusedStandardVelocity < Particle > fused(topology, 0.7, 1.5, 1.5, velocityBounds, flightBounds);
+            DummyFlight dummyFlight;
+
+            double standardTime = time(velocity, flight, swarm, moves);
+            double fusedTime = time(fused, dummyFlight, swarm, moves);
+            cout << setw(6) << n << setw(10) << size;
+            cout << setw(12) << standardTime;
+            cout << setw(12) << fusedTime;
+            cout << endl;
+            report.record("standard").param("N", n).param("particles", size).value("time", standardTime, "ms");
+            report.record("fused").param("N", n).param("particles", size).value("time", fusedTime, "ms");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * Time of the evaluation of a population of 1000 to 100000 eoReal (Rastrigin
+ * in 10 and 100 dimensions) by an eoPopLoopEval, that is by apply, in sequence
+ * and parallelized by OpenMP with a static and a dynamic schedule (with
+ * OMP_NUM_THREADS threads). The time per evaluation of the population is
+ * reported, in milliseconds.
+ *
+ * Usage: b-eoPopEval [maxSize] [calls]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <eo>
+#include <es.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoReal<eoMinimizingFitness> Indi;
+
+/** Rastrigin, evaluated even when the fitness is valid */
+class Rastrigin : public eoEvalFunc<Indi>
+{
+public:
+    void operator()(Indi & indi)
+    {
+        double f = 10.0 * indi.size();
+        for(unsigned k = 0; k < indi.size(); ++k)
+            f += indi[k] * indi[k] - 10.0 * cos(2 * M_PI * indi[k]);
+        indi.fitness(f);
+    }
+};
+
+/** Sets the parallelization of the loops, as from the command line */
+void parallelize(char* name, bool enabled, bool dynamic)
+{
+    string loop = string("--parallelize-loop=") + (enabled ? "1" : "0");
+    string schedule = string("--parallelize-dynamic=") + (dynamic ? "1" : "0");
+    const char* args[] = {name, loop.c_str(), schedule.c_str()};
+    eoParser parser(3, const_cast<char**>(args));
+    make_parallel(parser);
+}
+
+/** Time of an evaluation of the population, in milliseconds */
+double time(eoPopEvalFunc<Indi> & eval, eoPop<Indi> & pop, unsigned calls)
+{
+    eoPop<Indi> parents;
+    auto start = chrono::steady_clock::now();
+    for(unsigned c = 0; c < calls; ++c)
+        eval(parents, pop);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / calls;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxSize = argc > 1 ? atoi(argv[1]) : 100000;
+    unsigned calls = argc > 2 ? atoi(argv[2]) : 10;
+    eoBenchReport report("b-eoPopEval");
+
+    cout << "maxSize=" << maxSize << " calls=" << calls << endl;
+    cout << "time per evaluation of the population (ms)" << endl;
+    cout << setw(6) << "N" << setw(8) << "size" << setw(14) << "sequential" << setw(14) << "static" << setw(14) << "dynamic" << endl;
+
+    unsigned dimensions[] = {10, 100};
+    for(unsigned n : dimensions)
+    {
+        for(unsigned size = 1000; size <= maxSize; size *= 10)
+        {
+            rng.reseed(42);
+            eoUniformGenerator<double> uGen(-5.12, 5.12);
+            eoInitFixedLength<Indi> init(n, uGen);
+            eoPop<Indi> pop(size, init);
+
+            Rastrigin rastrigin;
+            eoPopLoopEval<Indi> eval(rastrigin);
+
+            const char* names[] = {"sequential", "static", "dynamic"};
+            double times[3];
+            for(unsigned m = 0; m < 3; ++m)
+            {
+                parallelize(argv[0], m > 0, m == 2);
+                times[m] = time(eval, pop, calls);
+            }
+
+            cout << setw(6) << n << setw(8) << size;
+            for(unsigned m = 0; m < 3; ++m)
+            {
+                cout << setw(14) << times[m];
+                report.record(names[m]).param("N", n).param("size", size).value("time", times[m], "ms");
+            }
+            cout << endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * Time of the selection of as many individuals as in a population of 1000 to
+ * 100000 eoReal, by a deterministic tournament, a stochastic tournament, a
+ * roulette wheel (eoProportionalSelect), a stochastic universal sampling and
+ * a linear ranking, each wrapped in an eoSelectPerc. The time per selection of
+ * the whole population is reported, in milliseconds.
+ *
+ * Usage: b-eoSelect [maxSize] [calls]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <es.h>
+#include <eoStochasticUniversalSelect.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoReal<double> Indi;
+
+/** Time of the selection of the population, in milliseconds */
+double time(eoSelectOne<Indi> & selectOne, const eoPop<Indi> & pop, unsigned calls)
+{
+    eoSelectPerc<Indi> select(selectOne);
+    eoPop<Indi> offspring;
+    rng.reseed(42);
+    auto start = chrono::steady_clock::now();
+    for(unsigned c = 0; c < calls; ++c)
+        select(pop, offspring);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / calls;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxSize = argc > 1 ? atoi(argv[1]) : 100000;
+    unsigned calls = argc > 2 ? atoi(argv[2]) : 10;
+    eoBenchReport report("b-eoSelect");
+
+    cout << "maxSize=" << maxSize << " calls=" << calls << " dimension=10" << endl;
+    cout << "time per selection of the population (ms)" << endl;
+    cout << setw(8) << "size" << setw(12) << "det tour" << setw(12) << "stoch tour"
+         << setw(12) << "roulette" << setw(12) << "universal" << setw(12) << "ranking" << endl;
+
+    for(unsigned size = 1000; size <= maxSize; size *= 10)
+    {
+        rng.reseed(1);
+        eoUniformGenerator<double> uGen(0, 1);
+        eoInitFixedLength<Indi> init(10, uGen);
+        eoPop<Indi> pop(size, init);
+        for(unsigned i = 0; i < size; ++i)
+            pop[i].fitness(rng.uniform(1, 100));
+
+        eoDetTournamentSelect<Indi> detTournament(2);
+        eoStochTournamentSelect<Indi> stochTournament(0.8);
+        eoProportionalSelect<Indi> roulette;
+        eoStochasticUniversalSelect<Indi> universal;
+        eoRankingSelect<Indi> ranking(1.5);
+
+        eoSelectOne<Indi>* selects[] = {&detTournament, &stochTournament, &roulette, &universal, &ranking};
+        const char* names[] = {"deterministic tournament", "stochastic tournament", "roulette", "stochastic universal", "ranking"};
+
+        cout << setw(8) << size;
+        for(unsigned s = 0; s < 5; ++s)
+        {
+            double t = time(*selects[s], pop, calls);
+            cout << setw(12) << t;
+            report.record(names[s]).param("size", size).value("time", t, "ms");
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Time of a checkpoint computing the usual statistics on the fitnesses of a
+ * population of 1000 to 100000 eoReal (average, second moment, best, two nth
+ * elements, median, interquartile range, all the fitnesses, FDC), with one
+ * eoStat per statistic and with a single eoFusedFitnessStat, in sequence and
+ * in parallel (with OMP_NUM_THREADS threads). The time per call is reported,
+ * in milliseconds.
+ *
+ * Usage: b-eoStats [maxSize] [calls]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <es.h>
+#include <utils/eoFusedFitnessStat.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoReal<eoMinimizingFitness> Indi;
+
+/** Time of a call of the checkpoint, in milliseconds */
+double time(eoCheckPoint<Indi> & checkpoint, const eoPop<Indi> & pop, unsigned calls)
+{
+    auto start = chrono::steady_clock::now();
+    for(unsigned c = 0; c < calls; ++c)
+        checkpoint(pop);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / calls;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxSize = argc > 1 ? atoi(argv[1]) : 100000;
+    unsigned calls = argc > 2 ? atoi(argv[2]) : 10;
+    eoBenchReport report("b-eoStats");
+
+    cout << "maxSize=" << maxSize << " calls=" << calls << " dimension=10" << endl;
+    cout << "time per checkpoint (ms)" << endl;
+    cout << setw(8) << "size" << setw(14) << "stats" << setw(14) << "fused" << setw(14) << "fused par" << endl;
+
+    unsigned sizes[] = {1000, 10000, 100000};
+    for(unsigned size : sizes)
+    {
+        if(size > maxSize)
+            break;
+
+        rng.reseed(42);
+        eoPop<Indi> pop;
+        for(unsigned i = 0; i < size; ++i)
+        {
+            Indi indi(10, 0.0);
+            double f = 0;
+            for(unsigned k = 0; k < indi.size(); ++k)
+            {
+                indi[k] = rng.uniform(-5, 5);
+                f += indi[k] * indi[k];
+            }
+            indi.fitness(f);
+            pop.push_back(indi);
+        }
+
+        eoQuadDistance<Indi> dist;
+        eoGenContinue<Indi> continuator(calls + 1);
+
+        eoAverageStat<Indi> average;
+        eoSecondMomentStats<Indi> secondMoment;
+        eoBestFitnessStat<Indi> best;
+        eoNthElementFitnessStat<Indi> tenth(9);
+        eoNthElementFitnessStat<Indi> hundredth(99);
+        eoNthElementStat<Indi> median(0.5, "Median");
+        eoInterquartileRangeStat<Indi> iqr;
+        eoScalarFitnessStat<Indi> fitnesses;
+        eoFDCStat<Indi> fdc(dist);
+        eoCheckPoint<Indi> stats(continuator);
+        stats.add(average);
+        stats.add(secondMoment);
+        stats.add(best);
+        stats.add(tenth);
+        stats.add(hundredth);
+        stats.add(median);
+        stats.add(iqr);
+        stats.add(fitnesses);
+        stats.add(fdc);
+
+        double times[2];
+        for(unsigned p = 0; p < 2; ++p)
+        {
+            eoFusedFitnessStat<Indi> fusedStat(p == 1);
+            fusedStat.average();
+            fusedStat.secondMoment();
+            fusedStat.best();
+            fusedStat.nthElement(9);
+            fusedStat.nthElement(99);
+            fusedStat.quantile(0.5);
+            fusedStat.interquartileRange();
+            fusedStat.fitnesses();
+            fusedStat.fdc(dist);
+            eoCheckPoint<Indi> fused(continuator);
+            fused.add(fusedStat);
+            times[p] = time(fused, pop, calls);
+        }
+
+        double statsTime = time(stats, pop, calls);
+        cout << setw(8) << size << setw(14) << statsTime
+             << setw(14) << times[0] << setw(14) << times[1] << endl;
+        report.record("stats").param("size", size).value("time", statsTime, "ms");
+        report.record("fused").param("size", size).value("time", times[0], "ms");
+        report.record("fused parallel").param("size", size).value("time", times[1], "ms");
+    }
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+ * Evaluation of a population of symbolic regression trees (eoSymregNode) on
+ * datasets from 100 to 100000 rows, f(x0, x1) = x0^2 - x0 x1 + sin(x1):
+ *  - row by row, with the apply of eoParseTree (as t-eoSymreg and gpsymreg do),
+ *  - by blocks of rows, with eoSymregBlockEval on eoParseTree,
+ *  - by blocks of rows, with eoSymregBlockEval on eoLinearParseTree.
+ *
+ * The time per evaluation of a tree is reported, in microseconds, along with
+ * the largest relative difference between the fitnesses. The row by row evaluation is not
+ * run anymore on larger datasets once the population has taken more than a given time.
+ *
+ * Then a few generations of subtree crossover and branch mutation are run, the
+ * offspring being evaluated by blocks, without and with an eoSubtreeCache: the
+ * time per generation (ms) and the hit rate of the cache are reported.
+ *
+ * Usage: b-eoSymreg [maxRows] [maxSeconds]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <gp/eoParseTree.h>
+#include <gp/eoLinearParseTree.h>
+#include <gp/eoSymregNode.h>
+#include <gp/eoSymregBlockEval.h>
+#include <gp/eoSubtreeCache.h>
+#include <eo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoMinimizingFitness FitT;
+typedef eoParseTree<FitT, eoSymregNode> Tree;
+typedef eoLinearParseTree<FitT, eoSymregNode> LinearTree;
+
+/** Root mean squared error, row by row */
+double rowByRow(const Tree& tree, const vector< vector<double> >& inputs, const vector<double>& target)
+{
+    vector<double> row(inputs.size());
+    double error = 0.0;
+    for(unsigned r = 0; r < target.size(); ++r)
+    {
+        for(unsigned v = 0; v < inputs.size(); ++v)
+            row[v] = inputs[v][r];
+        double output;
+        tree.apply(output, row);
+        error += (output - target[r]) * (output - target[r]);
+    }
+    error = sqrt(error / target.size());
+    return error <= 1e+20 ? error : 1e+20;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxRows = argc > 1 ? atoi(argv[1]) : 100000;
+    double maxSeconds = argc > 2 ? atof(argv[2]) : 10.0;
+    eoBenchReport report("b-eoSymreg");
+
+    vector<eoSymregNode> nodes;
+    nodes.push_back(eoSymregNode(eoSymregNode::Variable, 0));
+    nodes.push_back(eoSymregNode(eoSymregNode::Variable, 1));
+    nodes.push_back(eoSymregNode(eoSymregNode::Constant, 0, 0.5));
+    nodes.push_back(eoSymregNode(eoSymregNode::Plus));
+    nodes.push_back(eoSymregNode(eoSymregNode::Minus));
+    nodes.push_back(eoSymregNode(eoSymregNode::Multiplies));
+    nodes.push_back(eoSymregNode(eoSymregNode::Divides));
+    nodes.push_back(eoSymregNode(eoSymregNode::Sin));
+    nodes.push_back(eoSymregNode(eoSymregNode::Cos));
+
+    rng.reseed(42);
+    eoParseTreeDepthInit<FitT, eoSymregNode> init(7, nodes, true, true);
+    eoPop<Tree> pop(100, init);
+    eoPop<LinearTree> linearPop;
+    double meanSize = 0;
+    for(unsigned i = 0; i < pop.size(); ++i)
+    {
+        linearPop.push_back(LinearTree(pop[i]));
+        meanSize += pop[i].size();
+    }
+
+    cout << "maxRows=" << maxRows << " maxSeconds=" << maxSeconds << " trees=" << pop.size()
+         << " mean size=" << meanSize / pop.size() << endl;
+    cout << "time per tree (us), '-' when skipped" << endl;
+    cout << setw(8) << "rows" << setw(14) << "row by row" << setw(14) << "block tree"
+         << setw(14) << "block linear" << setw(14) << "max rel diff" << endl;
+
+    bool running = true;
+    unsigned sizes[] = {100, 1000, 10000, 100000};
+    for(unsigned rows : sizes)
+    {
+        if(rows > maxRows)
+            break;
+
+        vector< vector<double> > inputs(2, vector<double>(rows));
+        vector<double> target(rows);
+        for(unsigned r = 0; r < rows; ++r)
+        {
+            inputs[0][r] = rng.uniform(-2, 2);
+            inputs[1][r] = rng.uniform(-2, 2);
+            target[r] = inputs[0][r] * inputs[0][r] - inputs[0][r] * inputs[1][r] + sin(inputs[1][r]);
+        }
+        eoSymregBlockEval<Tree> eval(inputs, target);
+        eoSymregBlockEval<LinearTree> linearEval(inputs, target);
+
+        vector<double> reference(pop.size()), blocks(pop.size()), linear(pop.size());
+
+        double rowTime = -1;
+        if(running)
+        {
+            auto start = chrono::steady_clock::now();
+            for(unsigned i = 0; i < pop.size(); ++i)
+                reference[i] = rowByRow(pop[i], inputs, target);
+            auto stop = chrono::steady_clock::now();
+            rowTime = chrono::duration<double, micro>(stop - start).count() / pop.size();
+            running = rowTime * pop.size() < maxSeconds * 1e6;
+        }
+
+        auto start = chrono::steady_clock::now();
+        for(unsigned i = 0; i < pop.size(); ++i)
+            blocks[i] = eval.error(pop[i]);
+        auto middle = chrono::steady_clock::now();
+        for(unsigned i = 0; i < linearPop.size(); ++i)
+            linear[i] = linearEval.error(linearPop[i]);
+        auto stop = chrono::steady_clock::now();
+
+        double diff = 0;
+        for(unsigned i = 0; i < pop.size(); ++i)
+        {
+            double scale = max(1.0, fabs(blocks[i]));
+            diff = max(diff, fabs(linear[i] - blocks[i]) / scale);
+            if(rowTime >= 0)
+                diff = max(diff, fabs(reference[i] - blocks[i]) / scale);
+        }
+
+        double blockTime = chrono::duration<double, micro>(middle - start).count() / pop.size();
+        double linearTime = chrono::duration<double, micro>(stop - middle).count() / pop.size();
+        cout << setw(8) << rows;
+        if(rowTime >= 0)
+        {
+            cout << setw(14) << rowTime;
+            report.record("row by row").param("rows", rows).value("time", rowTime, "us");
+        }
+        else
+            cout << setw(14) << "-";
+        cout << setw(14) << blockTime << setw(14) << linearTime << setw(14) << diff << endl;
+        report.record("block tree").param("rows", rows).value("time", blockTime, "us").value("max rel diff", diff);
+        report.record("block linear").param("rows", rows).value("time", linearTime, "us");
+    }
+
+    cout << endl << "generations of " << pop.size() << " offspring, time per generation (ms)" << endl;
+    cout << setw(8) << "rows" << setw(14) << "block" << setw(14) << "cached" << setw(14) << "hit rate" << endl;
+    const unsigned generations = 20;
+    for(unsigned rows : sizes)
+    {
+        if(rows < 1000 || rows > maxRows)
+            continue;
+
+        vector< vector<double> > inputs(2, vector<double>(rows));
+        vector<double> target(rows);
+        for(unsigned r = 0; r < rows; ++r)
+        {
+            inputs[0][r] = rng.uniform(-2, 2);
+            inputs[1][r] = rng.uniform(-2, 2);
+            target[r] = inputs[0][r] * inputs[0][r] - inputs[0][r] * inputs[1][r] + sin(inputs[1][r]);
+        }
+        // about 256 MB of values
+        eoSubtreeCache<eoSymregNode> cache((1u << 25) / rows);
+        eoSymregBlockEval<Tree> eval(inputs, target);
+        eoSymregBlockEval<Tree> cachedEval(inputs, target, cache);
+
+        double times[2];
+        for(unsigned c = 0; c < 2; ++c)
+        {
+            eoSymregBlockEval<Tree>& e = c == 0 ? eval : cachedEval;
+            rng.reseed(42);
+            eoSubtreeXOver<FitT, eoSymregNode> xover(100);
+            eoBranchMutation<FitT, eoSymregNode> mutation(init, 100);
+            eoPop<Tree> parents(pop), offspring;
+            for(unsigned i = 0; i < parents.size(); ++i)
+                e(parents[i]);
+
+            auto start = chrono::steady_clock::now();
+            for(unsigned g = 0; g < generations; ++g)
+            {
+                offspring.clear();
+                for(unsigned i = 0; i < parents.size(); ++i)
+                    offspring.push_back(parents[rng.random(parents.size())]);
+                for(unsigned i = 0; i + 1 < offspring.size(); i += 2)
+                {
+                    if(rng.flip(0.9))
+                        xover(offspring[i], offspring[i + 1]);
+                    if(rng.flip(0.1))
+                        mutation(offspring[i]);
+                    offspring[i].invalidate();
+                    offspring[i + 1].invalidate();
+                }
+                for(unsigned i = 0; i < offspring.size(); ++i)
+                    e(offspring[i]);
+                // truncation among parents and offspring
+                parents.insert(parents.end(), offspring.begin(), offspring.end());
+                parents.nth_element(pop.size());
+                parents.resize(pop.size());
+            }
+            auto stop = chrono::steady_clock::now();
+            times[c] = chrono::duration<double, milli>(stop - start).count() / generations;
+        }
+        cout << setw(8) << rows << setw(14) << times[0] << setw(14) << times[1] << setw(14) << cache.hitRate() << endl;
+        report.record("generation block").param("rows", rows).value("time", times[0], "ms");
+        report.record("generation cached").param("rows", rows).value("time", times[1], "ms").value("hit rate", cache.hitRate());
+    }
+
+    return 0;
+}
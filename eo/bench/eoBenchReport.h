@@ -0,0 +1,205 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoBenchReport.h : the results of a benchmark, as JSON
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoBenchReport_h
+#define eoBenchReport_h
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/** eoBenchReport --> the measures of a benchmark, written as JSON.
+
+The benchmarks print their tables on the standard output, and record every
+measure in a report:
+@code
+eoBenchReport report("b-eoPSO");
+report.record("fused").param("dimension", n).param("particles", size).value("time", t, "ms");
+@endcode
+When the environment variable PARADISEO_BENCH_JSON is set, the report is written
+to the file it names when it is destroyed (see the paradiseo-bench target):
+@code
+{"benchmark": "b-eoPSO", "threads": 4, "openmp": true, "results": [
+  {"case": "fused", "params": {"dimension": 100, "particles": 1000}, "values": {"time": {"value": 1.5, "unit": "ms"}}}
+]}
+@endcode
+The values which are not finite are written as null.
+*/
+class eoBenchReport
+{
+public :
+
+    /** A measured case: its parameters and its values */
+    class Record
+    {
+    public :
+
+        Record(const std::string& _name) : name(_name) {}
+
+        Record& param(const std::string& _key, double _value)
+        {
+            params.push_back(std::make_pair(_key, number(_value)));
+            return *this;
+        }
+
+        Record& param(const std::string& _key, const std::string& _value)
+        {
+            params.push_back(std::make_pair(_key, quote(_value)));
+            return *this;
+        }
+
+        Record& value(const std::string& _key, double _value, const std::string& _unit = "")
+        {
+            values.push_back(std::make_pair(_key, "{\"value\": " + number(_value) + ", \"unit\": " + quote(_unit) + "}"));
+            return *this;
+        }
+
+        void printOn(std::ostream& _os) const
+        {
+            _os << "{\"case\": " << quote(name) << ", \"params\": ";
+            printMap(_os, params);
+            _os << ", \"values\": ";
+            printMap(_os, values);
+            _os << "}";
+        }
+
+    private :
+
+        static void printMap(std::ostream& _os, const std::vector< std::pair<std::string, std::string> >& _map)
+        {
+            _os << "{";
+            for (unsigned i = 0; i < _map.size(); ++i)
+                _os << (i > 0 ? ", " : "") << quote(_map[i].first) << ": " << _map[i].second;
+            _os << "}";
+        }
+
+        std::string name;
+        std::vector< std::pair<std::string, std::string> > params;
+        std::vector< std::pair<std::string, std::string> > values;
+    };
+
+    /**
+     * Constructor
+     * @param _benchmark the name of the benchmark
+     */
+    eoBenchReport(const std::string& _benchmark) : benchmark(_benchmark)
+    {
+        const char* path = std::getenv("PARADISEO_BENCH_JSON");
+        if (path != 0)
+            file = path;
+    }
+
+    /// writes the report, if the environment asks for it
+    ~eoBenchReport()
+    {
+        if (file.empty())
+            return;
+        std::ofstream os(file.c_str());
+        if (!os)
+        {
+            std::cerr << benchmark << ": cannot write " << file << std::endl;
+            return;
+        }
+        printOn(os);
+    }
+
+    /// a new measured case, whose parameters and values are then added
+    Record& record(const std::string& _case)
+    {
+        records.push_back(Record(_case));
+        return records.back();
+    }
+
+    void printOn(std::ostream& _os) const
+    {
+        _os << "{\"benchmark\": " << quote(benchmark) << ", \"threads\": " << threads()
+#ifdef _OPENMP
+            << ", \"openmp\": true"
+#else
+            << ", \"openmp\": false"
+#endif
+            << ", \"results\": [";
+        bool first = true;
+        for (std::list<Record>::const_iterator it = records.begin(); it != records.end(); ++it)
+        {
+            _os << (first ? "\n  " : ",\n  ");
+            it->printOn(_os);
+            first = false;
+        }
+        _os << "\n]}\n";
+    }
+
+    /// a number as JSON
+    static std::string number(double _value)
+    {
+        if (!std::isfinite(_value))
+            return "null";
+        std::ostringstream os;
+        os << std::setprecision(10) << _value;
+        return os.str();
+    }
+
+    /// a string as JSON
+    static std::string quote(const std::string& _s)
+    {
+        std::string result = "\"";
+        for (unsigned i = 0; i < _s.size(); ++i)
+        {
+            char c = _s[i];
+            if (c == '"' || c == '\\')
+                result += '\\';
+            if (c == '\n')
+                result += "\\n";
+            else if ((unsigned char) c >= 0x20)
+                result += c;
+        }
+        return result + "\"";
+    }
+
+private :
+
+    static unsigned threads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return std::thread::hardware_concurrency();
+#endif
+    }
+
+    std::string benchmark;
+    std::string file;
+    std::list<Record> records;
+};
+
+#endif
@@ -29,6 +29,7 @@
 #include "utils/eoParallel.h"
 #include "utils/eoParser.h"
 #include "utils/eoLogger.h"
+#include "utils/eoRNG.h"
 #include "eoFunctor.h"
 #include <vector>
 
@@ -36,9 +37,28 @@
 #include <omp.h>
 #endif
 
+/**
+  Applies a unary function on one element with the global rng bound to the
+  stream (_seed, _i), so that the numbers it draws do not depend on the thread
+  running it.
+
+  @ingroup Utilities
+*/
+template <class EOT>
+inline void apply_with_stream(eoUF<EOT&, void>& _proc, EOT& _eo, uint64_t _seed, uint64_t _i)
+{
+    eoRngStream stream(_seed, _i);
+    eoRngStreamScope scope(stream);
+    _proc(_eo);
+}
+
 /**
   Applies a unary function to a std::vector of things.
 
+  When the loop is parallelized, each element is processed with its own
+  eoRngStream, seeded from the global rng: the results are then the same
+  whatever the number of threads and the scheduling.
+
   @ingroup Utilities
 */
 template <class EOT>
@@ -55,28 +75,34 @@ void apply(eoUF<EOT&, void>& _proc, std::vector<EOT>& _pop)
         t1 = omp_get_wtime();
     }
 
-    if (!eo::parallel.isDynamic())
+    if (!eo::parallel.isEnabled())
     {
-#pragma omp parallel for if(eo::parallel.isEnabled()) //default(none) shared(_proc, _pop, size)
+        for (size_t i = 0; i < size; ++i) { _proc(_pop[i]); }
+    }
+    else if (!eo::parallel.isDynamic())
+    {
+        const uint64_t seed = eo::streamSeed();
+#pragma omp parallel for //default(none) shared(_proc, _pop, size)
 #ifdef _MSC_VER
         //Visual Studio supports only OpenMP version 2.0 in which
         //an index variable must be of a signed integral type
-        for (long long i = 0; i < size; ++i) { _proc(_pop[i]); }
+        for (long long i = 0; i < size; ++i) { apply_with_stream(_proc, _pop[i], seed, i); }
 #else // _MSC_VER
-        for (size_t i = 0; i < size; ++i) { _proc(_pop[i]); }
+        for (size_t i = 0; i < size; ++i) { apply_with_stream(_proc, _pop[i], seed, i); }
 #endif
     }
     else
     {
-#pragma omp parallel for schedule(dynamic) if(eo::parallel.isEnabled())
+        const uint64_t seed = eo::streamSeed();
+#pragma omp parallel for schedule(dynamic)
 #ifdef _MSC_VER
         //Visual Studio supports only OpenMP version 2.0 in which
         //an index variable must be of a signed integral type
-        for (long long i = 0; i < size; ++i) { _proc(_pop[i]); }
+        for (long long i = 0; i < size; ++i) { apply_with_stream(_proc, _pop[i], seed, i); }
 #else // _MSC_VER
         //doesnot work with gcc 4.1.2
         //default(none) shared(_proc, _pop, size)
-        for (size_t i = 0; i < size; ++i) { _proc(_pop[i]); }
+        for (size_t i = 0; i < size; ++i) { apply_with_stream(_proc, _pop[i], seed, i); }
 #endif
     }
 
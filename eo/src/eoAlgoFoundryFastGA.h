@@ -152,7 +152,7 @@ class eoAlgoFoundryFastGA : public eoAlgoFoundry<EOT>
 
             // Objective function calls counter
             eoEvalCounterThrowException<EOT> eval(_eval, _max_evals);
-            eo::log << eo::xdebug << "Evaluations: " << eval.value() << " / " << _max_evals << std::endl;
+            EO_LOG(eo::xdebug) << "Evaluations: " << eval.value() << " / " << _max_evals << std::endl;
             eoPopLoopEval<EOT> pop_eval(eval);
 
             // Algorithm itself
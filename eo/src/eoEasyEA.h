@@ -36,6 +36,7 @@
 #include "eoBreed.h"
 #include "eoMergeReduce.h"
 #include "eoReplacement.h"
+#include "utils/eoProfiler.h"
 
 
 
@@ -257,8 +258,13 @@ template<class EOT> class eoEasyEA: public eoAlgo<EOT>
 
       eoPop<EOT> empty_pop;
 
-      popEval(empty_pop, _pop); // A first eval of pop.
+      {
+          EO_PROFILE_SCOPE("evaluate");
+          EO_PROFILE_COUNT("evaluations", eoProfileInvalid(_pop));
+          popEval(empty_pop, _pop); // A first eval of pop.
+      }
 
+      bool cont;
       do
         {
           // try
@@ -266,11 +272,21 @@ template<class EOT> class eoEasyEA: public eoAlgo<EOT>
               unsigned pSize = _pop.size();
               offspring.clear(); // new offspring
 
-              breed(_pop, offspring);
+              {
+                  EO_PROFILE_SCOPE("breed");
+                  breed(_pop, offspring);
+              }
 
-              popEval(_pop, offspring); // eval of parents + offspring if necessary
+              {
+                  EO_PROFILE_SCOPE("evaluate");
+                  EO_PROFILE_COUNT("evaluations", eoProfileInvalid(offspring));
+                  popEval(_pop, offspring); // eval of parents + offspring if necessary
+              }
 
-              replace(_pop, offspring); // after replace, the new pop. is in _pop
+              {
+                  EO_PROFILE_SCOPE("replace");
+                  replace(_pop, offspring); // after replace, the new pop. is in _pop
+              }
 
               // std::cout << _pop << std::endl;
 
@@ -286,8 +302,11 @@ template<class EOT> class eoEasyEA: public eoAlgo<EOT>
           //     s.append( " in eoEasyEA");
           //     throw std::runtime_error( s );
           //   }
+
+              EO_PROFILE_SCOPE("checkpoint");
+              cont = continuator( _pop );
         }
-      while ( continuator( _pop ) );
+      while ( cont );
     }
 
   protected :
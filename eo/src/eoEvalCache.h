@@ -0,0 +1,414 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoEvalCache.h : the fitnesses of the genotypes already evaluated
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoEvalCache_h
+#define eoEvalCache_h
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "eoEvalFunc.h"
+#include "eoVector.h"
+#include "eoPop.h"
+#include "utils/eoParser.h"
+#include "utils/eoStat.h"
+
+/**
+    The 128 bits fingerprint of a genotype, built from the values of its genes.
+    Two genotypes with the same fingerprint are taken as equal by eoEvalCache.
+
+    @ingroup Evaluation
+*/
+struct eoGenotypeFingerprint
+{
+    eoGenotypeFingerprint() : a(0x243F6A8885A308D3ULL), b(0x13198A2E03707344ULL) {}
+
+    /// adds a value to the fingerprint
+    void add(uint64_t _value)
+    {
+        a = mix(a ^ _value);
+        b = fmix((b + _value) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    bool operator==(const eoGenotypeFingerprint& _other) const
+    {
+        return a == _other.a && b == _other.b;
+    }
+
+    uint64_t a;
+    uint64_t b;
+
+private:
+
+    // the finalizers of splitmix64 and murmur3, for two independent halves
+    static uint64_t mix(uint64_t _z)
+    {
+        _z += 0x9E3779B97F4A7C15ULL;
+        _z = (_z ^ (_z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        _z = (_z ^ (_z >> 27)) * 0x94D049BB133111EBULL;
+        return _z ^ (_z >> 31);
+    }
+
+    static uint64_t fmix(uint64_t _k)
+    {
+        _k ^= _k >> 33;
+        _k *= 0xFF51AFD7ED558CCDULL;
+        _k ^= _k >> 33;
+        _k *= 0xC4CEB9FE1A85EC53ULL;
+        return _k ^ (_k >> 33);
+    }
+};
+
+/// the fingerprint of the genes of an eoVector (and so of eoBit, eoInt, eoReal...), hashed with std::hash
+template <class FitT, class GeneType>
+eoGenotypeFingerprint eoFingerprint(const eoVector<FitT, GeneType>& _eo)
+{
+    eoGenotypeFingerprint fingerprint;
+    std::hash<GeneType> hash;
+    for (typename eoVector<FitT, GeneType>::const_iterator it = _eo.begin(); it != _eo.end(); ++it)
+        fingerprint.add(hash(*it));
+    fingerprint.add(_eo.size());
+    return fingerprint;
+}
+
+/// the fingerprint of the bits of an eoVector of bool, 64 bits at a time
+template <class FitT>
+eoGenotypeFingerprint eoFingerprint(const eoVector<FitT, bool>& _eo)
+{
+    eoGenotypeFingerprint fingerprint;
+    uint64_t word = 0;
+    for (unsigned i = 0; i < _eo.size(); ++i)
+    {
+        word |= uint64_t(_eo[i]) << (i % 64);
+        if (i % 64 == 63)
+        {
+            fingerprint.add(word);
+            word = 0;
+        }
+    }
+    fingerprint.add(word);
+    fingerprint.add(_eo.size());
+    return fingerprint;
+}
+
+/**
+    The hash of the genotypes used by eoEvalCache, which calls eoFingerprint.
+    For the other genotypes, either overload eoFingerprint, or specialize this
+    class, building an eoGenotypeFingerprint from all the values the fitness
+    depends on:
+    @code
+    template <> struct eoGenotypeHash<Route>
+    {
+        eoGenotypeFingerprint operator()(const Route& _route) const
+        {
+            eoGenotypeFingerprint fingerprint;
+            for (unsigned i = 0; i < _route.size(); ++i)
+                fingerprint.add(_route[i].id());
+            return fingerprint;
+        }
+    };
+    @endcode
+
+    @ingroup Evaluation
+*/
+template <class EOT>
+struct eoGenotypeHash
+{
+    eoGenotypeFingerprint operator()(const EOT& _eo) const
+    {
+        return eoFingerprint(_eo);
+    }
+};
+
+/**
+    Evaluates the genotypes which were not evaluated yet, and gives the others
+    the fitness they had: the offspring which are copies of an individual
+    evaluated earlier (unmodified by the variation operators, or generated
+    again) are not evaluated again.
+
+    The fitnesses are kept in a bounded cache, split into shards with their
+    own lock, so that the evaluation can be shared among the threads of the
+    parallel loops (see eoPopLoopEval and make_parallel) or of the smp
+    Scheduler; a genotype evaluated by two threads at once is evaluated twice.
+    In every shard, the fitness to be replaced by a new one is chosen by the
+    CLOCK algorithm, which approximates the least recently used one without
+    moving anything on a hit.
+
+    The genotypes are identified by their eoGenotypeFingerprint, given by Hash,
+    and are not stored: an entry holds the fingerprint, the fitness and a flag,
+    that is about 40 bytes for a scalar fitness (plus the node of the hash
+    table), and the capacity bounds the memory used. It can be given on the
+    command line by the constructor taking an eoParser (--eval-cache-size).
+
+    The fitness must only depend on the genotype: this is not the case of
+    dynamic or noisy functions.
+
+    @ingroup Evaluation
+*/
+template <class EOT, class Hash = eoGenotypeHash<EOT> >
+class eoEvalCache : public eoEvalFunc<EOT>
+{
+public :
+
+    typedef typename EOT::Fitness Fitness;
+
+    /**
+     * Constructor
+     * @param _func the evaluation function
+     * @param _capacity the maximum number of fitnesses, 0 to evaluate everything
+     * @param _shards the number of parts of the cache with their own lock
+     */
+    eoEvalCache(eoEvalFunc<EOT>& _func, unsigned long _capacity = 100000, unsigned _shards = 64)
+        : func(_func)
+    {
+        init(_capacity, _shards);
+    }
+
+    /**
+     * Constructor, the capacity being read by the parser (--eval-cache-size)
+     * @param _func the evaluation function
+     * @param _parser the parser
+     * @param _shards the number of parts of the cache with their own lock
+     */
+    eoEvalCache(eoEvalFunc<EOT>& _func, eoParser& _parser, unsigned _shards = 64)
+        : func(_func)
+    {
+        unsigned long capacity = _parser.getORcreateParam(100000UL, "eval-cache-size",
+                "Maximum number of fitnesses kept by the evaluation cache (0 to disable it)", '\0', "Evaluation").value();
+        init(capacity, _shards);
+    }
+
+    virtual void operator()(EOT& _eo)
+    {
+        if (!_eo.invalid())
+            return;
+        if (shards.empty())
+        {
+            func(_eo);
+            return;
+        }
+
+        eoGenotypeFingerprint key = hash(_eo);
+        Shard& shard = *shards[key.b % shards.size()];
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            typename Index::iterator it = shard.index.find(key);
+            if (it != shard.index.end())
+            {
+                Slot& slot = shard.slots[it->second];
+                slot.referenced = true;
+                shard.hits++;
+                _eo.fitness(slot.fitness);
+                return;
+            }
+            shard.misses++;
+        }
+
+        func(_eo);
+        if (!_eo.invalid())
+            insert(shard, key, _eo.fitness());
+    }
+
+    /// the number of genotypes whose fitness was found
+    unsigned long hits() const
+    {
+        unsigned long n = 0;
+        for (unsigned s = 0; s < shards.size(); ++s)
+        {
+            std::lock_guard<std::mutex> lock(shards[s]->mutex);
+            n += shards[s]->hits;
+        }
+        return n;
+    }
+
+    /// the number of genotypes which were evaluated
+    unsigned long misses() const
+    {
+        unsigned long n = 0;
+        for (unsigned s = 0; s < shards.size(); ++s)
+        {
+            std::lock_guard<std::mutex> lock(shards[s]->mutex);
+            n += shards[s]->misses;
+        }
+        return n;
+    }
+
+    /// the number of fitnesses in the cache
+    unsigned long size() const
+    {
+        unsigned long n = 0;
+        for (unsigned s = 0; s < shards.size(); ++s)
+        {
+            std::lock_guard<std::mutex> lock(shards[s]->mutex);
+            n += shards[s]->slots.size();
+        }
+        return n;
+    }
+
+    /// the maximum number of fitnesses
+    unsigned long capacity() const
+    {
+        return totalCapacity;
+    }
+
+    /// removes all the fitnesses, for instance when the evaluation function changes
+    void clear()
+    {
+        for (unsigned s = 0; s < shards.size(); ++s)
+        {
+            std::lock_guard<std::mutex> lock(shards[s]->mutex);
+            shards[s]->index.clear();
+            shards[s]->slots.clear();
+            shards[s]->hand = 0;
+        }
+    }
+
+private :
+
+    struct FingerprintHash
+    {
+        size_t operator()(const eoGenotypeFingerprint& _key) const
+        {
+            return _key.a;
+        }
+    };
+
+    typedef std::unordered_map<eoGenotypeFingerprint, unsigned, FingerprintHash> Index;
+
+    struct Slot
+    {
+        eoGenotypeFingerprint key;
+        Fitness fitness;
+        /** set on a hit, cleared when the clock hand passes */
+        bool referenced;
+    };
+
+    struct Shard
+    {
+        Shard(unsigned long _capacity) : capacity(_capacity), hand(0), hits(0), misses(0) {}
+
+        std::mutex mutex;
+        Index index;
+        std::vector<Slot> slots;
+        const unsigned long capacity;
+        unsigned hand;
+        unsigned long hits;
+        unsigned long misses;
+    };
+
+    void init(unsigned long _capacity, unsigned _shards)
+    {
+        // no more shards than fitnesses
+        unsigned n = _capacity == 0 ? 0 : (unsigned) std::max(1UL, std::min<unsigned long>(_shards, _capacity));
+        totalCapacity = _capacity;
+        // the remainder is spread over the first shards
+        for (unsigned s = 0; s < n; ++s)
+            shards.push_back(std::unique_ptr<Shard>(new Shard(_capacity / n + (s < _capacity % n ? 1 : 0))));
+    }
+
+    /** stores a fitness, unless another thread did it meanwhile, in place of one which was not used since the last turn of the hand */
+    void insert(Shard& _shard, const eoGenotypeFingerprint& _key, const Fitness& _fitness)
+    {
+        std::lock_guard<std::mutex> lock(_shard.mutex);
+        if (_shard.index.find(_key) != _shard.index.end())
+            return;
+
+        Slot slot = {_key, _fitness, false};
+        if (_shard.slots.size() < _shard.capacity)
+        {
+            _shard.index[_key] = _shard.slots.size();
+            _shard.slots.push_back(slot);
+            return;
+        }
+        while (_shard.slots[_shard.hand].referenced)
+        {
+            _shard.slots[_shard.hand].referenced = false;
+            _shard.hand = (_shard.hand + 1) % _shard.capacity;
+        }
+        _shard.index.erase(_shard.slots[_shard.hand].key);
+        _shard.index[_key] = _shard.hand;
+        _shard.slots[_shard.hand] = slot;
+        _shard.hand = (_shard.hand + 1) % _shard.capacity;
+    }
+
+    eoEvalFunc<EOT>& func;
+    Hash hash;
+    unsigned long totalCapacity;
+    std::vector< std::unique_ptr<Shard> > shards;
+};
+
+/** eoEvalCacheStat --> the ratio of the genotypes found in an eoEvalCache since the previous call,
+that is, during the last generation when it is added to the checkpoint. The numbers of hits and of
+misses since the previous call are also given, to be monitored.
+
+@ingroup Stats
+*/
+template <class EOT, class Hash = eoGenotypeHash<EOT> >
+class eoEvalCacheStat : public eoStat<EOT, double>
+{
+public :
+
+    using eoStat<EOT, double>::value;
+
+    /**
+     * Constructor
+     * @param _cache the cache
+     * @param _description the name of the statistic
+     */
+    eoEvalCacheStat(const eoEvalCache<EOT, Hash>& _cache, std::string _description = "Eval. cache hit rate")
+        : eoStat<EOT, double>(0.0, _description), cache(_cache),
+          hitsParam(0, "Eval. cache hits"), missesParam(0, "Eval. cache misses"),
+          hits(_cache.hits()), misses(_cache.misses()) {}
+
+    virtual std::string className(void) const { return "eoEvalCacheStat"; }
+
+    void operator()(const eoPop<EOT>&)
+    {
+        unsigned long newHits = cache.hits();
+        unsigned long newMisses = cache.misses();
+        hitsParam.value() = newHits - hits;
+        missesParam.value() = newMisses - misses;
+        unsigned long total = hitsParam.value() + missesParam.value();
+        value() = total == 0 ? 0.0 : double(hitsParam.value()) / total;
+        hits = newHits;
+        misses = newMisses;
+    }
+
+    /// the number of genotypes found since the previous call
+    eoValueParam<unsigned long>& hitCount() { return hitsParam; }
+
+    /// the number of genotypes evaluated since the previous call
+    eoValueParam<unsigned long>& missCount() { return missesParam; }
+
+private :
+
+    const eoEvalCache<EOT, Hash>& cache;
+    eoValueParam<unsigned long> hitsParam;
+    eoValueParam<unsigned long> missesParam;
+    unsigned long hits;
+    unsigned long misses;
+};
+
+#endif
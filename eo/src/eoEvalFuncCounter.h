@@ -47,8 +47,13 @@ template<class EOT> class eoEvalFuncCounter : public eoEvalFunc<EOT>, public eoV
             if (_eo.invalid())
             {
                 func(_eo);
-                value()++;
-                eo::log << eo::xdebug << "eoEvalFuncCounter: " << value() << std::endl;
+                // the populations and the neighborhoods may be evaluated by several threads
+                unsigned long& n = value();
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                n++;
+                EO_LOG(eo::xdebug) << "eoEvalFuncCounter: " << value() << std::endl;
             }
         }
 
@@ -57,7 +57,7 @@ public :
 
             if(not std::isfinite(sol.fitness()) ) {
 #ifndef NDEBUG
-                eo::log << eo::xdebug << sol << std::endl;
+                EO_LOG(eo::xdebug) << sol << std::endl;
 #endif
                 throw eoNanException();
             }
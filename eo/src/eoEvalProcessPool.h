@@ -0,0 +1,422 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoEvalProcessPool.h : evaluation of a population by long-lived external processes
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoEvalProcessPool_h
+#define eoEvalProcessPool_h
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <deque>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "eoPopEvalFunc.h"
+#include "eoExceptions.h"
+
+/**
+    Evaluates the offspring with a pool of long-lived external processes, the
+    workers, instead of spawning a process per individual as eoEvalCmd does.
+
+    Every worker runs the command with `/bin/sh -c`, its standard input and
+    output being connected to the pool. The invalid offspring are sent in
+    requests of at most batchSize individuals, and every worker is given up to
+    inFlight requests before answering the first one, so that it never waits
+    for the next request. A request is a header line followed by one line per
+    individual, in its default serialization (which must hold on one line):
+    @code
+    <request id> <n>
+    INVALID 3 1.0 2.1 3.2
+    ...
+    @endcode
+    and the worker answers every request, in any order, with the same header
+    followed by one line per fitness, in the order of the individuals:
+    @code
+    <request id> <n>
+    7.2
+    ...
+    @endcode
+    The worker ends when its standard input is closed; see
+    test/t-eoEvalProcessPool.sh for a stand-in evaluator.
+
+    A worker which exits, answers a malformed response, or holds requests
+    without answering any for more than timeout seconds, is killed with its
+    process group and started again, and its requests are sent again. A
+    request failing more than maxRetries times throws an eoSystemError.
+
+    @note Uses the POSIX process and socket functions.
+
+    @ingroup Evaluation
+*/
+template <class EOT>
+class eoEvalProcessPool : public eoPopEvalFunc<EOT>
+{
+public:
+    typedef typename EOT::Fitness Fitness;
+
+    /**
+        @param _cmd the command run by the workers
+        @param _workers the number of workers, the number of hardware threads if 0
+        @param _batchSize the maximum number of individuals of a request
+        @param _inFlight the number of requests given at once to a worker
+        @param _timeout the seconds a busy worker may stay silent, unbounded if 0
+        @param _maxRetries the number of times a request is sent again
+    */
+    eoEvalProcessPool(std::string _cmd, unsigned _workers = 0, unsigned _batchSize = 16,
+                      unsigned _inFlight = 2, double _timeout = 0, unsigned _maxRetries = 2) :
+        cmd(_cmd),
+        workers(_workers > 0 ? _workers : std::max(1u, std::thread::hardware_concurrency())),
+        batchSize(std::max(1u, _batchSize)),
+        inFlight(std::max(1u, _inFlight)),
+        timeout(_timeout),
+        maxRetries(_maxRetries),
+        nextId(0),
+        nFailures(0)
+    {}
+
+    ~eoEvalProcessPool()
+    {
+        for (unsigned w = 0; w < workers.size(); ++w)
+            stop(workers[w], true);
+    }
+
+    /// evaluates the invalid offspring
+    void operator()(eoPop<EOT>& _parents, eoPop<EOT>& _offspring)
+    {
+        (void)_parents;
+
+        // the requests, in the order they are sent
+        requests.clear();
+        pending.clear();
+        for (unsigned i = 0; i < _offspring.size(); ++i)
+            if (_offspring[i].invalid())
+            {
+                if (requests.empty() || requests.back().individuals.size() == batchSize)
+                {
+                    requests.push_back(Request());
+                    requests.back().id = nextId++;
+                    pending.push_back(requests.size() - 1);
+                }
+                requests.back().individuals.push_back(i);
+            }
+
+        unsigned answered = 0;
+        while (answered < requests.size())
+        {
+            for (unsigned w = 0; w < workers.size(); ++w)
+            {
+                if (workers[w].pid <= 0 && !pending.empty())
+                    start(workers[w]);
+                while (workers[w].requests.size() < inFlight && !pending.empty())
+                    give(workers[w], pending.front(), _offspring);
+            }
+
+            std::vector<pollfd> fds(workers.size());
+            for (unsigned w = 0; w < workers.size(); ++w)
+            {
+                fds[w].fd = workers[w].fd;
+                fds[w].events = POLLIN | (workers[w].out.empty() ? 0 : POLLOUT);
+                fds[w].revents = 0;
+            }
+            if (poll(fds.data(), fds.size(), waitTime()) < 0 && errno != EINTR)
+                systemError("poll");
+
+            for (unsigned w = 0; w < workers.size(); ++w)
+            {
+                Worker& worker = workers[w];
+                std::string error;
+                if ((fds[w].revents & POLLOUT) && !flush(worker))
+                    error = "cannot be written to";
+                if (error.empty() && (fds[w].revents & (POLLIN | POLLHUP | POLLERR)))
+                    error = receive(worker, _offspring, answered);
+                if (error.empty() && timeout > 0 && !worker.requests.empty()
+                    && seconds(worker.since) > timeout)
+                    error = "timed out";
+                if (!error.empty())
+                    fail(worker, error);
+            }
+        }
+    }
+
+    /// the number of workers
+    unsigned size() const
+    {
+        return workers.size();
+    }
+
+    /// the number of failures of the workers
+    unsigned long failures() const
+    {
+        return nFailures;
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Request
+    {
+        Request() : id(0), attempts(0) {}
+
+        unsigned long id;
+        std::vector<unsigned> individuals;  // indexes in the offspring
+        unsigned attempts;
+    };
+
+    struct Worker
+    {
+        Worker() : pid(-1), fd(-1) {}
+
+        pid_t pid;
+        int fd;
+        std::string out;                    // the requests not written yet
+        std::string in;                     // the responses not read yet
+        std::deque<unsigned> requests;      // the requests given, not answered
+        Clock::time_point since;            // the last answer, or the first request
+    };
+
+    /// starts the command, connected to the pool by a socket
+    void start(Worker& _worker)
+    {
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0)
+            systemError("socketpair");
+        // no socket leaks into the workers started later
+        fcntl(sockets[0], F_SETFD, FD_CLOEXEC);
+        fcntl(sockets[1], F_SETFD, FD_CLOEXEC);
+
+        pid_t pid = fork();
+        if (pid < 0)
+            systemError("fork");
+        if (pid == 0)
+        {
+            setpgid(0, 0);
+            dup2(sockets[1], STDIN_FILENO);
+            dup2(sockets[1], STDOUT_FILENO);
+            execl("/bin/sh", "sh", "-c", cmd.c_str(), (char*) NULL);
+            _exit(127);
+        }
+        setpgid(pid, pid);
+        close(sockets[1]);
+        fcntl(sockets[0], F_SETFL, fcntl(sockets[0], F_GETFL) | O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+        int on = 1;
+        setsockopt(sockets[0], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+
+        _worker.pid = pid;
+        _worker.fd = sockets[0];
+    }
+
+    /// closes the socket and waits for the end of the worker, killing it unless _graceful; returns its status
+    int stop(Worker& _worker, bool _graceful)
+    {
+        if (_worker.pid <= 0)
+            return 0;
+        close(_worker.fd);
+
+        int status = 0;
+        pid_t ended = 0;
+        for (unsigned wait = 0; _graceful && ended == 0 && wait < 100; ++wait)
+        {
+            ended = waitpid(_worker.pid, &status, WNOHANG);
+            if (ended == 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        kill(-_worker.pid, SIGKILL);
+        if (ended == 0)
+            waitpid(_worker.pid, &status, 0);
+
+        _worker.pid = -1;
+        _worker.fd = -1;
+        _worker.out.clear();
+        _worker.in.clear();
+        _worker.requests.clear();
+        return status;
+    }
+
+    /// kills the worker, which is started again when needed, and sends its requests again first
+    void fail(Worker& _worker, const std::string& _error)
+    {
+        std::deque<unsigned> failed = _worker.requests;
+        int status = stop(_worker, false);
+        ++nFailures;
+        for (std::deque<unsigned>::reverse_iterator it = failed.rbegin(); it != failed.rend(); ++it)
+        {
+            if (++requests[*it].attempts > maxRetries)
+            {
+                for (unsigned w = 0; w < workers.size(); ++w)
+                    stop(workers[w], false);
+                std::ostringstream what;
+                what << cmd << " (the worker " << _error << ")";
+                throw eoSystemError(what.str(), WIFEXITED(status) ? WEXITSTATUS(status) : status);
+            }
+            pending.push_front(*it);
+        }
+    }
+
+    /// appends the request to the ones written to the worker
+    void give(Worker& _worker, unsigned _request, const eoPop<EOT>& _offspring)
+    {
+        pending.pop_front();
+        const Request& request = requests[_request];
+        std::ostringstream os;
+        os.precision(std::numeric_limits<double>::max_digits10);
+        os << request.id << " " << request.individuals.size() << "\n";
+        for (unsigned i = 0; i < request.individuals.size(); ++i)
+            os << _offspring[request.individuals[i]] << "\n";
+
+        if (_worker.requests.empty())
+            _worker.since = Clock::now();
+        _worker.requests.push_back(_request);
+        _worker.out += os.str();
+        flush(_worker);
+    }
+
+    /// writes what the socket accepts, false if the worker is gone
+    bool flush(Worker& _worker)
+    {
+        while (!_worker.out.empty())
+        {
+#ifdef MSG_NOSIGNAL
+            ssize_t n = ::send(_worker.fd, _worker.out.data(), _worker.out.size(), MSG_NOSIGNAL);
+#else
+            ssize_t n = ::send(_worker.fd, _worker.out.data(), _worker.out.size(), 0);
+#endif
+            if (n < 0)
+                return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+            _worker.out.erase(0, n);
+        }
+        return true;
+    }
+
+    /// reads and parses the responses of the worker, returns the error if any
+    std::string receive(Worker& _worker, eoPop<EOT>& _offspring, unsigned& _answered)
+    {
+        char buffer[65536];
+        ssize_t n;
+        while ((n = ::read(_worker.fd, buffer, sizeof(buffer))) > 0)
+            _worker.in.append(buffer, n);
+        // a worker exiting without reading all its requests resets the connection
+        if (n < 0 && errno == ECONNRESET)
+            n = 0;
+        else if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            return "cannot be read from";
+
+        size_t begin = 0;
+        for (;;)
+        {
+            // a response is complete once its header and all its lines are read
+            size_t end = _worker.in.find('\n', begin);
+            if (end == std::string::npos)
+                break;
+            std::istringstream header(_worker.in.substr(begin, end - begin));
+            unsigned long id;
+            size_t count;
+            if (!(header >> id >> count))
+                return "answered a malformed header";
+            std::deque<unsigned>::iterator it = _worker.requests.begin();
+            while (it != _worker.requests.end() && requests[*it].id != id)
+                ++it;
+            if (it == _worker.requests.end() || requests[*it].individuals.size() != count)
+                return "answered an unknown request";
+
+            std::vector<size_t> lines(1, end + 1);
+            for (size_t i = 0; i < count && lines.back() <= _worker.in.size(); ++i)
+            {
+                size_t next = _worker.in.find('\n', lines.back());
+                lines.push_back(next == std::string::npos ? _worker.in.size() + 1 : next + 1);
+            }
+            if (lines.back() > _worker.in.size())
+                break;
+
+            const Request& request = requests[*it];
+            for (size_t i = 0; i < count; ++i)
+            {
+                std::istringstream is(_worker.in.substr(lines[i], lines[i + 1] - lines[i] - 1));
+                Fitness fitness;
+                if (!(is >> fitness))
+                    return "answered a malformed fitness";
+                _offspring[request.individuals[i]].fitness(fitness);
+            }
+            _worker.requests.erase(it);
+            _worker.since = Clock::now();
+            ++_answered;
+            begin = lines.back();
+        }
+        _worker.in.erase(0, begin);
+
+        if (n == 0)
+            return "exited";
+        return "";
+    }
+
+    /// the milliseconds to wait for the workers, until the first timeout
+    int waitTime() const
+    {
+        if (timeout <= 0)
+            return -1;
+        double wait = timeout;
+        for (unsigned w = 0; w < workers.size(); ++w)
+            if (!workers[w].requests.empty())
+                wait = std::min(wait, timeout - seconds(workers[w].since));
+        return std::max(0, int(wait * 1000) + 1);
+    }
+
+    static double seconds(Clock::time_point _since)
+    {
+        return std::chrono::duration<double>(Clock::now() - _since).count();
+    }
+
+    void systemError(const std::string& _call)
+    {
+        int error = errno;
+        throw eoSystemError(_call + " for " + cmd, error);
+    }
+
+    // the pool holds processes, it cannot be copied
+    eoEvalProcessPool(const eoEvalProcessPool&);
+    eoEvalProcessPool& operator=(const eoEvalProcessPool&);
+
+    const std::string cmd;
+    std::vector<Worker> workers;
+    const unsigned batchSize;
+    const unsigned inFlight;
+    const double timeout;
+    const unsigned maxRetries;
+
+    std::vector<Request> requests;
+    std::deque<unsigned> pending;
+    unsigned long nextId;
+    unsigned long nFailures;
+};
+
+#endif // eoEvalProcessPool_h
@@ -47,6 +47,12 @@ protected:
 
     double _offsprings_size;
 
+    // Buffers reused across generations.
+    eoPop<EOT> _offsprings;
+    eoPop<EOT> _crossed;
+    eoPop<EOT> _pair;
+    std::vector<size_t> _crossed_slots;
+
 public:
 
     eoFastGA(
@@ -92,66 +98,95 @@ public:
         }
 
         do {
-            eoPop<EOT> offsprings;
-
-            for(size_t i=0; i < _offsprings_size; ++i) {
-                // eo::log << eo::xdebug << "\tOffspring #" << i << std::endl;
-
+            // Offsprings are generated in several passes, so that the
+            // solutions are evaluated by batches with the eoPopEvalFunc:
+            // 1. draw the variation of each offspring, do all crossovers,
+            //    and all mutations of the solutions which are not crossed,
+            // 2. evaluate all crossed pairs at once,
+            // 3. select one solution in each pair, and mutate it,
+            // 4. evaluate all offsprings at once.
+            // Buffers are kept across generations, so that
+            // the solutions' memory is reused.
+            const size_t offsprings_size = static_cast<size_t>(_offsprings_size);
+            _offsprings.resize(offsprings_size);
+            _crossed_slots.clear();
+
+            bool setup_cross = false;
+            bool setup_mut = false;
+
+            for(size_t i=0; i < offsprings_size; ++i) {
                 if(eo::rng.flip(_rate_crossover)) {
-                    // eo::log << eo::xdebug << "\t\tDo crossover" << std::endl;
                     // Manual setup of eoSelectOne
                     // (usually they are setup in a
                     // wrapping eoSelect).
-                    _select_cross.setup(pop);
-
-                    // Copy of const ref solutions,
-                    // because one alter them hereafter.
-                    EOT sol1 = _select_cross(pop);
-                    EOT sol2 = _select_cross(pop);
-
-                    // If the operator returns true,
-                    // solutions have been altered.
-                    if(_crossover(sol1, sol2)) {
-                        sol1.invalidate();
-                        sol2.invalidate();
+                    if(not setup_cross) {
+                        _select_cross.setup(pop);
+                        setup_cross = true;
                     }
+                    _crossed_slots.push_back(i);
 
-                    // Select one of the two solutions
-                    // which have been crossed.
-                    eoPop<EOT> crossed; 
-                    crossed.push_back(sol1);
-                    crossed.push_back(sol2);
-
-                    // The aftercross selector may need fitness,
-                    // so we evaluate those two solutions, if needed.
-                    _pop_eval(crossed,crossed);
-                    
-                    _select_aftercross.setup(crossed);
-                    EOT sol3 = _select_aftercross(crossed);
-
-                    // Additional mutation (X)OR the crossed/cloned solution.
-                    if(eo::rng.flip(_rate_mutation)) {
-                        // eo::log << eo::xdebug << "\t\tDo mutation" << std::endl;
-                        if(_mutation(sol3)) {
-                            sol3.invalidate();
-                        }
+                } else { // If not crossing, always mutate.
+                    if(not setup_mut) {
+                        _select_mut.setup(pop);
+                        setup_mut = true;
                     }
-                    offsprings.push_back(sol3);
+                    EOT& sol3 = _offsprings[i];
+                    sol3 = _select_mut(pop);
+                    if(_mutation(sol3)) {
+                        sol3.invalidate();
+                    }
+                }
+            }
 
-                } else { // If not crossing, always mutate.
-                    // eo::log << eo::xdebug << "\t\tNo crossover, do mutation" << std::endl;
-                    _select_mut.setup(pop);
-                    EOT sol3 = _select_mut(pop);
+            _crossed.resize(2 * _crossed_slots.size());
+            for(size_t k=0; k < _crossed_slots.size(); ++k) {
+                // Copy of const ref solutions,
+                // because one alter them hereafter.
+                EOT& sol1 = _crossed[2*k];
+                EOT& sol2 = _crossed[2*k+1];
+                sol1 = _select_cross(pop);
+                sol2 = _select_cross(pop);
+
+                // If the operator returns true,
+                // solutions have been altered.
+                if(_crossover(sol1, sol2)) {
+                    sol1.invalidate();
+                    sol2.invalidate();
+                }
+            }
+
+            // The aftercross selector may need fitness,
+            // so we evaluate all the crossed solutions, if needed.
+            if(not _crossed.empty()) {
+                _pop_eval(_crossed, _crossed);
+            }
+
+            _pair.resize(2);
+            for(size_t k=0; k < _crossed_slots.size(); ++k) {
+                // Select one of the two solutions
+                // which have been crossed.
+                std::swap(_pair[0], _crossed[2*k]);
+                std::swap(_pair[1], _crossed[2*k+1]);
+                _select_aftercross.setup(_pair);
+                EOT& sol3 = _offsprings[_crossed_slots[k]];
+                // The pair is a buffer: the selected solution
+                // is swapped with the slot instead of copied.
+                std::swap(sol3, _pair[_select_aftercross.index(_pair)]);
+
+                // Additional mutation (X)OR the crossed/cloned solution.
+                if(eo::rng.flip(_rate_mutation)) {
                     if(_mutation(sol3)) {
                         sol3.invalidate();
                     }
-                    offsprings.push_back(sol3);
                 }
+                // Give the memory back to the buffer.
+                std::swap(_pair[0], _crossed[2*k]);
+                std::swap(_pair[1], _crossed[2*k+1]);
             }
-            assert(offsprings.size() == _offsprings_size);
+            assert(_offsprings.size() == offsprings_size);
 
-            _pop_eval(pop, offsprings);
-            _replace(pop, offsprings);
+            _pop_eval(pop, _offsprings);
+            _replace(pop, _offsprings);
 
             // eo::log << eo::xdebug << "\tEnd of generation" << std::endl;
 
@@ -0,0 +1,232 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoFusedStandardVelocity.h
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef EOFUSEDSTANDARDVELOCITY_H
+#define EOFUSEDSTANDARDVELOCITY_H
+
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "eoStandardVelocity.h"
+#include "utils/eoParallel.h"
+//-----------------------------------------------------------------------------
+
+
+/** Standard velocity followed by the standard flight, in a single pass over each particle:
+*   v(t+1) = w * v(t) + c1 * r1 * ( xbest(t)-x(t) ) + c2 * r2 * ( lbest(t) - x(t) ), bounded by the velocity bounds,
+*   then x(t+1) = x(t) + v(t+1), bounded by the flight bounds, and the fitness is invalidated.
+*
+*   It gives the same particles as an eoStandardVelocity followed by an eoStandardFlight, and is meant to be used
+*   with the constructors of eoSyncEasyPSO and eoEasyPSO without flight. The bounds are expanded once per swarm into
+*   arrays (infinite when a dimension is not bounded), so that the loop over the dimensions has no branch and can be
+*   vectorized. When the whole swarm is moved (apply), the random factors are drawn first, in the order of the
+*   particles, and the particles are then moved in parallel if eo::parallel is enabled, which gives the same swarm
+*   whatever the number of threads. All the particles must have the same size.
+*
+*   @ingroup Variators
+*/
+template < class POT > class eoFusedStandardVelocity:public eoStandardVelocity < POT >
+{
+
+public:
+
+    typedef typename POT::ParticleVelocityType VelocityType;
+    typedef typename POT::AtomType PositionType;
+
+    /** Constructor with velocity and flight bounds
+    * @param _topology - The topology to get the global/local/other best
+    * @param _w - The weight factor.
+    * @param _c1 - Learning factor used for the particle's best. Type must be POT::ParticleVelocityType
+    * @param _c2 - Learning factor used for the local/global best(s). Type must be POT::ParticleVelocityType
+    * @param _bounds - An eoRealVectorBounds: real bounds for the velocities.
+    * @param _flightBounds - An eoRealVectorBounds: real bounds for the positions.
+    * @param _gen - The eo random generator, default=rng
+    */
+    eoFusedStandardVelocity (eoTopology < POT > & _topology,
+                             const VelocityType & _w,
+                             const VelocityType & _c1,
+                             const VelocityType & _c2,
+                             eoRealVectorBounds & _bounds,
+                             eoRealVectorBounds & _flightBounds,
+                             eoRng & _gen = rng):
+            eoStandardVelocity < POT > (_topology, _w, _c1, _c2, _bounds, _gen),
+            noBounds(0),
+            flightBounds(_flightBounds){}
+
+
+    /** Constructor with velocity bounds and a free flight
+    * @param _topology - The topology to get the global/local/other best
+    * @param _w - The weight factor.
+    * @param _c1 - Learning factor used for the particle's best. Type must be POT::ParticleVelocityType
+    * @param _c2 - Learning factor used for the local/global best(s). Type must be POT::ParticleVelocityType
+    * @param _bounds - An eoRealVectorBounds: real bounds for the velocities.
+    * @param _gen - The eo random generator, default=rng
+    */
+    eoFusedStandardVelocity (eoTopology < POT > & _topology,
+                             const VelocityType & _w,
+                             const VelocityType & _c1,
+                             const VelocityType & _c2,
+                             eoRealVectorBounds & _bounds,
+                             eoRng & _gen = rng):
+            eoStandardVelocity < POT > (_topology, _w, _c1, _c2, _bounds, _gen),
+            noBounds(0),
+            flightBounds(noBounds){}
+
+
+    /** Constructor with free velocities and a free flight
+    * @param _topology - The topology to get the global/local/other best
+    * @param _w - The weight factor.
+    * @param _c1 - Learning factor used for the particle's best. Type must be POT::ParticleVelocityType
+    * @param _c2 - Learning factor used for the local/global best(s). Type must be POT::ParticleVelocityType
+    * @param _gen - The eo random generator, default=rng
+    */
+    eoFusedStandardVelocity (eoTopology < POT > & _topology,
+                             const VelocityType & _w,
+                             const VelocityType & _c1,
+                             const VelocityType & _c2,
+                             eoRng & _gen = rng):
+            eoStandardVelocity < POT > (_topology, _w, _c1, _c2, _gen),
+            noBounds(0),
+            flightBounds(noBounds){}
+
+
+    /**
+     * Moves the given particle. Need an indice to identify the particle into the topology.
+     * @param _po - A particle
+     * @param _indice - The indice (into the topology) of the given particle
+     */
+    void operator  () (POT & _po,unsigned _indice)
+    {
+        VelocityType r1 = (VelocityType) gen.uniform (1) * c1;
+        VelocityType r2 = (VelocityType) gen.uniform (1) * c2;
+        expandBounds(_po.size());
+        move(_po, topology.best(_indice), r1, r2);
+    }
+
+
+    /**
+     * Moves all the particles of the swarm.
+     * @param _pop - The swarm
+     */
+    virtual void apply (eoPop < POT > &_pop)
+    {
+        const int size = _pop.size();
+        if (size == 0)
+            return;
+
+        // the random factors and the bests, in the order of the particles
+        factors.resize(2 * size);
+        bests.resize(size);
+        for (int i = 0; i < size; i++)
+        {
+            factors[2 * i] = (VelocityType) gen.uniform (1) * c1;
+            factors[2 * i + 1] = (VelocityType) gen.uniform (1) * c2;
+            bests[i] = & topology.best(i);
+        }
+        expandBounds(_pop[0].size());
+
+#ifdef _OPENMP
+#pragma omp parallel for if(eo::parallel.isEnabled())
+#endif
+        for (int i = 0; i < size; i++)
+        {
+            move(_pop[i], *bests[i], factors[2 * i], factors[2 * i + 1]);
+        }
+    }
+
+protected:
+
+    using eoStandardVelocity < POT >::topology;
+    using eoStandardVelocity < POT >::omega;
+    using eoStandardVelocity < POT >::c1;
+    using eoStandardVelocity < POT >::c2;
+    using eoStandardVelocity < POT >::bounds;
+    using eoStandardVelocity < POT >::gen;
+
+    /**
+     * Fills the arrays of bounds for particles of size _size.
+     */
+    void expandBounds(unsigned _size)
+    {
+        // need to resize the bounds even if there are dummy because of "isBounded" call
+        bounds.adjust_size(_size);
+        flightBounds.adjust_size(_size);
+        const double inf = std::numeric_limits<double>::infinity();
+        velocityMin.resize(_size);
+        velocityMax.resize(_size);
+        positionMin.resize(_size);
+        positionMax.resize(_size);
+        for (unsigned j = 0; j < _size; j++)
+        {
+            velocityMin[j] = bounds.isMinBounded(j) ? bounds.minimum(j) : -inf;
+            velocityMax[j] = bounds.isMaxBounded(j) ? bounds.maximum(j) : inf;
+            positionMin[j] = flightBounds.isMinBounded(j) ? flightBounds.minimum(j) : -inf;
+            positionMax[j] = flightBounds.isMaxBounded(j) ? flightBounds.maximum(j) : inf;
+        }
+    }
+
+    /**
+     * Updates the velocities, then the positions, of _po.
+     */
+    void move(POT & _po, const POT & _best, VelocityType _r1, VelocityType _r2)
+    {
+        const unsigned size = _po.size();
+        if (size == 0)
+            return;
+        PositionType * x = & _po[0];
+        VelocityType * v = & _po.velocities[0];
+        const PositionType * xbest = & _po.bestPositions[0];
+        const PositionType * lbest = & _best[0];
+        const double * vmin = & velocityMin[0];
+        const double * vmax = & velocityMax[0];
+        const double * xmin = & positionMin[0];
+        const double * xmax = & positionMax[0];
+        const VelocityType w = omega;
+
+        for (unsigned j = 0; j < size; j++)
+        {
+            VelocityType newVelocity = w * v[j] + _r1 * (xbest[j] - x[j]) + _r2 * (lbest[j] - x[j]);
+            newVelocity = std::min(std::max(newVelocity, vmin[j]), vmax[j]);
+            v[j] = newVelocity;
+
+            PositionType newPosition = x[j] + newVelocity;
+            newPosition = std::min(std::max(newPosition, xmin[j]), xmax[j]);
+            x[j] = newPosition;
+        }
+        // invalidate the fitness because the positions have changed
+        _po.invalidate();
+    }
+
+    // If no flight bounds are given, use the dummy instance
+    eoRealVectorNoBounds noBounds;
+    eoRealVectorBounds & flightBounds;
+
+    // the bounds of every dimension
+    std::vector < double > velocityMin, velocityMax, positionMin, positionMax;
+    // the random factors of the particles
+    std::vector < VelocityType > factors;
+    // the best of the neighborhood of every particle
+    std::vector < const POT * > bests;
+};
+
+
+#endif /*EOFUSEDSTANDARDVELOCITY_H */
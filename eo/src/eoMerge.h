@@ -28,12 +28,14 @@
 
 //-----------------------------------------------------------------------------
 
+#include <iterator>
 #include <stdexcept>
 
 // EO includes
 #include "eoPop.h"     // eoPop
 #include "eoFunctor.h"  // eoMerge
 #include "utils/eoLogger.h"
+#include "utils/eoProfiler.h"
 
 /**
  * eoMerge: Base class for elitist replacement algorithms.
@@ -50,7 +52,17 @@
 */
 
 template<class Chrom> class eoMerge: public eoBF<const eoPop<Chrom>&, eoPop<Chrom>&, void>
-{};
+{
+public :
+  /** Merges as operator() does, but may move the individuals out of the old
+   * population instead of copying them, when it is not used anymore afterwards
+   * (as in eoMergeReduce). The default copies.
+   */
+  virtual void move(eoPop<Chrom>& _pop, eoPop<Chrom>& _offspring)
+  {
+    (*this)(_pop, _offspring);
+  }
+};
 
 /**
 Straightforward elitism class, specify the number of individuals to copy
@@ -96,12 +108,36 @@ public :
     std::vector<const EOT*> result;
     _pop.nth_element(combienLocal, result);
 
+    EO_PROFILE_COUNT("copies", result.size());
     for (size_t i = 0; i < result.size(); ++i)
       {
         _offspring.push_back(*result[i]);
       }
   }
 
+  /// Moves the elite, in the same order as operator()
+  void move(eoPop<EOT>& _pop, eoPop<EOT>& _offspring)
+  {
+    if ((combien == 0) && (rate == 0.0))
+      return;
+    unsigned combienLocal;
+    if (combien == 0)      // rate is specified
+      combienLocal = (unsigned int) (rate * _pop.size());
+    else
+      combienLocal = combien;
+
+    if (combienLocal > _pop.size())
+      throw eoException("Elite larger than population");
+
+    std::vector<const EOT*> result;
+    _pop.nth_element(combienLocal, result);
+
+    for (size_t i = 0; i < result.size(); ++i)
+      {
+        _offspring.push_back(std::move(_pop[result[i] - &_pop[0]]));
+      }
+  }
+
 private :
   double rate;
   unsigned combien;
@@ -126,6 +162,8 @@ template <class EOT> class eoPlus : public eoMerge<EOT>
     public :
         void operator()(const eoPop<EOT>& _pop, eoPop<EOT>& _offspring)
         {
+            EO_PROFILE_COUNT("allocations", _offspring.capacity() < _offspring.size() + _pop.size() ? 1 : 0);
+            EO_PROFILE_COUNT("copies", _pop.size());
             _offspring.reserve(_offspring.size() + _pop.size());
 
             for (size_t i = 0; i < _pop.size(); ++i)
@@ -134,6 +172,13 @@ template <class EOT> class eoPlus : public eoMerge<EOT>
             }
         }
 
+        void move(eoPop<EOT>& _pop, eoPop<EOT>& _offspring)
+        {
+            _offspring.insert(_offspring.end(),
+                              std::make_move_iterator(_pop.begin()),
+                              std::make_move_iterator(_pop.end()));
+        }
+
     private :
 };
 
@@ -57,7 +57,7 @@ class eoMergeReduce : public eoReplacement<EOT>
 
         virtual void operator()(eoPop<EOT>& _parents, eoPop<EOT>& _offspring)
         {
-            merge(_parents, _offspring); // parents untouched, result in offspring
+            merge.move(_parents, _offspring); // parents moved, result in offspring
             reduce(_offspring, _parents.size());
             _parents.swap(_offspring);
         }
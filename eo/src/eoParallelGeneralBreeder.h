@@ -0,0 +1,156 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoParallelGeneralBreeder.h
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoParallelGeneralBreeder_h
+#define eoParallelGeneralBreeder_h
+
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "eoGeneralBreeder.h"
+#include "utils/eoParallel.h"
+#include "utils/eoRNG.h"
+#include "utils/eoRngStream.h"
+
+/**
+  General breeder which builds the offspring by slices, in parallel.
+
+  The offspring are split in slices of a fixed size. Every slice is filled as
+  eoGeneralBreeder does, by applying the general operator on a selective populator,
+  with its own random number stream: an eoRngStream, whose seed is drawn from the
+  global rng once per generation, and whose id is the index of the slice, is bound
+  to the thread during the breeding of the slice (see eoRngStreamScope), so that the
+  selector and the operators, which draw on the global rng, need no change. The
+  slices are bred in parallel if eo::parallel is enabled, and concatenated in order.
+
+  The offspring hence only depend on the seed of the global rng, and neither on the
+  number of threads, nor on their scheduling. They differ from those of an
+  eoGeneralBreeder, since the numbers are drawn from other streams.
+
+  The selector is set up once on the parents, then shared by the threads: its
+  operator() must be reentrant, which is the case of the stochastic selectors
+  (tournaments, roulette wheel...), but not of the sequential ones. The same holds
+  for the operators, which must not modify a state of their own while they are applied.
+
+  @ingroup Combination
+*/
+template<class EOT>
+class eoParallelGeneralBreeder: public eoGeneralBreeder<EOT>
+{
+ public:
+  /** Ctor:
+   *
+   * @param _select a selectoOne, to be used for all selections
+   * @param _op a general operator (will generally be an eoOpContainer)
+   * @param _rate               pour howMany, le nbre d'enfants a generer
+   * @param _interpret_as_rate  <a href="../../tutorial/html/eoEngine.html#howmany">explanation</a>
+   * @param _sliceSize the number of offspring of a slice
+   */
+  eoParallelGeneralBreeder(
+          eoSelectOne<EOT>& _select,
+          eoGenOp<EOT>& _op,
+          double  _rate=1.0,
+          bool _interpret_as_rate = true,
+          unsigned _sliceSize = 8) :
+      eoGeneralBreeder<EOT>(_select, _op, _rate, _interpret_as_rate),
+      sliceSize(std::max(_sliceSize, 1u))
+    {}
+
+  /** Ctor:
+   *
+   * @param _select a selectoOne, to be used for all selections
+   * @param _op a general operator (will generally be an eoOpContainer)
+   * @param _howMany an eoHowMany <a href="../../tutorial/html/eoEngine.html#howmany">explanation</a>
+   * @param _sliceSize the number of offspring of a slice
+   */
+  eoParallelGeneralBreeder(
+          eoSelectOne<EOT>& _select,
+          eoGenOp<EOT>& _op,
+          eoHowMany& _howMany,
+          unsigned _sliceSize = 8) :
+      eoGeneralBreeder<EOT>(_select, _op, _howMany),
+      sliceSize(std::max(_sliceSize, 1u))
+    {}
+
+  /** The breeder: calls the genOp on a selective populator for every slice
+   *
+   * @param _parents the initial population
+   * @param _offspring the resulting population (content -if any- is lost)
+   */
+  void operator()(const eoPop<EOT>& _parents, eoPop<EOT>& _offspring)
+    {
+      unsigned target = howMany(_parents.size());
+      unsigned nSlices = (target + sliceSize - 1) / sliceSize;
+      const uint64_t seed = eo::streamSeed();
+
+      select.setup(_parents);
+      slices.resize(nSlices);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(eo::parallel.isEnabled())
+#endif
+      for (int s = 0; s < (int) nSlices; ++s)
+        {
+          eoRngStream stream(seed, s);
+          eoRngStreamScope scope(stream);
+
+          unsigned sliceTarget = std::min(sliceSize, target - s * sliceSize);
+          eoPop<EOT>& slice = slices[s];
+          slice.clear();
+          eoSelectivePopulator<EOT> it(_parents, slice, select, false);
+
+          while (slice.size() < sliceTarget)
+            {
+              op(it);
+              ++it;
+            }
+
+          slice.resize(sliceTarget);   // you might have generated a few more
+        }
+
+      _offspring.clear();
+      _offspring.reserve(target);
+      for (unsigned s = 0; s < nSlices; ++s)
+        {
+          _offspring.insert(_offspring.end(),
+                            std::make_move_iterator(slices[s].begin()),
+                            std::make_move_iterator(slices[s].end()));
+          slices[s].clear();
+        }
+    }
+
+  /// The class name.
+  virtual std::string className() const { return "eoParallelGeneralBreeder"; }
+
+ protected:
+  using eoGeneralBreeder<EOT>::select;
+  using eoGeneralBreeder<EOT>::op;
+  using eoGeneralBreeder<EOT>::howMany;
+
+  unsigned sliceSize;
+  /** the offspring of every slice, kept from one generation to the next */
+  std::vector< eoPop<EOT> > slices;
+};
+
+#endif
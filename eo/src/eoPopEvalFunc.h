@@ -101,6 +101,9 @@ private:
  * The eoEvalFunc is no more directly given, but it is stored in the eo::mpi::ParallelApplyStore, which can be
  * instanciated if no one is given at construction.
  *
+ * As the evaluation only changes the fitness, the evaluators only send back the fitnesses of the individuals when
+ * these are sent in the binary format (see eoMpiWire.h). This is set on the store, even if it is given by the user.
+ *
  * The use of this class requires the user to have called the eo::mpi::Node::init function, at the beginning of its
  * program.
  *
@@ -138,6 +141,7 @@ class eoParallelPopLoopEval : public eoPopEvalFunc<EOT>
             needToDeleteStore( true ) // we used new, we'll have to use delete (RAII)
         {
             store = new eo::mpi::ParallelApplyStore<EOT>( _eval, _masterRank, _packetSize );
+            store->data()->resultsOnly = true;
         }
 
         /**
@@ -161,7 +165,7 @@ class eoParallelPopLoopEval : public eoPopEvalFunc<EOT>
             store( _store ),
             needToDeleteStore( false ) // we haven't used new for creating store, we don't care if we have to delete it (RAII).
         {
-            // empty
+            store->data()->resultsOnly = true;
         }
 
         /**
@@ -28,6 +28,7 @@
 
 #include "eoPop.h"
 #include "eoSelectOne.h"
+#include "utils/eoProfiler.h"
 
 /** eoPopulator is a helper class for general operators eoGenOp
     It is an eoPop but also behaves like an eoPop::iterator
@@ -87,6 +88,8 @@ public :
    */
   void insert(const EOT& _eo)
   { /* not really efficient, but its nice to have */
+    EO_PROFILE_COUNT("allocations", dest.size() == dest.capacity() ? 1 : 0);
+    EO_PROFILE_COUNT("copies", 1);
     current = dest.insert(current, _eo);
   }
 
@@ -97,6 +100,7 @@ public :
     size_t sz = current - dest.begin();
     if (dest.capacity() < dest.size() + how_many)
     {
+      EO_PROFILE_COUNT("allocations", 1);
       dest.reserve(dest.size() + how_many);
     }
 
@@ -137,6 +141,8 @@ private:
   void get_next() {
     if(current == dest.end())
       { // get new individual from derived class select()
+        EO_PROFILE_COUNT("allocations", dest.size() == dest.capacity() ? 1 : 0);
+        EO_PROFILE_COUNT("copies", 1);
         dest.push_back(select());
         current = dest.end();
         --current;
@@ -193,9 +199,15 @@ public :
 
     using eoPopulator< EOT >::src;
 
-    eoSelectivePopulator(const eoPop<EOT>& _pop, eoPop<EOT>& _dest, eoSelectOne<EOT>& _sel)
+    /** Ctor
+     * @param _pop the source population
+     * @param _dest the offspring
+     * @param _sel the selector
+     * @param _setup whether the selector must be set up on the source, false if it already is
+     */
+    eoSelectivePopulator(const eoPop<EOT>& _pop, eoPop<EOT>& _dest, eoSelectOne<EOT>& _sel, bool _setup = true)
         : eoPopulator<EOT>(_pop, _dest), sel(_sel)
-        { sel.setup(_pop); };
+        { if (_setup) sel.setup(_pop); };
 
     /** the select method actually selects one guy from the src pop */
     const EOT& select() {
@@ -155,14 +155,13 @@ public:
 
         for (j=0; j<_newsize; j++)
 	    {
-		tmPop.push_back(*scores[j].second);
+		tmPop.push_back(std::move(*scores[j].second));
 	    }
 
         _newgen.swap(tmPop);
 
-        // erase does not work, but I'm sure there is a way in STL to mark
-        // and later delete all inside a std::vector ??????
-        // this would avoid all copies here
+        // the survivors are moved, the others are discarded with tmPop
+        // at the next call
 
 	//      it = scores.begin() + _newsize;
 	//      while (it < scores.end())
@@ -69,11 +69,9 @@ public :
 
   void operator()(eoPop<EOT>& _pop)
   {
-    eoPop<EOT> offspring;
-
     do
       {
-        select(_pop, offspring);
+        selectOffspring(_pop);
 
         unsigned i;
 
@@ -114,8 +112,39 @@ private :
   // eoInvalidateQuadOp invalidates the embedded operator
   eoInvalidateQuadOp<EOT> cross;
   float crossoverRate;
-  eoSelectPerc<EOT> select;
+  eoSelectOne<EOT>& select;
   eoEvalFunc<EOT>& eval;
+
+  /** Selects as many offspring as parents, by their indices: a parent is swapped
+   * with the last offspring which selects it, and copied into the others, so
+   * that the memory of the individuals is reused from one generation to the next.
+   * The random numbers drawn are those of an eoSelectPerc.
+   */
+  void selectOffspring(eoPop<EOT>& _pop)
+  {
+    select.setup(_pop);
+    indices.resize(_pop.size());
+    for (unsigned i = 0; i < indices.size(); i++)
+      indices[i] = select.index(_pop);
+
+    lastUse.assign(_pop.size(), indices.size());
+    for (unsigned i = 0; i < indices.size(); i++)
+      lastUse[indices[i]] = i;
+
+    offspring.resize(indices.size());
+    for (unsigned i = 0; i < indices.size(); i++)
+      {
+        if (lastUse[indices[i]] == i)
+          std::swap(offspring[i], _pop[indices[i]]);
+        else
+          offspring[i] = _pop[indices[i]];
+      }
+  }
+
+  /// the offspring, kept to reuse the memory of the individuals
+  eoPop<EOT> offspring;
+  std::vector<size_t> indices;
+  std::vector<size_t> lastUse;
 };
 
 #endif
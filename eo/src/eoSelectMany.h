@@ -31,6 +31,7 @@
 //-----------------------------------------------------------------------------
 #include "eoSelect.h"
 #include "eoSelectOne.h"
+#include "utils/eoProfiler.h"
 #include "utils/eoHowMany.h"
 #include <math.h>
 //-----------------------------------------------------------------------------
@@ -66,6 +67,8 @@ class eoSelectMany : public eoSelect<EOT>
   {
     unsigned target = howMany(_source.size());
 
+    EO_PROFILE_COUNT("allocations", _dest.capacity() < target ? 1 : 0);
+    EO_PROFILE_COUNT("copies", target);
     _dest.resize(target);
 
     select.setup(_source);
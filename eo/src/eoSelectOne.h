@@ -27,8 +27,11 @@
 
 
 //-----------------------------------------------------------------------------
+#include <functional>
+
 #include "eoPop.h"
 #include "eoFunctor.h"
+#include "eoExceptions.h"
 //-----------------------------------------------------------------------------
 
 /** eoSelectOne selects only one element from a whole population.
@@ -52,6 +55,22 @@ class eoSelectOne : public eoUF<const eoPop<EOT>&, const EOT&>
       {
           (void)_pop;
       }
+
+      /** Selects one individual and returns its index in the population, so that
+          it can be moved or swapped instead of copied (see eoSGA).
+
+          The default finds the index from the address of the individual returned by
+          operator(), which must thus be an element of the population: the random
+          numbers drawn are the same as with operator().
+      */
+      virtual size_t index(const eoPop<EOT>& _pop)
+      {
+          const EOT* selected = &(*this)(_pop);
+          std::less<const EOT*> before;
+          if (_pop.empty() || before(selected, &_pop.front()) || before(&_pop.back(), selected))
+              throw eoException("eoSelectOne::index: the selected individual is not in the population");
+          return selected - &_pop.front();
+      }
 };
 /** @example t-selectOne.cpp
  */
@@ -29,6 +29,7 @@
 //-----------------------------------------------------------------------------
 #include "eoSelect.h"
 #include "eoSelectOne.h"
+#include "utils/eoProfiler.h"
 #include <math.h>
 //-----------------------------------------------------------------------------
 
@@ -58,6 +59,8 @@ class eoSelectPerc : public eoSelect<EOT>
   {
     size_t target = static_cast<size_t>(floor(rate * _source.size()));
 
+    EO_PROFILE_COUNT("allocations", _dest.capacity() < target ? 1 : 0);
+    EO_PROFILE_COUNT("copies", target);
     _dest.resize(target);
 
     select.setup(_source);
@@ -119,6 +119,11 @@ public:
         return neighborhood.best();
     }
 
+    virtual POT & globalBest()
+    {
+        return neighborhood.best();
+    }
+
 
    /**
      * Print the structure of the topology on the standard output.
@@ -96,9 +96,9 @@ public:
         if (nbSurvive)
             {
                 _pop.nth_element(nbSurvive);
-                // copy best
+                // move best
                 _luckyGuys.resize(nbSurvive);
-                std::copy(_pop.begin(), _pop.begin()+nbSurvive, _luckyGuys.begin());
+                std::move(_pop.begin(), _pop.begin()+nbSurvive, _luckyGuys.begin());
                 // erase them from pop
                 _pop.erase(_pop.begin(), _pop.begin()+nbSurvive);
             }
@@ -171,11 +171,11 @@ public:
         if (survivorSize > pSize)
             throw eoPopSizeChangeException(survivorSize, pSize, "more survivors than parents!");
 
-        plus(_parents, _offspring); // all that remain in _offspring
+        plus.move(_parents, _offspring); // all that remain in _offspring
 
         reduceGlobal(_offspring, pSize - survivorSize);
-        plus(luckyParents, _offspring);
-        plus(luckyOffspring, _offspring);
+        plus.move(luckyParents, _offspring);
+        plus.move(luckyOffspring, _offspring);
 
         _parents.swap(_offspring);
 
@@ -151,6 +151,38 @@ CMAParams::CMAParams(eoParser& parser, unsigned dimensionality) {
               * (1+2*std::max(0.,sqrt((mueff-1.)/(n+1.))-1)) /* limit sigma increase */
                     / ccumsig;
 
+    /* handle the covariance model */
+    int variant_type = parser.createParam(
+            0,
+            "cma-variant",
+            "Covariance model: 0 = full, 1 = separable (diagonal, O(N) per sample), 2 = limited memory (O(N*memory) per sample)",
+            0,
+            section).value();
+
+    variant = (variant_type == 1) ? separable : (variant_type == 2) ? limited_memory : full;
+
+    eigenInterval = parser.createParam(
+            0u,
+            "eigen-interval",
+            "Generations between two eigen decompositions of the covariance matrix (0 = automatic)",
+            0,
+            section).value();
+
+    if (eigenInterval == 0) {
+        eigenInterval = defaultEigenInterval();
+    }
+
+    memory = parser.createParam(
+            memory,
+            "memory",
+            "Number of direction vectors stored by the limited memory model (0 = automatic)",
+            0,
+            section).value();
+
+    if (memory == 0) {
+        memory = 4 + (unsigned)(3*log((double) n));
+    }
+
     vector<double> mins(1,0.0);
     mins = parser.createParam(
             mins,
@@ -206,7 +238,7 @@ void CMAParams::defaults(unsigned n_, unsigned maxgen_) {
     weights /= sumw;
 
     mucov = mueff;
-    ccumsig *= (mueff + 2.) / (n + mueff + 3.);
+    ccumsig = (mueff + 2.) / (n + mueff + 3.);
     ccumcov = 4. / (n + 4);
 
     double t1 = 2. / ((n+1.4142)*(n+1.4142));
@@ -226,7 +258,16 @@ void CMAParams::defaults(unsigned n_, unsigned maxgen_) {
     initialStdevs.resize(n);
     initialStdevs = 0.3;
 
+    variant = full;
+    eigenInterval = defaultEigenInterval();
+    memory = 4 + (unsigned)(3*log((double) n));
+}
 
+unsigned CMAParams::defaultEigenInterval() const {
+    /* As in the reference CMA-ES: C is decomposed every lambda/(ccov*N*10) evaluations,
+     * so that the cost of the decomposition is amortized over a few generations */
+    double interval = 1. / (ccov * n * 10.);
+    return interval < 1. ? 1 : (unsigned) interval;
 }
 
 
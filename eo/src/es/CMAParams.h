@@ -21,11 +21,16 @@ class CMAParams {
 
     public:
 
-    CMAParams() { /* Call this and all values need to be set by hand */ }
+    /* Covariance models: full matrix, diagonal one (sep-CMA-ES) or limited memory one (LM-CMA-ES) */
+    enum Variant { full = 0, separable = 1, limited_memory = 2 };
+
+    CMAParams() : variant(full), eigenInterval(1), memory(0) { /* Call this and all values need to be set by hand */ }
     CMAParams(eoParser& parser, unsigned dimensionality = 0); // 0 dimensionality -> user needs to set it
 
     void defaults(unsigned n_, unsigned maxgen_); /* apply all defaults using n and maxgen */
 
+    unsigned defaultEigenInterval() const; /* <- ccov, N */
+
     unsigned n;
     unsigned maxgen;
 
@@ -44,6 +49,10 @@ class CMAParams {
 
     std::valarray<double> minStdevs;     /* Minimum standard deviations per coordinate (default = 0.0) */
     std::valarray<double> initialStdevs; /* Initial standard deviations per coordinate (default = 0.3) */
+
+    Variant variant;          /* Covariance model (default = full) */
+    unsigned eigenInterval;   /* Generations between two eigen decompositions of a full C, <- ccov, N */
+    unsigned memory;          /* Number of direction vectors of the limited memory model, <- N */
 };
 
 } // namespace eo
@@ -52,6 +52,7 @@
  *                               */
 
 #include <valarray>
+#include <algorithm>
 #include <limits>
 #include <iostream>
 #include <cassert>
@@ -70,9 +71,10 @@ struct CMAStateImpl {
 
     CMAParams p;
 
-    lower_triangular_matrix	C; // Covariance matrix
-    square_matrix		B; // Eigen vectors (in columns)
-    valarray<double>		d; // eigen values (diagonal matrix)
+    lower_triangular_matrix	C; // Covariance matrix (full model only)
+    square_matrix		B; // Eigen vectors (in columns, full model only)
+    valarray<double>		d; // eigen values (diagonal matrix), or scaling of the axes
+    valarray<double>		diagC; // Covariance matrix (separable model only)
     valarray<double>		pc; // Evolution path
     valarray<double>		ps; // Evolution path for stepsize;
 
@@ -80,31 +82,119 @@ struct CMAStateImpl {
     double			sigma; // global step size
 
     unsigned			gen;
+    unsigned			genOfEigenUpdate;
     vector<double>		fitnessHistory;
 
+    /* Limited memory model (Loshchilov, 2014): C = D A A^T D, where the Cholesky
+     * factor A is never stored but given by m rank one updates of the identity,
+     * A_{t+1} = a A_t + b_t p_t v_t^T, with v_t = A_t^{-1} p_t */
+    vector< valarray<double> >	lmP; // stored evolution paths, oldest first
+    vector< valarray<double> >	lmV; // A_t^{-1} p_t
+    vector<double>		lmB; // coefficients of A
+    vector<double>		lmD; // coefficients of A^{-1}
+    double			lmA; // sqrt(1-c1)
+    double			lmC1; // learning rate of the rank one updates
+
 
     CMAStateImpl(const CMAParams& params_, const vector<double>& m, double sigma_) :
         p(params_),
-        C(p.n), B(p.n), d(p.n), pc(p.n), ps(p.n), mean(m), sigma(sigma_),
-        gen(0), fitnessHistory(3)
+        C(p.variant == CMAParams::full ? p.n : 0), B(p.variant == CMAParams::full ? p.n : 0),
+        d(p.n), pc(p.n), ps(p.n), mean(m), sigma(sigma_),
+        gen(0), genOfEigenUpdate(0), fitnessHistory(3)
     {
         double trace = (p.initialStdevs * p.initialStdevs).sum();
         /* Initialize covariance structure */
         for (unsigned i = 0; i < p.n; ++i)
         {
-            B[i][i] = 1.;
             d[i] = p.initialStdevs[i] * sqrt(p.n / trace);
-            C[i][i] = d[i] * d[i];
+            if (p.variant == CMAParams::full) {
+                B[i][i] = 1.;
+                C[i][i] = d[i] * d[i];
+            }
             pc[i] = 0.;
             ps[i] = 0.;
         }
 
+        if (p.variant == CMAParams::separable) {
+            diagC.resize(p.n);
+            diagC = d * d;
+        }
+
+        lmC1 = 1. / (10. * log(p.n + 1.));
+        lmA = sqrt(1. - lmC1);
+    }
+
+    /* x = A z, in O(N m) */
+    void lmTransform(valarray<double>& x) const {
+        valarray<double> z = x;
+        for (unsigned t = 0; t < lmP.size(); ++t) {
+            double vz = (lmV[t] * z).sum();
+            x *= lmA;
+            x += (lmB[t] * vz) * lmP[t];
+        }
+    }
+
+    /* x = A_k^{-1} x, with A_k the product of the k first updates, in O(N k) */
+    void lmInverseTransform(valarray<double>& x, unsigned k) const {
+        for (unsigned t = 0; t < k; ++t) {
+            double vx = (lmV[t] * x).sum();
+            x /= lmA;
+            x -= (lmD[t] * vx) * lmV[t];
+        }
+    }
+
+    /* Store a new direction, forget the oldest one if the memory is full and recompute A */
+    void lmStore(const valarray<double>& direction) {
+        if (lmP.size() == p.memory) {
+            lmP.erase(lmP.begin());
+        }
+        lmP.push_back(direction);
+
+        lmV.resize(lmP.size());
+        lmB.resize(lmP.size());
+        lmD.resize(lmP.size());
+        for (unsigned t = 0; t < lmP.size(); ++t) {
+            lmV[t] = lmP[t];
+            lmInverseTransform(lmV[t], t);
+            double vv = (lmV[t] * lmV[t]).sum();
+            if (vv <= 0.) { // nothing to learn from a null direction
+                lmB[t] = lmD[t] = 0.;
+                continue;
+            }
+            lmB[t] = lmA / vv * (sqrt(1. + lmC1 / (1. - lmC1) * vv) - 1.);
+            lmD[t] = lmB[t] / (lmA * lmA) / (1. + lmB[t] / lmA * vv); // Sherman-Morrison
+        }
+    }
+
+    /* Variance of the i-th coordinate, up to sigma^2 (not maintained by the limited memory model, where A is taken as a rotation) */
+    double variance(unsigned i) const {
+        switch (p.variant) {
+            case CMAParams::separable : return diagC[i];
+            case CMAParams::limited_memory : return d[i] * d[i];
+            default : return C[i][i];
+        }
     }
 
     void sample(vector<double>& v) {
         unsigned n = p.n;
         v.resize(n);
 
+        if (p.variant == CMAParams::separable) {
+            for (unsigned i = 0; i < n; ++i)
+                v[i] = mean[i] + sigma * d[i] * rng.normal();
+            return;
+        }
+
+        if (p.variant == CMAParams::limited_memory) {
+            valarray<double> z(n);
+            for (unsigned i = 0; i < n; ++i)
+                z[i] = rng.normal();
+            lmTransform(z);
+            for (unsigned i = 0; i < n; ++i)
+                v[i] = mean[i] + sigma * d[i] * z[i];
+            return;
+        }
+
         vector<double> tmp(n);
         for (unsigned i = 0; i < n; ++i)
             tmp[i] = d[i] * rng.normal();
@@ -139,24 +229,9 @@ struct CMAStateImpl {
             BDz[i] = sqrt(p.mueff)*(mean[i] - oldmean[i])/sigma;
         }
 
-        vector<double> tmp(n);
-        /* calculate z := D^(-1) * B^(-1) * rgBDz into rgdTmp */
-        for (unsigned i = 0; i < n; ++i) {
-            double sum = 0.0;
-            for (unsigned j = 0; j < n; ++j) {
-                sum += B[j][i] * BDz[j];
-            }
-            tmp[i] = sum / d[i];
-        }
-
-        /* cumulation for sigma (ps) using B*z */
-        for (unsigned i = 0; i < n; ++i) {
-            double sum = 0.0;
-            for (unsigned j = 0; j < n; ++j)
-                sum += B[i][j] * tmp[j];
-
-            ps[i] = (1. - p.ccumsig) * ps[i] + sqrt(p.ccumsig * (2. - p.ccumsig)) * sum;
-        }
+        /* cumulation for sigma (ps) using B*z, with z := D^(-1) * B^(-1) * rgBDz */
+        valarray<double> Bz = whiten(BDz);
+        ps = (1. - p.ccumsig) * ps + sqrt(p.ccumsig * (2. - p.ccumsig)) * Bz;
 
         /* calculate norm(ps)^2 */
         double psxps = (ps * ps).sum();
@@ -195,7 +270,17 @@ struct CMAStateImpl {
 
         /* update of C  */
         /* Adapt_C(t); not used anymore */
-        if (p.ccov != 0.) {
+        if (p.variant == CMAParams::separable) {
+            updateDiagonal(pop, oldmean, hsig);
+        }
+        else if (p.variant == CMAParams::limited_memory) {
+            /* directions are stored every N/m generations, so that the memory spans about N generations */
+            unsigned interval = std::max(1u, p.n / std::max(1u, p.memory));
+            if (p.memory > 0 && (gen + 1) % interval == 0) {
+                lmStore(pc / d);
+            }
+        }
+        else if (p.ccov != 0.) {
             //flgEigensysIsUptodate = 0;
 
             /* update covariance matrix */
@@ -242,11 +327,85 @@ struct CMAStateImpl {
         gen++; // increase generation
     }
 
+    /* B * D^(-1) * B^(-1) * x, i.e. C^(-1/2) x, in the metric of the covariance model */
+    valarray<double> whiten(const valarray<double>& x) const {
+        unsigned n = p.n;
+
+        if (p.variant == CMAParams::separable) {
+            return x / d;
+        }
+
+        if (p.variant == CMAParams::limited_memory) {
+            valarray<double> z = x / d;
+            lmInverseTransform(z, lmP.size());
+            return z;
+        }
+
+        /* B is stored by rows: accumulate B^T x row by row */
+        valarray<double> tmp(0., n);
+        for (unsigned j = 0; j < n; ++j) {
+            vector<double>::const_iterator b_row = B[j];
+            for (unsigned i = 0; i < n; ++i) {
+                tmp[i] += b_row[i] * x[j];
+            }
+        }
+        tmp /= d;
+
+        valarray<double> z(n);
+        for (unsigned i = 0; i < n; ++i) {
+            vector<double>::const_iterator b_row = B[i];
+            double sum = 0.0;
+            for (unsigned j = 0; j < n; ++j)
+                sum += b_row[j] * tmp[j];
+            z[i] = sum;
+        }
+        return z;
+    }
+
+    /* sep-CMA-ES (Ros and Hansen, 2008): the update of the full model restricted
+     * to the diagonal, with a learning rate (N+1.5)/3 times larger */
+    void updateDiagonal(const vector<const vector<double>* >& pop, const vector<double>& oldmean, double hsig) {
+        double ccov = std::min(1., p.ccov * (p.n + 1.5) / 3.);
+        if (ccov == 0.) {
+            return;
+        }
+        for (unsigned i = 0; i < p.n; ++i) {
+            double c =
+                (1 - ccov) * diagC[i]
+                    +
+                ccov * (1./p.mucov) * pc[i] * pc[i]
+                    +
+                (1-hsig) * p.ccumcov * (2. - p.ccumcov) * diagC[i];
+
+            for (unsigned k = 0; k < p.mu; ++k) { /* additional rank mu update */
+                double y = ((*pop[k])[i] - oldmean[i]) / sigma;
+                c += ccov * (1-1./p.mucov) * p.weights[k] * y * y;
+            }
+            diagC[i] = c;
+        }
+        d = sqrt(diagC);
+    }
+
+    /* Multiply the variance of the i-th coordinate by factor */
+    void inflateVariance(unsigned i, double factor) {
+        switch (p.variant) {
+            case CMAParams::separable :
+                diagC[i] *= factor;
+                d[i] = sqrt(diagC[i]);
+                break;
+            case CMAParams::limited_memory :
+                d[i] *= sqrt(factor);
+                break;
+            default :
+                C[i][i] *= factor;
+        }
+    }
+
     void treatNumericalIssues(double best, double worst) {
 
         /* treat stdevs */
         for (unsigned i = 0; i < p.n; ++i) {
-            if (sigma * sqrt(C[i][i]) < p.minStdevs[i]) {
+            if (sigma * sqrt(variance(i)) < p.minStdevs[i]) {
                 // increase stdev
                 sigma *= exp(0.05+1./p.damp);
                 break;
@@ -263,9 +422,13 @@ struct CMAStateImpl {
         for (unsigned axis = 0; axis < p.n; ++axis) {
             double fac = 0.1 * sigma * d[axis];
             unsigned coord;
-            for (coord = 0; coord < p.n; ++coord) {
-                if (mean[coord] != mean[coord] + fac * B[coord][axis]) {
-                    break;
+            if (p.variant != CMAParams::full) { // axes of D, the limited memory model is not tested against A
+                coord = (mean[axis] != mean[axis] + fac) ? axis : p.n;
+            } else {
+                for (coord = 0; coord < p.n; ++coord) {
+                    if (mean[coord] != mean[coord] + fac * B[coord][axis]) {
+                        break;
+                    }
                 }
             }
 
@@ -280,8 +443,8 @@ struct CMAStateImpl {
         bool theresAnIssue = false;
 
         for (unsigned i = 0; i < p.n; ++i) {
-            if (mean[i] == mean[i] + 0.2 * sigma * sqrt(C[i][i])) {
-                C[i][i] *= (1. + p.ccov);
+            if (mean[i] == mean[i] + 0.2 * sigma * sqrt(variance(i))) {
+                inflateVariance(i, 1. + p.ccov);
                 theresAnIssue = true;
             }
         }
@@ -294,6 +457,12 @@ struct CMAStateImpl {
 
     bool updateEigenSystem(unsigned max_tries, unsigned max_iters) {
 
+        /* the separable and limited memory models need no decomposition */
+        if (p.variant != CMAParams::full) return true;
+
+        /* lazy update: the decomposition is only refreshed every eigenInterval generations */
+        if (gen - genOfEigenUpdate < p.eigenInterval) return true;
+
         if (max_iters==0) max_iters = 30 * p.n;
 
         static double lastGoodMinimumEigenValue = 1.0;
@@ -324,8 +493,8 @@ struct CMAStateImpl {
 
                 d = sqrt(d);
 
+                genOfEigenUpdate = gen;
                 //flgEigensysIsUptodate = 1;
-                //genOfEigensysUpdate = gen;
                 //clockeigensum += clock() - clockeigenbegin;
                 return true;
             } /* if cIterEig < ... */
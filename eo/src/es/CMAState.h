@@ -65,6 +65,10 @@ class CMAState {
      * call this function after reestimate in order to update the eigen system
      * It is a seperate call to allow the user to periodically skip this expensive step
      *
+     * The decomposition is only recomputed every CMAParams::eigenInterval generations
+     * (the eigen system being kept in between), and never with the separable or the
+     * limited memory models, which do not need it.
+     *
      * max_iters = 0 implies 30 * N iterations
      *
      * If after max_tries still no numerically sound eigen system is constructed,
@@ -0,0 +1,218 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoLinearParseTree.h : a parse tree stored as a contiguous sequence of nodes
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoLinearParseTree_h
+#define eoLinearParseTree_h
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "../EO.h"
+#include "parse_tree.h"
+
+using namespace gp_parse_tree;
+
+/** Parse tree for genetic programming, stored as a std::vector of Nodes in postfix order
+
+The nodes are in the order of a parse_tree (tree.ebegin() to tree.eend()): every node follows its
+children, the last child first, so that the root is the last node and its first child ends just
+before it. A subtree is thus a contiguous span of nodes, ending at its root: it is copied, replaced
+or evaluated (see eoSymregBlockEval) without any allocation nor pointer chasing, and the indexes of
+the nodes are those of eoParseTree, so that the operators of eoLinearParseTreeOp.h make the same
+trees as those of eoParseTreeOp.h.
+
+@class eoLinearParseTree eoLinearParseTree.h gp/eoLinearParseTree.h
+
+@ingroup ParseTree
+*/
+template <class FType, class Node>
+class eoLinearParseTree : public EO<FType>, public std::vector<Node>
+{
+public:
+
+    using std::vector<Node>::begin;
+    using std::vector<Node>::end;
+    using std::vector<Node>::size;
+    using std::vector<Node>::erase;
+    using std::vector<Node>::insert;
+
+    typedef typename std::vector<Node>::const_iterator const_iterator;
+
+    /**
+     * Default Constructor
+     */
+    eoLinearParseTree(void) {}
+
+    /**
+     * Constructor from a parse tree
+     * @param _tree The tree to copy
+     */
+    eoLinearParseTree(const parse_tree<Node>& _tree)
+    {
+        fromTree(_tree);
+    }
+
+    /**
+     * To copy the nodes of a parse tree
+     * @param _tree The tree to copy
+     */
+    void fromTree(const parse_tree<Node>& _tree)
+    {
+        this->clear();
+        this->reserve(_tree.size());
+        for (typename parse_tree<Node>::embedded_const_iterator it = _tree.ebegin(); it != _tree.eend(); ++it)
+        {
+            this->push_back(*it);
+        }
+    }
+
+    /**
+     * To get me as a parse tree
+     */
+    parse_tree<Node> toTree(void) const
+    {
+        return parse_tree<Node>(begin(), end());
+    }
+
+    /**
+     * The index of the first node of the subtree whose root is the node _i
+     * @param _i the index of the root
+     */
+    unsigned subtreeBegin(unsigned _i) const
+    {
+        int needed = this->operator[](_i).arity();
+        while (needed > 0)
+        {
+            --_i;
+            needed += this->operator[](_i).arity() - 1;
+        }
+        return _i;
+    }
+
+    /**
+     * To replace the subtree whose root is the node _i by the nodes [_first, _last)
+     * @param _i the index of the root of the replaced subtree
+     * @param _first the first node of the new subtree
+     * @param _last the end of the new subtree
+     */
+    template <class It>
+    void replaceSubtree(unsigned _i, It _first, It _last)
+    {
+        unsigned b = subtreeBegin(_i);
+        unsigned oldSize = _i + 1 - b;
+        unsigned newSize = std::distance(_first, _last);
+        if (newSize > oldSize)
+        {
+            insert(begin() + _i + 1, newSize - oldSize, Node());
+        }
+        else
+        {
+            erase(begin() + b + newSize, begin() + _i + 1);
+        }
+        std::copy(_first, _last, begin() + b);
+    }
+
+    /**
+     * To prune me to a certain size, by replacing the root by its first child
+     * @param _size My maximum size
+     */
+    virtual void pruneTree(unsigned _size)
+    {
+        if (_size < 1)
+            return;
+
+        unsigned b = 0;
+        unsigned last = size() - 1;
+        while (last + 1 - b > _size)
+        {
+            --last;
+            b = subtreeBegin(last);
+        }
+        if (last + 1 < size())
+        {
+            erase(begin() + last + 1, end());
+            erase(begin(), begin() + b);
+        }
+    }
+
+    /**
+     * To read me from a stream
+     * @param is The std::istream
+     */
+    eoLinearParseTree(std::istream& is) : EO<FType>(), std::vector<Node>()
+    {
+        readFrom(is);
+    }
+
+    /// My class name
+    std::string className(void) const { return "eoLinearParseTree"; }
+
+    /**
+     * To print me on a stream, as an eoParseTree
+     * @param os The std::ostream
+     */
+    void printOn(std::ostream& os) const
+    {
+        EO<FType>::printOn(os);
+        os << ' ';
+
+        os << size() << ' ';
+
+        std::copy(begin(), end(), std::ostream_iterator<Node>(os, " "));
+    }
+
+    /**
+     * To read me from a stream
+     * @param is The std::istream
+     */
+    void readFrom(std::istream& is)
+    {
+        EO<FType>::readFrom(is);
+
+        unsigned sz;
+        is >> sz;
+
+        this->resize(sz);
+        for (unsigned i = 0; i < sz; ++i)
+        {
+            is >> this->operator[](i);
+        }
+    }
+};
+
+// friend function to print eoLinearParseTree
+template <class FType, class Node>
+std::ostream& operator<<(std::ostream& os, const eoLinearParseTree<FType, Node>& eot)
+{
+    eot.printOn(os);
+    return os;
+}
+
+// friend function to read eoLinearParseTree
+template <class FType, class Node>
+std::istream& operator>>(std::istream& is, eoLinearParseTree<FType, Node>& eot)
+{
+    eot.readFrom(is);
+    return is;
+}
+
+#endif
@@ -0,0 +1,218 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoLinearParseTreeOp.h : initializer, crossover and mutation operators for the eoLinearParseTree class
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoLinearParseTreeOp_h
+#define eoLinearParseTreeOp_h
+
+#include <vector>
+
+#include "../eoInit.h"
+#include "../eoOp.h"
+#include "../utils/eoRNG.h"
+
+#include "eoParseTree.h"
+#include "eoLinearParseTree.h"
+
+/** eoLinearParseTreeInit --> initializes an eoLinearParseTree with an initializer of eoParseTree
+(e.g. eoParseTreeDepthInit), whose tree is then copied.
+\class eoLinearParseTreeInit eoLinearParseTreeOp.h gp/eoLinearParseTreeOp.h
+\ingroup ParseTree
+*/
+template<class FType, class Node>
+class eoLinearParseTreeInit: public eoInit< eoLinearParseTree<FType, Node> > {
+public:
+
+  typedef eoLinearParseTree<FType,Node> EoType;
+
+  /**
+   * Constructor
+   * @param _init An initializer of eoParseTree
+   */
+  eoLinearParseTreeInit(eoInit< eoParseTree<FType, Node> >& _init)
+    : eoInit<EoType>(), initializer(_init) {};
+
+  /// the class name
+  virtual std::string className() const { return "eoLinearParseTreeInit"; };
+
+  /**
+   * Initialize an individual
+   * @param _eo The individual
+   */
+  void operator()(EoType& _eo)
+  {
+      initializer(tree);
+      _eo.fromTree(tree);
+      _eo.invalidate();
+  }
+
+private:
+  eoInit< eoParseTree<FType, Node> >& initializer;
+  eoParseTree<FType, Node> tree;
+};
+
+/** eoLinearSubtreeXOver --> subtree xover, which swaps two spans of nodes.
+It gives the same offspring as eoSubtreeXOver.
+\class eoLinearSubtreeXOver eoLinearParseTreeOp.h gp/eoLinearParseTreeOp.h
+\ingroup ParseTree
+*/
+template<class FType, class Node>
+class eoLinearSubtreeXOver: public eoQuadOp< eoLinearParseTree<FType, Node> > {
+public:
+
+  typedef eoLinearParseTree<FType,Node> EoType;
+  /**
+   * Constructor
+   * @param _max_length the maximum size of an individual
+   */
+  eoLinearSubtreeXOver( unsigned _max_length)
+    : eoQuadOp<EoType>(), max_length(_max_length) {};
+
+  /// the class name
+  virtual std::string className() const { return "eoLinearSubtreeXOver"; };
+
+  /**
+   * Perform crossover on two individuals
+   * param _eo1 The first parent individual
+   * param _eo2 The second parent individual
+   */
+  bool operator()(EoType & _eo1, EoType & _eo2 )
+  {
+      unsigned i = rng.random(_eo1.size());
+      unsigned j = rng.random(_eo2.size());
+
+      unsigned b1 = _eo1.subtreeBegin(i);
+      buffer.assign(_eo1.begin() + b1, _eo1.begin() + i + 1);
+
+      _eo1.replaceSubtree(i, _eo2.begin() + _eo2.subtreeBegin(j), _eo2.begin() + j + 1); // insert subtree
+      _eo2.replaceSubtree(j, buffer.begin(), buffer.end());
+
+      _eo1.pruneTree(max_length);
+      _eo2.pruneTree(max_length);
+
+      return true;
+  }
+
+private:
+  unsigned max_length;
+  std::vector<Node> buffer;
+};
+
+/** eoLinearBranchMutation --> replace a subtree with a randomly created subtree.
+It gives the same offspring as eoBranchMutation.
+\class eoLinearBranchMutation eoLinearParseTreeOp.h gp/eoLinearParseTreeOp.h
+\ingroup ParseTree
+ */
+template<class FType, class Node>
+class eoLinearBranchMutation: public eoMonOp< eoLinearParseTree<FType, Node> >
+{
+public:
+
+  typedef eoLinearParseTree<FType,Node> EoType;
+  /**
+   * Constructor
+   * @param _init An initializer of eoLinearParseTree (e.g. an eoLinearParseTreeInit)
+   * @param _max_length the maximum size of an individual
+   */
+  eoLinearBranchMutation(eoInit<EoType>& _init, unsigned _max_length)
+    : eoMonOp<EoType>(), max_length(_max_length), initializer(_init)
+  {};
+
+  /// the class name
+  virtual std::string className() const { return "eoLinearBranchMutation"; };
+
+  /**
+   * Mutate an individual
+   * @param _eo1 The individual that is to be changed
+   */
+  bool operator()(EoType& _eo1 )
+  {
+      unsigned i = rng.random(_eo1.size());
+
+      initializer(eo2);
+
+      unsigned j = rng.random(eo2.size());
+
+      _eo1.replaceSubtree(i, eo2.begin() + eo2.subtreeBegin(j), eo2.begin() + j + 1); // insert subtree
+
+      _eo1.pruneTree(max_length);
+
+      return true;
+  }
+
+private :
+
+  unsigned max_length;
+  eoInit<EoType>& initializer;
+  EoType eo2;
+};
+
+/** eoLinearPointMutation --> replace a Node with a Node of the same arity.
+It gives the same offspring as eoPointMutation.
+\class eoLinearPointMutation eoLinearParseTreeOp.h gp/eoLinearParseTreeOp.h
+\ingroup ParseTree
+*/
+template<class FType, class Node>
+class eoLinearPointMutation: public eoMonOp< eoLinearParseTree<FType, Node> >
+{
+public:
+
+  typedef eoLinearParseTree<FType,Node> EoType;
+
+  /**
+   * Constructor
+   * @param _initializor The std::vector of Nodes given to the eoParseTreeDepthInit
+   */
+  eoLinearPointMutation( std::vector<Node>& _initializor)
+    : eoMonOp<EoType>(), initializor(_initializor)
+  {};
+
+  /// the class name
+  virtual std::string className() const { return "eoLinearPointMutation"; };
+
+  /**
+   * Mutate an individual
+   * @param _eo1 The individual that is to be changed
+   */
+  bool operator()(EoType& _eo1 )
+  {
+      // select a random node i that is to be mutated
+      int i = rng.random(_eo1.size());
+      // request the arity of the node that is to be replaced
+      int arity = _eo1[i].arity();
+
+      int j=0;
+
+      do
+      {
+          j = rng.random(initializor.size());
+
+      }while ((initializor[j].arity() != arity));
+
+      _eo1[i] = initializor[j];
+
+      return true;
+  }
+
+private :
+  std::vector<Node>& initializor;
+};
+
+#endif
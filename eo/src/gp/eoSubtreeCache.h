@@ -0,0 +1,316 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoSubtreeCache.h : hash-consed subtrees, with their values on a dataset
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoSubtreeCache_h
+#define eoSubtreeCache_h
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "../eoPop.h"
+#include "../utils/eoStat.h"
+
+/** eoSubtreeCache --> the values of the subtrees of GP individuals on a dataset, shared by all the trees.
+
+The subtrees are hash-consed: a subtree is identified by its root and the identifiers of its children,
+so that two equal subtrees, in the same tree or in different ones, get the same identifier, in a time
+which does not depend on their size. Every subtree is stored with its values on all the rows of the
+dataset. As the offspring share most of their subtrees with their parents, evaluating an offspring
+mostly consists in finding its subtrees in the cache: only the nodes on the path from the modified
+subtrees to the root are computed.
+
+The number of subtrees is bounded, the least recently used ones being removed first, which costs at
+most capacity * rows doubles. A removed subtree gets another identifier when it is stored again, so
+that the subtrees which contained it are not found anymore, and are removed in turn.
+
+The cache can be shared by several evaluation functions, in different threads, but all of them must use
+the same dataset. The Node must have operator==, a method size_t hash() const, and the method block()
+described in eoSymregBlockEval.
+
+\class eoSubtreeCache eoSubtreeCache.h gp/eoSubtreeCache.h
+\ingroup ParseTree
+*/
+template <class Node>
+class eoSubtreeCache
+{
+public :
+
+    /**
+     * Constructor
+     * @param _capacity the maximum number of subtrees
+     * @param _parallel whether the values of a node are computed in parallel (with OpenMP)
+     */
+    eoSubtreeCache(unsigned _capacity = 10000, bool _parallel = false)
+        : capacity(std::max(_capacity, 1u)), parallel(_parallel), nextId(0), nHits(0), nMisses(0) {}
+
+    /**
+     * The values of a tree on all the rows
+     * @param _program the nodes of the tree, in postfix order (see eoLinearParseTree)
+     * @param _size the number of nodes
+     * @param _variables the values of every variable
+     * @param _rows the number of rows
+     * @param _values keeps the values alive, as long as they are used
+     * @return the values of the tree
+     */
+    const double* operator()(const Node* _program, unsigned _size, const std::vector<const double*>& _variables, unsigned _rows,
+                             std::shared_ptr< const std::vector<double> >& _values)
+    {
+        std::vector<Value> stack;
+        std::vector<const double*> args;
+        for (unsigned i = 0; i < _size; ++i)
+        {
+            const Node& node = _program[i];
+            unsigned arity = node.arity();
+            // the first child is on the top of the stack
+            Key key(node);
+            args.resize(arity);
+            for (unsigned k = 0; k < arity; ++k)
+            {
+                const Value& child = stack[stack.size() - 1 - k];
+                key.children.push_back(child.id);
+                args[k] = child.data;
+            }
+
+            Value value;
+            if (!find(key, value))
+            {
+                compute(node, args, _variables, _rows, value);
+                insert(key, value);
+            }
+            // the children keep their values alive until then, another thread may remove them from the cache
+            stack.resize(stack.size() - arity);
+            stack.push_back(value);
+        }
+        _values = stack.back().values;
+        return stack.back().data;
+    }
+
+    /// the number of subtrees which were found
+    unsigned long hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return nHits;
+    }
+
+    /// the number of subtrees which were computed
+    unsigned long misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return nMisses;
+    }
+
+    /// the ratio of the subtrees which were found
+    double hitRate() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        unsigned long total = nHits + nMisses;
+        return total == 0 ? 0.0 : double(nHits) / total;
+    }
+
+    /// the number of subtrees in the cache
+    unsigned size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    /// removes all the subtrees, for instance when the dataset changes
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        lru.clear();
+    }
+
+private :
+
+    /** A subtree: its root and the identifiers of its children */
+    struct Key
+    {
+        Key(const Node& _node) : node(_node) {}
+
+        bool operator==(const Key& _other) const
+        {
+            return (children == _other.children) && (node == _other.node);
+        }
+
+        Node node;
+        std::vector<unsigned long> children;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& _key) const
+        {
+            size_t h = _key.node.hash();
+            for (unsigned k = 0; k < _key.children.size(); ++k)
+            {
+                h = h * 1000003 + std::hash<unsigned long>()(_key.children[k]);
+            }
+            return h;
+        }
+    };
+
+    /** A subtree in the cache: its identifier and its values */
+    struct Value
+    {
+        unsigned long id;
+        /** the values */
+        std::shared_ptr< const std::vector<double> > values;
+        /** the first value */
+        const double* data;
+    };
+
+    struct Entry
+    {
+        Value value;
+        typename std::list<Key>::iterator position;
+    };
+
+    /** finds a subtree, and marks it as the most recently used */
+    bool find(const Key& _key, Value& _value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        typename std::unordered_map<Key, Entry, KeyHash>::iterator it = entries.find(_key);
+        if (it == entries.end())
+        {
+            nMisses++;
+            return false;
+        }
+        nHits++;
+        lru.splice(lru.begin(), lru, it->second.position);
+        _value = it->second.value;
+        return true;
+    }
+
+    /** stores a subtree, unless another thread did it meanwhile, and removes the least recently used ones */
+    void insert(const Key& _key, Value& _value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        typename std::unordered_map<Key, Entry, KeyHash>::iterator it = entries.find(_key);
+        if (it != entries.end())
+        {
+            _value = it->second.value;
+            return;
+        }
+        _value.id = nextId++;
+        lru.push_front(_key);
+        Entry& entry = entries[_key];
+        entry.value = _value;
+        entry.position = lru.begin();
+        while (entries.size() > capacity)
+        {
+            entries.erase(lru.back());
+            lru.pop_back();
+        }
+    }
+
+    /** computes the values of a node, by chunks of rows */
+    void compute(const Node& _node, const std::vector<const double*>& _args, const std::vector<const double*>& _variables,
+                 unsigned _rows, Value& _value)
+    {
+        std::shared_ptr< std::vector<double> > values(new std::vector<double>(std::max(_rows, 1u)));
+        const int chunk = 4096;
+
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+        for (int first = 0; first < (int) _rows; first += chunk)
+        {
+            unsigned n = std::min(chunk, (int) _rows - first);
+            std::vector<const double*> args(_args), variables(_variables);
+            for (unsigned k = 0; k < args.size(); ++k)
+            {
+                args[k] += first;
+            }
+            for (unsigned v = 0; v < variables.size(); ++v)
+            {
+                variables[v] += first;
+            }
+            const double* result = _node.block(& (*values)[first], args.empty() ? 0 : & args[0],
+                                               variables.empty() ? 0 : & variables[0], n);
+            if (result != & (*values)[first])
+            {
+                // the values of a variable are copied, to be independent from the dataset
+                std::copy(result, result + n, values->begin() + first);
+            }
+        }
+
+        _value.values = values;
+        _value.data = & (*values)[0];
+    }
+
+    unsigned capacity;
+    bool parallel;
+    unsigned long nextId;
+    unsigned long nHits;
+    unsigned long nMisses;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    /** the subtrees, the most recently used first */
+    std::list<Key> lru;
+    mutable std::mutex mutex;
+};
+
+/** eoSubtreeCacheStat --> the ratio of the subtrees found in an eoSubtreeCache since the previous call,
+that is, during the last generation when it is added to the checkpoint.
+
+\class eoSubtreeCacheStat eoSubtreeCache.h gp/eoSubtreeCache.h
+\ingroup ParseTree
+*/
+template <class EOT, class Node>
+class eoSubtreeCacheStat : public eoStat<EOT, double>
+{
+public :
+
+    using eoStat<EOT, double>::value;
+
+    /**
+     * Constructor
+     * @param _cache the cache
+     * @param _description the name of the statistic
+     */
+    eoSubtreeCacheStat(const eoSubtreeCache<Node>& _cache, std::string _description = "Cache hit rate")
+        : eoStat<EOT, double>(0.0, _description), cache(_cache), hits(0), misses(0) {}
+
+    virtual std::string className(void) const { return "eoSubtreeCacheStat"; }
+
+    void operator()(const eoPop<EOT>&)
+    {
+        unsigned long newHits = cache.hits();
+        unsigned long newMisses = cache.misses();
+        unsigned long total = (newHits - hits) + (newMisses - misses);
+        value() = total == 0 ? 0.0 : double(newHits - hits) / total;
+        hits = newHits;
+        misses = newMisses;
+    }
+
+private :
+
+    const eoSubtreeCache<Node>& cache;
+    unsigned long hits;
+    unsigned long misses;
+};
+
+#endif
@@ -0,0 +1,312 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoSymregBlockEval.h : evaluation of parse trees on a dataset, by blocks of rows
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoSymregBlockEval_h
+#define eoSymregBlockEval_h
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../eoEvalFunc.h"
+#include "../eoExceptions.h"
+#include "../utils/eoParallel.h"
+#include "parse_tree.h"
+#include "eoSubtreeCache.h"
+
+/** eoSymregBlockEval --> root mean squared error of a parse tree on a dataset.
+
+Instead of applying the tree on every row of the dataset, which goes through the whole tree for each
+row, the nodes are interpreted in postfix order, each one on a block of rows at once: a node reads the
+values of its children in column buffers and writes its own in another one, in a loop which the
+compiler can vectorize. The tree is read once per block, so that the interpretation costs nearly
+nothing on large datasets.
+
+The individuals are eoLinearParseTree, whose nodes are already in postfix order, or eoParseTree, whose
+nodes are copied first. Besides its point by point evaluation, the Node must have a method
+  const double* block(double* buffer, const double* const* args, const double* const* variables, unsigned n) const
+which computes its values on n rows, args[k] being the values of its k-th child and variables[v] those
+of the variable v, and returns them: they are either written in the buffer (which may be one of the
+args), or taken elsewhere (e.g. in variables). See eoSymregNode.
+
+With an eoSubtreeCache, the values of the subtrees found in the cache are not computed again, the
+others are computed on all the rows at once and stored in the cache. The fitness is the same.
+
+The blocks are evaluated in parallel if eo::parallel is enabled, and the fitness does not depend on
+the number of threads. The buffers are local to the calls and to the threads, so that the individuals
+can also be evaluated at once by several threads (e.g. by apply or eoPopLoopEval): the blocks of each
+one are then evaluated in sequence. As for t-eoSymreg, the error is bounded by 1e+20, so that diverging trees still
+get a comparable fitness.
+
+\class eoSymregBlockEval eoSymregBlockEval.h gp/eoSymregBlockEval.h
+\ingroup ParseTree
+*/
+template <class EOT>
+class eoSymregBlockEval : public eoEvalFunc<EOT>
+{
+public :
+
+    typedef typename EOT::Fitness Fitness;
+    typedef typename EOT::value_type Node;
+
+    /**
+     * Constructor
+     * @param _inputs the values of every variable (_inputs[v][r] is the value of the variable v on the row r)
+     * @param _target the value to be found on every row
+     * @param _blockSize the number of rows evaluated at once
+     */
+    eoSymregBlockEval(const std::vector< std::vector<double> >& _inputs, const std::vector<double>& _target, unsigned _blockSize = 256)
+        : inputs(_inputs), target(_target), blockSize(std::max(_blockSize, 1u)), cache(0)
+    {
+        init();
+    }
+
+    /**
+     * Constructor with a cache of the subtrees
+     * @param _inputs the values of every variable (_inputs[v][r] is the value of the variable v on the row r)
+     * @param _target the value to be found on every row
+     * @param _cache the cache, which must only be used with this dataset
+     * @param _blockSize the number of rows evaluated at once, for the error
+     */
+    eoSymregBlockEval(const std::vector< std::vector<double> >& _inputs, const std::vector<double>& _target,
+                      eoSubtreeCache<Node>& _cache, unsigned _blockSize = 256)
+        : inputs(_inputs), target(_target), blockSize(std::max(_blockSize, 1u)), cache(& _cache)
+    {
+        init();
+    }
+
+    /// the class name
+    virtual std::string className() const { return "eoSymregBlockEval"; }
+
+    /**
+     * Evaluates an individual, if its fitness is invalid
+     * @param _eo the individual
+     */
+    void operator()(EOT& _eo)
+    {
+        if (_eo.invalid())
+        {
+            _eo.fitness(Fitness(error(_eo)));
+        }
+    }
+
+    /**
+     * The root mean squared error of a tree
+     * @param _tree the tree
+     */
+    double error(const EOT& _tree)
+    {
+        const Node* program = postfix(_tree);
+        unsigned size = _tree.size();
+        check(program, size);
+        unsigned nBlocks = (target.size() + blockSize - 1) / blockSize;
+        std::vector<double> partial(nBlocks);
+
+        std::shared_ptr< const std::vector<double> > values;
+        const double* all = cache ? (*cache)(program, size, variables, target.size(), values) : 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for if(eo::parallel.isEnabled() && !omp_in_parallel())
+#endif
+        for (int b = 0; b < (int) nBlocks; ++b)
+        {
+            unsigned first = b * blockSize;
+            unsigned n = std::min(blockSize, (unsigned) target.size() - first);
+            const double* outputs = all ? all + first : interpret(program, size, first, n, workspace());
+            const double* t = & target[first];
+            double sum = 0.0;
+            for (unsigned r = 0; r < n; ++r)
+            {
+                sum += (outputs[r] - t[r]) * (outputs[r] - t[r]);
+            }
+            partial[b] = sum;
+        }
+
+        double fitness = 0.0;
+        for (unsigned b = 0; b < nBlocks; ++b)
+        {
+            fitness += partial[b];
+        }
+        if (!target.empty())
+        {
+            fitness = sqrt(fitness / target.size());
+        }
+        if (!(fitness <= 1e+20))
+        {
+            fitness = 1e+20;
+        }
+        return fitness;
+    }
+
+    /**
+     * The values of a tree on every row
+     * @param _tree the tree
+     * @param _outputs the values
+     */
+    void predict(const EOT& _tree, std::vector<double>& _outputs)
+    {
+        const Node* program = postfix(_tree);
+        check(program, _tree.size());
+        _outputs.resize(target.size());
+        if (cache)
+        {
+            std::shared_ptr< const std::vector<double> > values;
+            const double* all = (*cache)(program, _tree.size(), variables, target.size(), values);
+            std::copy(all, all + target.size(), _outputs.begin());
+            return;
+        }
+        for (unsigned first = 0; first < target.size(); first += blockSize)
+        {
+            unsigned n = std::min(blockSize, (unsigned) target.size() - first);
+            const double* outputs = interpret(program, _tree.size(), first, n, workspace());
+            std::copy(outputs, outputs + n, _outputs.begin() + first);
+        }
+    }
+
+private :
+
+    /** checks the dataset and keeps the first value of every variable */
+    void init()
+    {
+        for (unsigned v = 0; v < inputs.size(); ++v)
+        {
+            if (inputs[v].size() != target.size())
+            {
+                throw eoException("eoSymregBlockEval: every variable must have a value on every row");
+            }
+        }
+        variables.resize(inputs.size());
+        for (unsigned v = 0; v < inputs.size(); ++v)
+        {
+            variables[v] = inputs[v].empty() ? 0 : & inputs[v][0];
+        }
+    }
+
+    /** The buffers of a thread, shared by all the evaluation functions */
+    struct Workspace
+    {
+        /** the column buffers, one for every position of the stack */
+        std::vector<double> buffers;
+        /** the values on the stack */
+        std::vector<const double*> stack;
+        /** the values of the children of a node, the first one first */
+        std::vector<const double*> args;
+        /** the values of the variables on the current block */
+        std::vector<const double*> variables;
+    };
+
+    static Workspace& workspace()
+    {
+        static thread_local Workspace w;
+        return w;
+    }
+
+    /** the nodes of a linear tree, in postfix order */
+    const Node* postfix(const std::vector<Node>& _tree)
+    {
+        return _tree.empty() ? 0 : & _tree[0];
+    }
+
+    /** the nodes of a parse tree, copied in postfix order in a buffer of the thread */
+    const Node* postfix(const parse_tree<Node>& _tree)
+    {
+        static thread_local std::vector<Node> nodes;
+        nodes.clear();
+        for (typename parse_tree<Node>::embedded_const_iterator it = _tree.ebegin(); it != _tree.eend(); ++it)
+        {
+            nodes.push_back(*it);
+        }
+        return nodes.empty() ? 0 : & nodes[0];
+    }
+
+    /** checks that a program is a single tree */
+    void check(const Node* _program, unsigned _size)
+    {
+        unsigned top = 0;
+        for (unsigned i = 0; i < _size; ++i)
+        {
+            unsigned arity = _program[i].arity();
+            if (top < arity)
+            {
+                break;
+            }
+            top = top - arity + 1;
+        }
+        if (top != 1)
+        {
+            throw eoException("eoSymregBlockEval: malformed tree");
+        }
+    }
+
+    /**
+     * Evaluates a checked program on _n rows from the row _first
+     * @return the values of the program
+     */
+    const double* interpret(const Node* _program, unsigned _size, unsigned _first, unsigned _n, Workspace& _w)
+    {
+        if (_w.buffers.size() < _size * blockSize)
+        {
+            _w.buffers.resize(_size * blockSize);
+        }
+        if (_w.stack.size() < _size)
+        {
+            _w.stack.resize(_size);
+        }
+        _w.variables.resize(variables.size());
+        for (unsigned v = 0; v < variables.size(); ++v)
+        {
+            _w.variables[v] = variables[v] + _first;
+        }
+
+        unsigned top = 0;
+        for (unsigned i = 0; i < _size; ++i)
+        {
+            const Node& node = _program[i];
+            unsigned arity = node.arity();
+            // the first child is on the top of the stack
+            _w.args.resize(arity);
+            for (unsigned k = 0; k < arity; ++k)
+            {
+                _w.args[k] = _w.stack[top - 1 - k];
+            }
+            top -= arity;
+            const double* const* args = arity > 0 ? & _w.args[0] : 0;
+            const double* const* vars = _w.variables.empty() ? 0 : & _w.variables[0];
+            _w.stack[top] = node.block(& _w.buffers[top * blockSize], args, vars, _n);
+            ++top;
+        }
+        return _w.stack[top - 1];
+    }
+
+    std::vector< std::vector<double> > inputs;
+    std::vector<double> target;
+    unsigned blockSize;
+    /** the first value of every variable */
+    std::vector<const double*> variables;
+    eoSubtreeCache<Node>* cache;
+};
+
+#endif
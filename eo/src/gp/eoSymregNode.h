@@ -0,0 +1,249 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoSymregNode.h : a node for symbolic regression, evaluated point by point or by blocks of points
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoSymregNode_h
+#define eoSymregNode_h
+
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+/** eoSymregNode --> the usual nodes of symbolic regression: the variables, the constants, the four
+operators (with a protected division, which gives 1 when dividing by 0) and a few unary functions.
+
+Besides the point by point evaluation of parse_tree (tree.apply(result, variables), with the values of
+the variables in any indexable container), the node can be evaluated on a whole block of points at
+once, which is what eoSymregBlockEval does, and compared and hashed, for eoSubtreeCache.
+
+\class eoSymregNode eoSymregNode.h gp/eoSymregNode.h
+\ingroup ParseTree
+*/
+class eoSymregNode
+{
+public :
+
+    enum Operator {Variable, Constant, Plus, Minus, Multiplies, Divides, Negate, Sin, Cos};
+
+    /** Default Constructor: the constant 0 */
+    eoSymregNode() : op(Constant), variable(0), value(0.) {}
+
+    /**
+     * Constructor
+     * @param _op the operator
+     * @param _variable the index of the variable, for a Variable
+     * @param _value the value of the constant, for a Constant
+     */
+    eoSymregNode(Operator _op, unsigned _variable = 0, double _value = 0.)
+        : op(_op), variable(_variable), value(_value) {}
+
+    virtual ~eoSymregNode() {}
+
+    /// the arity of the node
+    int arity() const
+    {
+        switch (op)
+        {
+        case Variable :
+        case Constant : return 0;
+        case Negate :
+        case Sin :
+        case Cos : return 1;
+        default : return 2;
+        }
+    }
+
+    void randomize() {}
+
+    /**
+     * Evaluation on a single point
+     * @param _result the value of the subtree
+     * @param _args the children
+     * @param _variables the values of the variables
+     */
+    template <class Children, class It>
+    void operator()(double& _result, Children _args, It _variables) const
+    {
+        double r0(0.), r1(0.);
+        if (arity() > 0)
+            _args[0].apply(r0, _variables);
+        if (arity() > 1)
+            _args[1].apply(r1, _variables);
+
+        switch (op)
+        {
+        case Variable : _result = _variables[variable]; break;
+        case Constant : _result = value; break;
+        case Plus : _result = r0 + r1; break;
+        case Minus : _result = r0 - r1; break;
+        case Multiplies : _result = r0 * r1; break;
+        case Divides : _result = (r1 == 0.) ? 1. : r0 / r1; break;
+        case Negate : _result = -r0; break;
+        case Sin : _result = std::sin(r0); break;
+        case Cos : _result = std::cos(r0); break;
+        }
+    }
+
+    /**
+     * Evaluation on a block of points.
+     * The values of a variable are taken from the data, without any copy. The buffer may be one of the
+     * arguments, the values are thus computed point by point.
+     * @param _buffer where the values can be written
+     * @param _args the values of the children (_args[0] for the first child)
+     * @param _variables the values of every variable
+     * @param _n the number of points
+     * @return the values of the node
+     */
+    const double* block(double* _buffer, const double* const* _args, const double* const* _variables, unsigned _n) const
+    {
+        const double* a = arity() > 0 ? _args[0] : 0;
+        const double* b = arity() > 1 ? _args[1] : 0;
+        unsigned i;
+
+        switch (op)
+        {
+        case Variable : return _variables[variable];
+        case Constant : for (i = 0; i < _n; ++i) _buffer[i] = value; break;
+        case Plus : for (i = 0; i < _n; ++i) _buffer[i] = a[i] + b[i]; break;
+        case Minus : for (i = 0; i < _n; ++i) _buffer[i] = a[i] - b[i]; break;
+        case Multiplies : for (i = 0; i < _n; ++i) _buffer[i] = a[i] * b[i]; break;
+        case Divides :
+            for (i = 0; i < _n; ++i)
+            {
+                double q = a[i] / b[i];
+                _buffer[i] = (b[i] == 0.) ? 1. : q;
+            }
+            break;
+        case Negate : for (i = 0; i < _n; ++i) _buffer[i] = -a[i]; break;
+        case Sin : for (i = 0; i < _n; ++i) _buffer[i] = std::sin(a[i]); break;
+        case Cos : for (i = 0; i < _n; ++i) _buffer[i] = std::cos(a[i]); break;
+        }
+        return _buffer;
+    }
+
+    /// 'Pretty' print to a string
+    template <class Children>
+    void operator()(std::string& _result, Children _args) const
+    {
+        std::string r0, r1;
+        if (arity() > 0)
+            _args[0].apply(r0);
+        if (arity() > 1)
+            _args[1].apply(r1);
+
+        switch (arity())
+        {
+        case 0 : _result = label(); break;
+        case 1 : _result = label() + "(" + r0 + ")"; break;
+        default : _result = "(" + r0 + " " + label() + " " + r1 + ")"; break;
+        }
+    }
+
+    /// the label of the node, as printed in a stream (the constants with all their digits, to be read back)
+    std::string label() const
+    {
+        std::ostringstream os;
+        os.precision(std::numeric_limits<double>::max_digits10);
+        switch (op)
+        {
+        case Variable : os << 'x' << variable; break;
+        case Constant : os << value; break;
+        case Plus : os << '+'; break;
+        case Minus : os << '-'; break;
+        case Multiplies : os << '*'; break;
+        case Divides : os << '/'; break;
+        case Negate : os << "neg"; break;
+        case Sin : os << "sin"; break;
+        case Cos : os << "cos"; break;
+        }
+        return os.str();
+    }
+
+    /// reads the node from its label
+    void readFrom(const std::string& _label)
+    {
+        variable = 0;
+        value = 0.;
+        if (_label == "+") op = Plus;
+        else if (_label == "-") op = Minus;
+        else if (_label == "*") op = Multiplies;
+        else if (_label == "/") op = Divides;
+        else if (_label == "neg") op = Negate;
+        else if (_label == "sin") op = Sin;
+        else if (_label == "cos") op = Cos;
+        else if (!_label.empty() && _label[0] == 'x')
+        {
+            op = Variable;
+            variable = std::atoi(_label.c_str() + 1);
+        }
+        else
+        {
+            op = Constant;
+            value = std::atof(_label.c_str());
+        }
+    }
+
+    /// equality, as needed by eoSubtreeCache
+    bool operator==(const eoSymregNode& _other) const
+    {
+        return (op == _other.op) && (variable == _other.variable) && (value == _other.value);
+    }
+
+    bool operator!=(const eoSymregNode& _other) const { return !operator==(_other); }
+
+    /// hash code, as needed by eoSubtreeCache
+    size_t hash() const
+    {
+        size_t h = std::hash<int>()(op);
+        h = h * 31 + std::hash<unsigned>()(variable);
+        h = h * 31 + std::hash<double>()(value);
+        return h;
+    }
+
+    Operator getOp() const { return op; }
+    unsigned getVariable() const { return variable; }
+    double getValue() const { return value; }
+
+private :
+
+    Operator op;
+    unsigned variable;
+    double value;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const eoSymregNode& node)
+{
+    os << node.label();
+    return os;
+}
+
+inline std::istream& operator>>(std::istream& is, eoSymregNode& node)
+{
+    std::string label;
+    is >> label;
+    node.readFrom(label);
+    return is;
+}
+
+#endif
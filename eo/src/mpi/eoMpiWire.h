@@ -0,0 +1,429 @@
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation;
+    version 2 of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+Contact: http://eodev.sourceforge.net
+*/
+# ifndef __EO_MPI_WIRE_H__
+# define __EO_MPI_WIRE_H__
+
+# include <algorithm> // std::copy
+# include <type_traits> // std::enable_if
+# include <vector> // std::vector
+
+# include "eoMpiNode.h"
+
+template< class FitT > class eoReal;
+template< class FitT, class T > class eoInt;
+template< class FitT, class ScalarT > class eoBit;
+template< class ObjectiveVector, class Fitness, class Diversity > class moeoRealVector;
+template< class ObjectiveVector, class Fitness, class Diversity > class moeoIntVector;
+template< class ObjectiveVector, class Fitness, class Diversity > class moeoBitVector;
+
+/**
+ * @file eoMpiWire.h
+ *
+ * @brief How individuals are sent to and received from the workers.
+ *
+ * By default, individuals are eoserial::Persistent objects, which are written as JSON text and parsed back at the
+ * other end. The representations opting in with eo::mpi::BinaryWire (eoReal, eoInt, eoBit and their moeoVector
+ * counterparts), whose whole state is a vector of atoms having a MPI datatype and a scalar fitness or an objective
+ * vector, are rather sent as contiguous buffers: the lengths of the genomes, a header of doubles (validity and value
+ * of the fitness, and of the objective vector and the diversity of a MOEO) and the concatenation of the genomes.
+ *
+ * Other representations can opt in by specializing eo::mpi::BinaryWire, and eo::mpi::GenomeTraits and
+ * eo::mpi::FitnessTraits if they are not vectors of atoms. The eoserial::Persistent types are always sent as JSON,
+ * with their own pack() and unpack().
+ */
+
+namespace eo
+{
+    namespace mpi
+    {
+        /**
+         * @brief Helper for SFINAE: is void if T is a valid type.
+         */
+        template< class T >
+        struct Void
+        {
+            typedef void type;
+        };
+
+        /**
+         * @brief Is true if EOT is sent in the binary format.
+         *
+         * Only the representations whose whole state is their genome and their fitness can opt in: the subclasses
+         * holding more (velocities, standard deviations, ...) are not, even though their genome is a vector of atoms.
+         *
+         * @ingroup MPI
+         */
+        template< class EOT >
+        struct BinaryWire : public std::false_type {};
+
+        template< class FitT >
+        struct BinaryWire< eoReal< FitT > > : public std::true_type {};
+
+        template< class FitT, class T >
+        struct BinaryWire< eoInt< FitT, T > > : public std::true_type {};
+
+        template< class FitT, class ScalarT >
+        struct BinaryWire< eoBit< FitT, ScalarT > > : public std::true_type {};
+
+        template< class ObjectiveVector, class Fitness, class Diversity >
+        struct BinaryWire< moeoRealVector< ObjectiveVector, Fitness, Diversity > > : public std::true_type {};
+
+        template< class ObjectiveVector, class Fitness, class Diversity >
+        struct BinaryWire< moeoIntVector< ObjectiveVector, Fitness, Diversity > > : public std::true_type {};
+
+        template< class ObjectiveVector, class Fitness, class Diversity >
+        struct BinaryWire< moeoBitVector< ObjectiveVector, Fitness, Diversity > > : public std::true_type {};
+
+        /**
+         * @brief Type in which an atom of a genome is sent: the atom itself, or char for bool (vector<bool> is not
+         * contiguous).
+         */
+        template< class Atom >
+        struct WireAtom
+        {
+            typedef Atom type;
+        };
+
+        template<>
+        struct WireAtom< bool >
+        {
+            typedef char type;
+        };
+
+        /**
+         * @brief How the genome of an EOT is written in a contiguous buffer of atoms.
+         *
+         * Not available by default.
+         *
+         * @ingroup MPI
+         */
+        template< class EOT, class Enable = void >
+        struct GenomeTraits
+        {
+            static const bool available = false;
+        };
+
+        /**
+         * @brief Genome traits of the vectors of arithmetic atoms (eoVector, moeoVector).
+         */
+        template< class EOT >
+        struct GenomeTraits< EOT, typename std::enable_if<
+            std::is_arithmetic< typename EOT::AtomType >::value &&
+            std::is_base_of< std::vector< typename EOT::AtomType >, EOT >::value >::type >
+        {
+            static const bool available = true;
+
+            typedef typename WireAtom< typename EOT::AtomType >::type Atom;
+
+            static int size( const EOT& eo ) { return eo.size(); }
+
+            static void pack( const EOT& eo, Atom* out )
+            {
+                std::copy( eo.begin(), eo.end(), out );
+            }
+
+            static void unpack( const Atom* in, int size, EOT& eo )
+            {
+                eo.resize( size );
+                std::copy( in, in + size, eo.begin() );
+            }
+        };
+
+        /**
+         * @brief Is true if EOT has an objective vector (i.e. is a MOEO).
+         */
+        template< class EOT, class Enable = void >
+        struct HasObjectiveVector : public std::false_type {};
+
+        template< class EOT >
+        struct HasObjectiveVector< EOT, typename Void< typename EOT::ObjectiveVector >::type > : public std::true_type {};
+
+        /**
+         * @brief How the result of an evaluation is written in a buffer of doubles: the first one is 1 if the result
+         * is invalid, 0 otherwise, followed by width() values.
+         *
+         * Not available by default.
+         *
+         * @ingroup MPI
+         */
+        template< class EOT, class Enable = void >
+        struct FitnessTraits
+        {
+            static const bool available = false;
+        };
+
+        /**
+         * @brief Fitness traits of the individuals whose fitness is a scalar.
+         */
+        template< class EOT >
+        struct FitnessTraits< EOT, typename std::enable_if<
+            !HasObjectiveVector< EOT >::value &&
+            std::is_convertible< typename EOT::Fitness, double >::value >::type >
+        {
+            static const bool available = true;
+
+            static int width() { return 1; }
+
+            static void pack( const EOT& eo, double* out )
+            {
+                out[0] = eo.invalid() ? 1. : 0.;
+                out[1] = eo.invalid() ? 0. : static_cast<double>( eo.fitness() );
+            }
+
+            static void unpack( const double* in, EOT& eo )
+            {
+                if( in[0] != 0. )
+                {
+                    eo.invalidate();
+                } else {
+                    eo.fitness( typename EOT::Fitness( in[1] ) );
+                }
+            }
+        };
+
+        /**
+         * @brief Fitness traits of the multi-objective individuals whose fitness and diversity are scalars: the
+         * objective vector, followed by the validity and value of the fitness and of the diversity.
+         */
+        template< class EOT >
+        struct FitnessTraits< EOT, typename std::enable_if<
+            HasObjectiveVector< EOT >::value &&
+            std::is_convertible< typename EOT::Fitness, double >::value &&
+            std::is_convertible< typename EOT::Diversity, double >::value >::type >
+        {
+            static const bool available = true;
+
+            typedef typename EOT::ObjectiveVector ObjectiveVector;
+
+            static int width() { return ObjectiveVector::nObjectives() + 4; }
+
+            static void pack( const EOT& eo, double* out )
+            {
+                const int m = ObjectiveVector::nObjectives();
+                out[0] = eo.invalidObjectiveVector() ? 1. : 0.;
+                for( int i = 0; i < m; ++i )
+                {
+                    out[i + 1] = eo.invalidObjectiveVector() ? 0. : static_cast<double>( eo.objectiveVector( i ) );
+                }
+                out[m + 1] = eo.invalidFitness() ? 1. : 0.;
+                out[m + 2] = eo.invalidFitness() ? 0. : static_cast<double>( eo.fitness() );
+                out[m + 3] = eo.invalidDiversity() ? 1. : 0.;
+                out[m + 4] = eo.invalidDiversity() ? 0. : static_cast<double>( eo.diversity() );
+            }
+
+            static void unpack( const double* in, EOT& eo )
+            {
+                const int m = ObjectiveVector::nObjectives();
+                if( in[0] != 0. )
+                {
+                    eo.invalidateObjectiveVector();
+                } else {
+                    ObjectiveVector objectives;
+                    for( int i = 0; i < m; ++i )
+                    {
+                        objectives[i] = typename ObjectiveVector::Type( in[i + 1] );
+                    }
+                    eo.objectiveVector( objectives );
+                }
+                if( in[m + 1] != 0. )
+                {
+                    eo.invalidateFitness();
+                } else {
+                    eo.fitness( typename EOT::Fitness( in[m + 2] ) );
+                }
+                if( in[m + 3] != 0. )
+                {
+                    eo.invalidateDiversity();
+                } else {
+                    eo.diversity( typename EOT::Diversity( in[m + 4] ) );
+                }
+            }
+        };
+
+        /**
+         * @brief Is true if EOT opted in the binary format, is not eoserial::Persistent, and has traits for its genome
+         * and its fitness.
+         */
+        template< class EOT >
+        struct BinaryTraits
+        {
+            static const bool available = BinaryWire< EOT >::value &&
+                !std::is_base_of< eoserial::Persistent, EOT >::value &&
+                GenomeTraits< EOT >::available && FitnessTraits< EOT >::available;
+        };
+
+        /**
+         * @brief Sends and receives packets of individuals, choosing the binary format when it is available.
+         *
+         * A Wire keeps its buffers from one packet to another, so as to avoid reallocations. The results of a packet
+         * can be sent back either as whole individuals, or as their fitnesses only (resultsOnly), when the applied
+         * function does not change the genome, like an evaluation. Only the binary format makes the difference, JSON
+         * packets always carry whole individuals.
+         *
+         * @ingroup MPI
+         */
+        template< class EOT, bool Binary = BinaryTraits< EOT >::available >
+        class Wire
+        {
+            public:
+
+            /**
+             * @brief Sends size individuals, starting from table, to dest.
+             */
+            void send( bmpi::communicator& comm, int dest, int tag, EOT* table, int size )
+            {
+                comm.send( dest, tag, table, size );
+            }
+
+            /**
+             * @brief Receives size individuals from src, in table (which must have been allocated by the user).
+             */
+            void recv( bmpi::communicator& comm, int src, int tag, EOT* table, int size )
+            {
+                comm.recv( src, tag, table, size );
+            }
+
+            /**
+             * @brief Sends the results of the application of the function to size individuals.
+             */
+            void sendResults( bmpi::communicator& comm, int dest, int tag, EOT* table, int size, bool resultsOnly )
+            {
+                (void)resultsOnly;
+                send( comm, dest, tag, table, size );
+            }
+
+            /**
+             * @brief Receives the results of the application of the function to size individuals.
+             */
+            void recvResults( bmpi::communicator& comm, int src, int tag, EOT* table, int size, bool resultsOnly )
+            {
+                (void)resultsOnly;
+                recv( comm, src, tag, table, size );
+            }
+        };
+
+        /**
+         * @brief Binary implementation of the Wire.
+         *
+         * A packet of individuals is sent as a buffer of the lengths of the genomes, a buffer of doubles holding the
+         * fitness of each individual (see FitnessTraits), and a buffer of the concatenated genomes. The results only
+         * consist in the fitnesses.
+         */
+        template< class EOT >
+        class Wire< EOT, true >
+        {
+            public:
+
+            typedef GenomeTraits< EOT > Genome;
+            typedef FitnessTraits< EOT > Fitness;
+            typedef typename Genome::Atom Atom;
+
+            void send( bmpi::communicator& comm, int dest, int tag, EOT* table, int size )
+            {
+                const int stride = 1 + Fitness::width();
+                _lengths.resize( size );
+                _header.resize( size * stride );
+
+                int total = 0;
+                for( int i = 0; i < size; ++i )
+                {
+                    _lengths[i] = Genome::size( table[i] );
+                    Fitness::pack( table[i], & _header[ i * stride ] );
+                    total += _lengths[i];
+                }
+
+                _genomes.resize( total );
+                int offset = 0;
+                for( int i = 0; i < size; ++i )
+                {
+                    Genome::pack( table[i], _genomes.data() + offset );
+                    offset += _lengths[i];
+                }
+
+                comm.send_values( dest, tag, _lengths.data(), size );
+                comm.send_values( dest, tag, _header.data(), _header.size() );
+                comm.send_values( dest, tag, _genomes.data(), total );
+            }
+
+            void recv( bmpi::communicator& comm, int src, int tag, EOT* table, int size )
+            {
+                const int stride = 1 + Fitness::width();
+                _lengths.resize( size );
+                _header.resize( size * stride );
+                comm.recv_values( src, tag, _lengths.data(), size );
+                comm.recv_values( src, tag, _header.data(), _header.size() );
+
+                int total = 0;
+                for( int i = 0; i < size; ++i )
+                {
+                    total += _lengths[i];
+                }
+                _genomes.resize( total );
+                comm.recv_values( src, tag, _genomes.data(), total );
+
+                int offset = 0;
+                for( int i = 0; i < size; ++i )
+                {
+                    Genome::unpack( _genomes.data() + offset, _lengths[i], table[i] );
+                    Fitness::unpack( & _header[ i * stride ], table[i] );
+                    offset += _lengths[i];
+                }
+            }
+
+            void sendResults( bmpi::communicator& comm, int dest, int tag, EOT* table, int size, bool resultsOnly )
+            {
+                if( !resultsOnly )
+                {
+                    send( comm, dest, tag, table, size );
+                    return;
+                }
+
+                const int stride = 1 + Fitness::width();
+                _header.resize( size * stride );
+                for( int i = 0; i < size; ++i )
+                {
+                    Fitness::pack( table[i], & _header[ i * stride ] );
+                }
+                comm.send_values( dest, tag, _header.data(), _header.size() );
+            }
+
+            void recvResults( bmpi::communicator& comm, int src, int tag, EOT* table, int size, bool resultsOnly )
+            {
+                if( !resultsOnly )
+                {
+                    recv( comm, src, tag, table, size );
+                    return;
+                }
+
+                const int stride = 1 + Fitness::width();
+                _header.resize( size * stride );
+                comm.recv_values( src, tag, _header.data(), _header.size() );
+                for( int i = 0; i < size; ++i )
+                {
+                    Fitness::unpack( & _header[ i * stride ], table[i] );
+                }
+            }
+
+            protected:
+            std::vector< int > _lengths;
+            std::vector< double > _header;
+            std::vector< Atom > _genomes;
+        };
+    }
+}
+
+# endif // __EO_MPI_WIRE_H__
@@ -23,6 +23,7 @@ Authors:
 # define __EO_PARALLEL_APPLY_H__
 
 # include "eoMpi.h"
+# include "eoMpiWire.h"
 
 # include "../eoFunctor.h" // eoUF
 # include <vector> // std::vector population
@@ -47,6 +48,10 @@ Authors:
  *
  * This job is the parallel equivalent to the function apply<EOT>, defined in apply.h. It just applies the function to
  * every element of a table. In Python or Javascript, it's the equivalent of the function Map.
+ *
+ * Elements are sent in the binary format of eoMpiWire.h when their representation opted in (eoReal, eoInt, eoBit,
+ * see eo::mpi::BinaryWire), and as eoserial::Persistent objects otherwise. If the function only changes the fitness of
+ * the elements (resultsOnly), the workers then only send back the fitnesses.
  */
 
 namespace eo
@@ -98,7 +103,7 @@ namespace eo
                     int _packetSize,
                     std::vector<EOT> * table = 0
                    ) :
-                _table( table ), func( _proc ), index( 0 ), packetSize( _packetSize ), masterRank( _masterRank ), comm( Node::comm() )
+                _table( table ), func( _proc ), index( 0 ), packetSize( _packetSize ), resultsOnly( false ), masterRank( _masterRank ), comm( Node::comm() )
             {
                 if ( _packetSize <= 0 )
                 {
@@ -136,6 +141,10 @@ namespace eo
             int packetSize;
             std::vector<EOT> tempArray;
 
+            // Does the function only change the fitness? Must be the same on the master and the workers.
+            bool resultsOnly;
+            Wire<EOT> wire;
+
             int masterRank;
             bmpi::communicator& comm;
         };
@@ -175,12 +184,12 @@ namespace eo
 
                 _data->comm.send( wrkRank, eo::mpi::Channel::Messages, sentSize );
 
-                eo::log << eo::debug << "Evaluating individual " << _data->index << std::endl;
+                EO_LOG(eo::debug) << "Evaluating individual " << _data->index << std::endl;
 
                 _data->assignedTasks[ wrkRank ].index = _data->index;
                 _data->assignedTasks[ wrkRank ].size = sentSize;
 
-                _data->comm.send( wrkRank, eo::mpi::Channel::Messages, & ( (_data->table())[ _data->index ] ) , sentSize );
+                _data->wire.send( _data->comm, wrkRank, eo::mpi::Channel::Messages, & ( (_data->table())[ _data->index ] ) , sentSize );
                 _data->index = futureIndex;
             }
         };
@@ -203,7 +212,7 @@ namespace eo
 
             void operator()(int wrkRank)
             {
-                _data->comm.recv( wrkRank, eo::mpi::Channel::Messages, & (_data->table()[ _data->assignedTasks[wrkRank].index ] ), _data->assignedTasks[wrkRank].size );
+                _data->wire.recvResults( _data->comm, wrkRank, eo::mpi::Channel::Messages, & (_data->table()[ _data->assignedTasks[wrkRank].index ] ), _data->assignedTasks[wrkRank].size, _data->resultsOnly );
             }
         };
 
@@ -232,14 +241,14 @@ namespace eo
 
                 _data->comm.recv( _data->masterRank, eo::mpi::Channel::Messages, recvSize );
                 _data->tempArray.resize( recvSize );
-                _data->comm.recv( _data->masterRank, eo::mpi::Channel::Messages, & _data->tempArray[0] , recvSize );
+                _data->wire.recv( _data->comm, _data->masterRank, eo::mpi::Channel::Messages, & _data->tempArray[0] , recvSize );
                 timerStat.start("worker_processes");
                 for( int i = 0; i < recvSize ; ++i )
                 {
                     _data->func( _data->tempArray[ i ] );
                 }
                 timerStat.stop("worker_processes");
-                _data->comm.send( _data->masterRank, eo::mpi::Channel::Messages, & _data->tempArray[0], recvSize );
+                _data->wire.sendResults( _data->comm, _data->masterRank, eo::mpi::Channel::Messages, & _data->tempArray[0], recvSize, _data->resultsOnly );
             }
         };
 
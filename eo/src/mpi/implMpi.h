@@ -22,7 +22,8 @@ Authors:
 #ifndef __EO_IMPL_MPI_HPP__
 #define __EO_IMPL_MPI_HPP__
 
-#include "eoMpi.h"
+#include <mpi.h>
+
 #include "../serial/eoSerial.h"
 
 /**
@@ -34,7 +35,7 @@ Authors:
  * Because the Boost::MPI API is really clean, we reused it in this module. However, all
  * the functions of Boost::MPI were not used, hence a subset of the API is reused. For
  * instance, users can just send integer, std::string or eoserial::Persistent objects;
- * furthermore, only eoserial::Persistent objects can sent in a table.
+ * furthermore, only eoserial::Persistent objects and values having a MPI datatype can sent in a table.
  *
  * The documentation of the functions is exactly the same as the official Boost::MPI
  * documentation. You can find it on www.boost.org/doc/libs/1_49_0/doc/html/mpi/
@@ -83,6 +84,25 @@ namespace mpi
         ~environment();
     };
 
+    /**
+     * @brief MPI datatype of a C++ type, for the types which can be sent as plain arrays.
+     *
+     * Only the specializations are defined.
+     */
+    template< class T > MPI_Datatype datatype();
+
+    template<> inline MPI_Datatype datatype< char >() { return MPI_CHAR; }
+    template<> inline MPI_Datatype datatype< unsigned char >() { return MPI_UNSIGNED_CHAR; }
+    template<> inline MPI_Datatype datatype< short >() { return MPI_SHORT; }
+    template<> inline MPI_Datatype datatype< unsigned short >() { return MPI_UNSIGNED_SHORT; }
+    template<> inline MPI_Datatype datatype< int >() { return MPI_INT; }
+    template<> inline MPI_Datatype datatype< unsigned int >() { return MPI_UNSIGNED; }
+    template<> inline MPI_Datatype datatype< long >() { return MPI_LONG; }
+    template<> inline MPI_Datatype datatype< unsigned long >() { return MPI_UNSIGNED_LONG; }
+    template<> inline MPI_Datatype datatype< float >() { return MPI_FLOAT; }
+    template<> inline MPI_Datatype datatype< double >() { return MPI_DOUBLE; }
+    template<> inline MPI_Datatype datatype< long double >() { return MPI_LONG_DOUBLE; }
+
     /**
      * @brief Wrapper class for MPI_Status
      *
@@ -271,6 +291,40 @@ namespace mpi
             delete obj;
         }
 
+        /*
+         * SEND / RECV plain arrays
+         */
+
+        /**
+         * @brief Sends an array of values having a MPI datatype (see mpi::datatype) to dest on channel "tag", as a
+         * single contiguous message, without any serialization.
+         *
+         * @param dest MPI rank of the receiver
+         * @param tag MPI tag of message
+         * @param values The array of values
+         * @param count The number of values to send
+         */
+        template< class T >
+        void send_values( int dest, int tag, const T* values, int count )
+        {
+            MPI_Send( const_cast<T*>( values ), count, datatype<T>(), dest, tag, MPI_COMM_WORLD );
+        }
+
+        /**
+         * @brief Receives an array of values having a MPI datatype from src on channel "tag".
+         *
+         * @param src MPI rank of the sender
+         * @param tag MPI tag of message
+         * @param values Where to save the values. It must have been allocated by the user.
+         * @param count The number of values to receive
+         */
+        template< class T >
+        void recv_values( int src, int tag, T* values, int count )
+        {
+            MPI_Status stat;
+            MPI_Recv( values, count, datatype<T>(), src, tag, MPI_COMM_WORLD, &stat );
+        }
+
         /*
          * Other methods
          */
@@ -53,7 +53,7 @@ public:
         double count = static_cast<double>( std::count_if( pop.begin(), pop.end(), eoIsFeasible<EOT> ) );
         double size = static_cast<double>( pop.size() );
         double ratio = count/size;
-        eo::log << eo::xdebug << "eoFeasibleRatioStat: " << count << " / " << size << " = " << ratio << std::endl;
+        EO_LOG(eo::xdebug) << "eoFeasibleRatioStat: " << count << " / " << size << " = " << ratio << std::endl;
         value() = ratio;
 #else
         value() = static_cast<double>( std::count_if( pop.begin(), pop.end(), eoIsFeasible<EOT> ) ) / static_cast<double>( pop.size() );
@@ -0,0 +1,360 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoFusedFitnessStat.h
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef _eoFusedFitnessStat_h
+#define _eoFusedFitnessStat_h
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "eoStat.h"
+#include "eoDistance.h"
+#include "eoParam.h"
+
+/** @addtogroup Stats
+ * @{
+ */
+
+/**
+    All the statistics on the fitnesses of a population, computed together.
+
+    The usual statistics (eoAverageStat, eoSecondMomentStats, eoBestFitnessStat,
+    eoNthElementFitnessStat, eoNthElementStat, eoInterquartileRangeStat,
+    eoScalarFitnessStat, eoFDCStat) each walk the population, and the ones on the
+    order of the fitnesses each sort it. This statistic copies the fitnesses once
+    into a contiguous buffer, then computes all the statistics which were asked
+    for in a single pass over it, by chunks (in parallel if requested, with
+    OpenMP), and the ones on the order of the fitnesses on a single sorted copy.
+
+    Every statistic is asked for with the method of the same name, which returns
+    the eoValueParam holding its value, to be given to any monitor:
+    @code
+    eoFusedFitnessStat<EOT> stats;
+    checkpoint.add(stats);
+    monitor.add(stats.best());
+    monitor.add(stats.secondMoment());
+    monitor.add(stats.quantile(0.5, "Median"));
+    @endcode
+    The values are those of the corresponding eoStat, up to the rounding of the
+    sums, which are added by chunks. They do not depend on the number of threads.
+
+    The fitness must be scalar, i.e. convertible to and from a double.
+
+    @ingroup Stats
+*/
+template <class EOT>
+class eoFusedFitnessStat : public eoStatBase<EOT>
+{
+public:
+
+    typedef typename EOT::Fitness Fitness;
+    typedef std::pair<double, double> SquarePair;
+
+    /**
+     * @param _parallel whether the passes are run in parallel (with OpenMP)
+     * @param _chunkSize the number of fitnesses reduced together
+     */
+    eoFusedFitnessStat(bool _parallel = false, unsigned _chunkSize = 4096)
+        : parallel(_parallel), chunkSize(std::max(_chunkSize, 1u)), dist(0)
+    {}
+
+    /// the average fitness, as eoAverageStat
+    eoValueParam<Fitness>& average(std::string _description = "Average Fitness")
+    {
+        return param(averageParam, Fitness(), _description);
+    }
+
+    /// the average fitness and its standard deviation, as eoSecondMomentStats
+    eoValueParam<SquarePair>& secondMoment(std::string _description = "Average & Stdev")
+    {
+        return param(secondMomentParam, std::make_pair(0.0, 0.0), _description);
+    }
+
+    /// the best fitness, as eoBestFitnessStat
+    eoValueParam<Fitness>& best(std::string _description = "Best ")
+    {
+        return param(bestParam, Fitness(), _description);
+    }
+
+    /// the worst fitness
+    eoValueParam<Fitness>& worst(std::string _description = "Worst ")
+    {
+        return param(worstParam, Fitness(), _description);
+    }
+
+    /// the fitness of the _which-th individual from the best, as eoNthElementFitnessStat
+    eoValueParam<Fitness>& nthElement(unsigned _which, std::string _description = "nth element fitness")
+    {
+        orders.push_back(Order(_description, false, _which));
+        return orders.back().param;
+    }
+
+    /// the fitness at the given ratio of the population from the worst, as eoNthElementStat
+    eoValueParam<Fitness>& quantile(double _ratio, std::string _description = "Median")
+    {
+        orders.push_back(Order(_description, true, _ratio));
+        return orders.back().param;
+    }
+
+    /// the difference between the third and the first quartiles, as eoInterquartileRangeStat
+    eoValueParam<Fitness>& interquartileRange(std::string _description = "IQR")
+    {
+        return param(iqrParam, Fitness(), _description);
+    }
+
+    /// all the fitnesses, from the best, as eoScalarFitnessStat (without bounds)
+    eoValueParam< std::vector<double> >& fitnesses(std::string _description = "FitnessES")
+    {
+        return param(fitnessesParam, std::vector<double>(), _description);
+    }
+
+    /** the fitness distance correlation with the best individual, as eoFDCStat
+     *
+     * The distance is called from several threads when the stat is parallel.
+     */
+    eoValueParam<double>& fdc(eoDistance<EOT>& _dist, std::string _description = "FDC")
+    {
+        dist = &_dist;
+        return param(fdcParam, 0.0, _description);
+    }
+
+    /// the fitnesses of the last population, from the best (only if a statistic on the order was asked for)
+    const std::vector<double>& sorted() const { return sortedValues; }
+
+    virtual void operator()(const eoPop<EOT>& _pop)
+    {
+        const int n = _pop.size();
+        if (n == 0)
+            return;
+
+        // the fitnesses, once
+        values.resize(n);
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+        for (int i = 0; i < n; ++i)
+            values[i] = _pop[i].fitness();
+
+        Chunk total = reduce(n);
+        if (fdcParam)
+        {
+            // the distances to the best, then their sums
+            const EOT& theBest = _pop[total.best];
+            distances.resize(n);
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+            for (int i = 0; i < n; ++i)
+                distances[i] = (*dist)(_pop[i], theBest);
+            reduceDistances(n, total);
+        }
+
+        double avg = total.sum / n;
+        if (averageParam)
+            averageParam->value() = Fitness(avg);
+        if (secondMomentParam)
+        {
+            secondMomentParam->value().first = avg;
+            secondMomentParam->value().second = std::sqrt((total.sumSq - n * avg * avg) / (n - 1.0));
+        }
+        if (bestParam)
+            bestParam->value() = _pop[total.best].fitness();
+        if (worstParam)
+            worstParam->value() = _pop[total.worst].fitness();
+        if (fdcParam)
+        {
+            // the covariance, around the averages
+            double avgDist = total.sumDist / n;
+            double num = total.sumFitDist - n * avg * avgDist;
+            double varFit = total.sumSq - n * avg * avg;
+            double varDist = total.sumDistSq - n * avgDist * avgDist;
+            fdcParam->value() = num / (std::sqrt(varDist) * std::sqrt(varFit));
+        }
+
+        // the statistics on the order share a single sort
+        if (orders.empty() && !iqrParam && !fitnessesParam)
+            return;
+        sortedValues = values;
+        if (isMinimizing())
+            std::sort(sortedValues.begin(), sortedValues.end());
+        else
+            std::sort(sortedValues.begin(), sortedValues.end(), std::greater<double>());
+
+        for (typename std::list<Order>::iterator it = orders.begin(); it != orders.end(); ++it)
+        {
+            unsigned which;
+            if (it->fromRatio)  // from the worst
+                which = n - 1 - static_cast<unsigned>(std::floor(n * it->position));
+            else
+                which = static_cast<unsigned>(it->position);
+            if (which >= (unsigned) n)
+                throw eoException("fitness requested of element outside of pop");
+            it->param.value() = Fitness(sortedValues[which]);
+        }
+        if (iqrParam)
+        {
+            unsigned quartile = n / 4;
+            iqrParam->value() = Fitness(sortedValues[n - 1 - 3 * quartile]) - Fitness(sortedValues[n - 1 - quartile]);
+        }
+        if (fitnessesParam)
+            fitnessesParam->value() = sortedValues;
+    }
+
+    virtual std::string className(void) const { return "eoFusedFitnessStat"; }
+
+private:
+
+    /** A statistic on the order */
+    struct Order
+    {
+        Order(std::string _description, bool _fromRatio, double _position)
+            : param(Fitness(), _description), fromRatio(_fromRatio), position(_position) {}
+
+        eoValueParam<Fitness> param;
+        bool fromRatio;
+        double position;
+    };
+
+    /** The reductions of a chunk of the population */
+    struct Chunk
+    {
+        double sum, sumSq, sumDist, sumDistSq, sumFitDist;
+        unsigned best, worst;
+    };
+
+    template <class T>
+    eoValueParam<T>& param(std::unique_ptr< eoValueParam<T> >& _param, T _default, std::string _description)
+    {
+        if (!_param)
+            _param.reset(new eoValueParam<T>(_default, _description));
+        return *_param;
+    }
+
+    bool isMinimizing() const
+    {
+        return Fitness(1.0) < Fitness(0.0);
+    }
+
+    /** The fused pass: every chunk is reduced, possibly in parallel, then the
+     * chunks are combined in order, so that the result does not depend on the threads.
+     */
+    Chunk reduce(int _n)
+    {
+        const int nChunks = (_n + chunkSize - 1) / chunkSize;
+        chunks.resize(nChunks);
+        const bool minimizing = isMinimizing();
+
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+        for (int c = 0; c < nChunks; ++c)
+        {
+            const unsigned first = c * chunkSize;
+            const unsigned last = std::min<unsigned>(first + chunkSize, _n);
+            Chunk& chunk = chunks[c];
+            chunk.sum = chunk.sumSq = chunk.sumDist = chunk.sumDistSq = chunk.sumFitDist = 0.0;
+            chunk.best = chunk.worst = first;
+            for (unsigned i = first; i < last; ++i)
+            {
+                const double f = values[i];
+                chunk.sum += f;
+                chunk.sumSq += f * f;
+                if (better(f, values[chunk.best], minimizing))
+                    chunk.best = i;
+                if (better(values[chunk.worst], f, minimizing))
+                    chunk.worst = i;
+            }
+        }
+
+        Chunk total = chunks[0];
+        for (int c = 1; c < nChunks; ++c)
+        {
+            const Chunk& chunk = chunks[c];
+            total.sum += chunk.sum;
+            total.sumSq += chunk.sumSq;
+            if (better(values[chunk.best], values[total.best], minimizing))
+                total.best = chunk.best;
+            if (better(values[total.worst], values[chunk.worst], minimizing))
+                total.worst = chunk.worst;
+        }
+        return total;
+    }
+
+    /** The sums on the distances, by chunks as well */
+    void reduceDistances(int _n, Chunk& _total)
+    {
+        const int nChunks = chunks.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for if(parallel)
+#endif
+        for (int c = 0; c < nChunks; ++c)
+        {
+            const unsigned first = c * chunkSize;
+            const unsigned last = std::min<unsigned>(first + chunkSize, _n);
+            Chunk& chunk = chunks[c];
+            for (unsigned i = first; i < last; ++i)
+            {
+                const double d = distances[i];
+                chunk.sumDist += d;
+                chunk.sumDistSq += d * d;
+                chunk.sumFitDist += d * values[i];
+            }
+        }
+
+        for (int c = 0; c < nChunks; ++c)
+        {
+            _total.sumDist += chunks[c].sumDist;
+            _total.sumDistSq += chunks[c].sumDistSq;
+            _total.sumFitDist += chunks[c].sumFitDist;
+        }
+    }
+
+    static bool better(double _a, double _b, bool _minimizing)
+    {
+        return _minimizing ? _a < _b : _a > _b;
+    }
+
+    bool parallel;
+    unsigned chunkSize;
+    eoDistance<EOT>* dist;
+
+    std::unique_ptr< eoValueParam<Fitness> > averageParam;
+    std::unique_ptr< eoValueParam<SquarePair> > secondMomentParam;
+    std::unique_ptr< eoValueParam<Fitness> > bestParam;
+    std::unique_ptr< eoValueParam<Fitness> > worstParam;
+    std::unique_ptr< eoValueParam<Fitness> > iqrParam;
+    std::unique_ptr< eoValueParam< std::vector<double> > > fitnessesParam;
+    std::unique_ptr< eoValueParam<double> > fdcParam;
+    std::list<Order> orders;
+
+    std::vector<double> values;
+    std::vector<double> distances;
+    std::vector<double> sortedValues;
+    std::vector<Chunk> chunks;
+};
+
+/** @} */
+#endif
@@ -33,13 +33,308 @@ Caner Candan <caner.candan@thalesgroup.com>
 #endif // ! _WIN32
 
 #include <fcntl.h>
+#include <cerrno>
 #include <cstdlib>
 #include <cstdio> // used to define EOF
+#include <cstring>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <list>
+#include <mutex>
+#include <thread>
 
 #include "eoLogger.h"
 
+namespace
+{
+    //! writes the whole data, whatever the number of bytes taken by each call to write
+    void writeAll(int fd, const char* data, size_t size)
+    {
+        while (size > 0)
+            {
+                long n = ::write(fd, data, size);
+                if (n < 0 && errno == EINTR) { continue; }
+                if (n <= 0) { return; }
+                data += n;
+                size -= n;
+            }
+    }
+}
+
+/**
+ * Each thread appends its messages, prefixed with their file descriptor and
+ * their size, to its own ring buffer, in which it is the only writer and the
+ * background thread the only reader: they only share the positions of the
+ * ring, as atomics. The background thread wakes up every few milliseconds,
+ * or when a ring is half full, and writes the consecutive messages going to
+ * the same file descriptor with a single call to write.
+ */
+class eoLogger::Writer
+{
+public:
+    /**
+     * The ring buffer of a thread, and the message it is formatting.
+     */
+    struct Buffer
+    {
+        Buffer() : ring(capacity), head(0), tail(0), id(std::this_thread::get_id()) {}
+
+        std::vector<char> ring;
+        std::atomic<size_t> head; // where the thread appends, only written by it
+        std::atomic<size_t> tail; // where the background thread reads, only written by it
+        std::string line;
+        std::thread::id id;
+    };
+
+    //! the size of a ring, a power of 2
+    static const size_t capacity = 1 << 16;
+
+    Writer() : _running(false), _stop(false), _requested(0), _done(0) {}
+
+    ~Writer() { stop(-1); }
+
+    //! the buffer of the calling thread, created on its first message
+    Buffer& buffer();
+
+    //! appends the message of the buffer, then waits until it is written if asked to
+    void commit(Buffer& buffer, int fd, bool synchronous);
+
+    //! waits until the messages in the rings are written
+    void wait();
+
+    //! writes the remaining messages, the unfinished ones to fd, and stops the background thread
+    void stop(int fd);
+
+private:
+    void push(Buffer& buffer, int fd, const char* data, size_t size);
+    void copy(Buffer& buffer, size_t at, const void* data, size_t size);
+    void read(Buffer& buffer, size_t at, void* data, size_t size);
+    void start();
+    void wake();
+    void run();
+    void drain();
+
+    std::list< std::unique_ptr<Buffer> > _buffers;
+    std::mutex _buffersMutex;
+
+    std::thread _thread;
+    bool _running;
+    std::atomic<bool> _stop;
+    unsigned long _requested;
+    unsigned long _done;
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    std::condition_variable _drained;
+
+    std::string _batch;
+};
+
+namespace
+{
+    /** The buffer of the calling thread, and the writer it belongs to */
+    struct BufferCache
+    {
+        const void* writer;
+        void* buffer;
+    };
+
+    thread_local BufferCache bufferCache = {0, 0};
+}
+
+eoLogger::Writer::Buffer& eoLogger::Writer::buffer()
+{
+    if (bufferCache.writer == this)
+        {
+            return *static_cast<Buffer*>(bufferCache.buffer);
+        }
+
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    Buffer* found = NULL;
+    for (std::list< std::unique_ptr<Buffer> >::iterator it = _buffers.begin(); it != _buffers.end(); ++it)
+        {
+            if ((*it)->id == std::this_thread::get_id()) { found = it->get(); }
+        }
+    if (found == NULL)
+        {
+            _buffers.push_back(std::unique_ptr<Buffer>(new Buffer()));
+            found = _buffers.back().get();
+            start();
+        }
+    bufferCache.writer = this;
+    bufferCache.buffer = found;
+    return *found;
+}
+
+void eoLogger::Writer::copy(Buffer& buffer, size_t at, const void* data, size_t size)
+{
+    size_t begin = at & (capacity - 1);
+    size_t first = std::min(size, capacity - begin);
+    std::memcpy(&buffer.ring[begin], data, first);
+    std::memcpy(&buffer.ring[0], static_cast<const char*>(data) + first, size - first);
+}
+
+void eoLogger::Writer::read(Buffer& buffer, size_t at, void* data, size_t size)
+{
+    size_t begin = at & (capacity - 1);
+    size_t first = std::min(size, capacity - begin);
+    std::memcpy(data, &buffer.ring[begin], first);
+    std::memcpy(static_cast<char*>(data) + first, &buffer.ring[0], size - first);
+}
+
+void eoLogger::Writer::push(Buffer& buffer, int fd, const char* data, size_t size)
+{
+    size_t needed = sizeof(int) + sizeof(size_t) + size;
+    if (needed > capacity)
+        {
+            // too long for the ring: written at once, after the previous messages
+            wait();
+            writeAll(fd, data, size);
+            return;
+        }
+
+    size_t head = buffer.head.load(std::memory_order_relaxed);
+    if (head + needed - buffer.tail.load(std::memory_order_acquire) > capacity)
+        {
+            wait();
+        }
+
+    copy(buffer, head, &fd, sizeof(int));
+    copy(buffer, head + sizeof(int), &size, sizeof(size_t));
+    copy(buffer, head + sizeof(int) + sizeof(size_t), data, size);
+    buffer.head.store(head + needed, std::memory_order_release);
+
+    if (head + needed - buffer.tail.load(std::memory_order_relaxed) > capacity / 2)
+        {
+            wake();
+        }
+}
+
+void eoLogger::Writer::commit(Buffer& buffer, int fd, bool synchronous)
+{
+    if (buffer.line.empty()) { return; }
+
+    push(buffer, fd, buffer.line.data(), buffer.line.size());
+    buffer.line.clear();
+    // once stopped, nothing is written in the background any more
+    if (synchronous || _stop)
+        {
+            wait();
+        }
+}
+
+void eoLogger::Writer::start()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_running && !_stop)
+        {
+            _running = true;
+            _thread = std::thread(&eoLogger::Writer::run, this);
+        }
+}
+
+void eoLogger::Writer::wake()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_requested;
+    _wakeup.notify_one();
+}
+
+void eoLogger::Writer::wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_running)
+        {
+            // no background thread yet, or any more: the caller writes
+            lock.unlock();
+            drain();
+            return;
+        }
+    unsigned long request = ++_requested;
+    _wakeup.notify_one();
+    while (_done < request)
+        {
+            _drained.wait(lock);
+        }
+}
+
+void eoLogger::Writer::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+        {
+            _wakeup.wait_for(lock, std::chrono::milliseconds(10), [this] { return _requested != _done || _stop; });
+            unsigned long request = _requested;
+            bool stopping = _stop;
+            lock.unlock();
+
+            drain();
+
+            lock.lock();
+            _done = request;
+            _drained.notify_all();
+            if (stopping) { break; }
+        }
+}
+
+void eoLogger::Writer::drain()
+{
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    for (std::list< std::unique_ptr<Buffer> >::iterator it = _buffers.begin(); it != _buffers.end(); ++it)
+        {
+            Buffer& buffer = **it;
+            size_t tail = buffer.tail.load(std::memory_order_relaxed);
+            size_t head = buffer.head.load(std::memory_order_acquire);
+            int batchFd = -1;
+            while (tail != head)
+                {
+                    int fd;
+                    size_t size;
+                    read(buffer, tail, &fd, sizeof(int));
+                    read(buffer, tail + sizeof(int), &size, sizeof(size_t));
+                    if (fd != batchFd)
+                        {
+                            writeAll(batchFd, _batch.data(), _batch.size());
+                            _batch.clear();
+                            batchFd = fd;
+                        }
+                    size_t at = _batch.size();
+                    _batch.resize(at + size);
+                    read(buffer, tail + sizeof(int) + sizeof(size_t), &_batch[at], size);
+                    tail += sizeof(int) + sizeof(size_t) + size;
+                }
+            writeAll(batchFd, _batch.data(), _batch.size());
+            _batch.clear();
+            buffer.tail.store(tail, std::memory_order_release);
+        }
+}
+
+void eoLogger::Writer::stop(int fd)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _stop = true;
+    if (_running)
+        {
+            _wakeup.notify_one();
+            lock.unlock();
+            _thread.join();
+            lock.lock();
+            _running = false;
+        }
+    lock.unlock();
+    drain();
+
+    std::lock_guard<std::mutex> buffersLock(_buffersMutex);
+    for (std::list< std::unique_ptr<Buffer> >::iterator it = _buffers.begin(); it != _buffers.end(); ++it)
+        {
+            writeAll(fd, (*it)->line.data(), (*it)->line.size());
+            (*it)->line.clear();
+        }
+}
+
 void eoLogger::_init()
 {
     _standard_io_streams[&std::cout] = 1;
@@ -67,7 +362,8 @@ eoLogger::eoLogger() :
     _selectedLevel(eo::progress),
     _contextLevel(eo::quiet),
     _fd(2),
-    _obuf(_fd, _contextLevel, _selectedLevel)
+    _writer(new Writer()),
+    _obuf(_fd, _contextLevel, _selectedLevel, *_writer)
 {
     std::ostream::init(&_obuf);
     _init();
@@ -83,7 +379,8 @@ eoLogger::eoLogger(eo::file file) :
     _selectedLevel(eo::progress),
     _contextLevel(eo::quiet),
     _fd(2),
-    _obuf(_fd, _contextLevel, _selectedLevel)
+    _writer(new Writer()),
+    _obuf(_fd, _contextLevel, _selectedLevel, *_writer)
 {
     std::ostream::init(&_obuf);
     _init();
@@ -92,9 +389,21 @@ eoLogger::eoLogger(eo::file file) :
 
 eoLogger::~eoLogger()
 {
+    _writer->stop(_fd);
     if (_fd > 2) { ::close(_fd); }
 }
 
+void eoLogger::wait()
+{
+    _writer->commit(_writer->buffer(), _fd, false);
+    _writer->wait();
+}
+
+void eoLogger::_updateState()
+{
+    clear(isEnabled(_contextLevel) ? std::ios::goodbit : std::ios::badbit);
+}
+
 void eoLogger::_createParameters( eoParser& parser )
 {
     //------------------------------------------------------------------
@@ -160,11 +469,14 @@ void eoLogger::printLevels() const
 eoLogger& operator<<(eoLogger& l, const eo::Levels lvl)
 {
     l._contextLevel = lvl;
+    l._updateState();
     return l;
 }
 
 eoLogger& operator<<(eoLogger& l, eo::file f)
 {
+    // what was logged before goes to the previous file
+    l.wait();
     l._fd = ::open(f._f.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
     return l;
 }
@@ -172,6 +484,7 @@ eoLogger& operator<<(eoLogger& l, eo::file f)
 eoLogger& operator<<(eoLogger& l, eo::setlevel v)
 {
     l._selectedLevel = (v._lvl < 0 ? l._levels[v._v] : v._lvl);
+    l._updateState();
     return l;
 }
 
@@ -179,6 +492,7 @@ eoLogger& operator<<(eoLogger& l, std::ostream& os)
 {
     if (l._standard_io_streams.find(&os) != l._standard_io_streams.end())
         {
+            l.wait();
             l._fd = l._standard_io_streams[&os];
         }
     return l;
@@ -186,8 +500,9 @@ eoLogger& operator<<(eoLogger& l, std::ostream& os)
 
 eoLogger::outbuf::outbuf(const int& fd,
                          const eo::Levels& contexlvl,
-                         const eo::Levels& selectedlvl)
-    : _fd(fd), _contextLevel(contexlvl), _selectedLevel(selectedlvl)
+                         const eo::Levels& selectedlvl,
+                         Writer& writer)
+    : _fd(fd), _contextLevel(contexlvl), _selectedLevel(selectedlvl), _writer(writer)
 {}
 
 int eoLogger::outbuf::overflow(int_type c)
@@ -196,12 +511,44 @@ int eoLogger::outbuf::overflow(int_type c)
       {
         if (_fd >= 0 && c != EOF)
           {
-              ::write(_fd, &c, 1);
+              Writer::Buffer& buffer = _writer.buffer();
+              buffer.line += static_cast<char>(c);
+              if (c == '\n')
+                {
+                  _writer.commit(buffer, _fd, _contextLevel <= eo::warnings);
+                }
           }
       }
     return c;
 }
 
+std::streamsize eoLogger::outbuf::xsputn(const char* s, std::streamsize n)
+{
+    if (_selectedLevel >= _contextLevel)
+      {
+        if (_fd >= 0)
+          {
+              Writer::Buffer& buffer = _writer.buffer();
+              buffer.line.append(s, n);
+              if (std::memchr(s, '\n', n) != NULL)
+                {
+                  _writer.commit(buffer, _fd, _contextLevel <= eo::warnings);
+                }
+          }
+      }
+    return n;
+}
+
+int eoLogger::outbuf::sync()
+{
+    if (_selectedLevel >= _contextLevel && _fd >= 0)
+      {
+          Writer::Buffer& buffer = _writer.buffer();
+          _writer.commit(buffer, _fd, _contextLevel <= eo::warnings);
+      }
+    return 0;
+}
+
 namespace eo
 {
     file::file(const std::string f)
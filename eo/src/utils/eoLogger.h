@@ -77,10 +77,24 @@ Caner Candan <caner.candan@thalesgroup.com>
     eo::log << eo::debug << 4 << ')'
     << " Must be in debug mode to see that\n";
 
+    // In the hot paths, the EO_LOG macro checks the level before evaluating
+    // anything of the message, and drops at compile time the levels above
+    // EO_LOG_LEVEL.
+    EO_LOG(eo::xdebug) << "5) Must be in xdebug mode to see that" << std::endl;
+
     return 0;
     }
 \endcode
 
+ The messages are not written by the thread which logs them: each thread
+ appends its messages to its own lock-free ring buffer, which is drained by
+ a background thread, in batches of messages written at once. The messages
+ of the levels up to eo::warnings are written before the logging statement
+ returns, and all the messages are written when the logger is destroyed (see
+ also eoLogger::wait). When the current level is not selected, the logger is
+ in a failed state: the formatted outputs return at once, without formatting
+ the message.
+
 @{
 */
 
@@ -88,6 +102,7 @@ Caner Candan <caner.candan@thalesgroup.com>
 #define eoLogger_h
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <string>
 #include <iosfwd>
@@ -169,6 +184,17 @@ public:
      */
     inline eo::Levels getLevelContext() const { return _contextLevel; }
 
+    /*! Returns true if the messages of the given level are displayed
+     */
+    inline bool isEnabled(eo::Levels lvl) const { return _selectedLevel >= lvl; }
+
+    /*! Waits until all the messages logged so far, by all the threads, are written
+     *
+     * The messages of the calling thread which do not end with a std::endl or a new line
+     * are written too.
+     */
+    void wait();
+
 protected:
     //! in order to add a level of verbosity
     void addLevel(std::string name, eo::Levels level);
@@ -180,7 +206,16 @@ private:
     //! used by the set of ctors to initiate some useful variables
     void _init();
 
+    //! puts the stream in a failed state when the context level is not selected, so that nothing is formatted
+    void _updateState();
+
 private:
+    /**
+     * Writer
+     * the ring buffers of the threads, and the background thread writing them
+     */
+    class Writer;
+
     /**
      * outbuf
      * this class inherits from std::streambuf which is used by eoLogger to write the buffer in an output stream
@@ -188,13 +223,16 @@ private:
     class outbuf : public std::streambuf
     {
     public:
-        outbuf(const int& fd, const eo::Levels& contexlvl, const eo::Levels& selectedlvl);
+        outbuf(const int& fd, const eo::Levels& contexlvl, const eo::Levels& selectedlvl, Writer& writer);
     protected:
         virtual int overflow(int_type c);
+        virtual std::streamsize xsputn(const char* s, std::streamsize n);
+        virtual int sync();
     private:
         const int& _fd;
         const eo::Levels& _contextLevel;
         const eo::Levels& _selectedLevel;
+        Writer& _writer;
     };
 
 private:
@@ -248,6 +286,11 @@ private:
      */
     int _fd;
 
+    /**
+     * _writer writes the messages of all the threads in the background
+     */
+    std::unique_ptr<Writer> _writer;
+
     /**
      * _obuf std::ostream mandates to use a buffer. _obuf is a outbuf inheriting of std::streambuf.
      */
@@ -282,6 +325,35 @@ namespace eo
     extern eoLogger log;
 }
 
+/**
+ * EO_LOG_LEVEL is the most verbose level compiled in the EO_LOG statements:
+ * the more verbose ones are dropped at compile time. Every level is compiled
+ * by default (see the EO_LOG_LEVEL CMake option).
+ */
+#ifndef EO_LOG_LEVEL
+#define EO_LOG_LEVEL eo::xdebug
+#endif
+
+/**
+ * eoLogVoidify turns the stream expression of EO_LOG into a void, to be the
+ * alternative of a conditional operator.
+ */
+struct eoLogVoidify
+{
+    void operator&(std::ostream&) {}
+};
+
+/**
+ * EO_LOG(level) is eo::log << level, except that nothing at the right of it is
+ * evaluated if the level is not selected, nor compiled if the level is more
+ * verbose than EO_LOG_LEVEL:
+ * \code
+ * EO_LOG(eo::xdebug) << "evaluated: " << sol << std::endl;
+ * \endcode
+ */
+#define EO_LOG(_level) \
+    !((_level) <= EO_LOG_LEVEL && eo::log.isEnabled(_level)) ? (void)0 : eoLogVoidify() & eo::log << (_level)
+
 /** @} */
 
 #endif // !eoLogger_h
@@ -0,0 +1,125 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoProfileStat.h
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef _eoProfileStat_h
+#define _eoProfileStat_h
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "eoStat.h"
+#include "eoParam.h"
+#include "eoProfiler.h"
+
+/** @addtogroup Stats
+ * @{
+ */
+
+/**
+    The times of some phases and the counts of some counters of eo::profiler,
+    since the previous update, each in an eoValueParam to be given to a monitor.
+    The base of eoProfileStat and moProfileStat.
+*/
+class eoProfileValues
+{
+public:
+
+    /// the time spent in a phase since the previous update, in milliseconds
+    eoValueParam<double>& time(const std::string& _phase, std::string _description = "")
+    {
+        timeParams.push_back(eoValueParam<double>(0.0, _description.empty() ? _phase + " (ms)" : _description));
+        phaseIds.push_back(eo::profiler.phase(_phase));
+        lastTimes.push_back(eo::profiler.time(phaseIds.back()));
+        return timeParams.back();
+    }
+
+    /// the increment of a counter since the previous update
+    eoValueParam<unsigned long>& count(const std::string& _counter, std::string _description = "")
+    {
+        countParams.push_back(eoValueParam<unsigned long>(0, _description.empty() ? _counter : _description));
+        counterIds.push_back(eo::profiler.counter(_counter));
+        lastCounts.push_back(eo::profiler.total(counterIds.back()));
+        return countParams.back();
+    }
+
+    /// reads the profiler
+    void update()
+    {
+        unsigned i = 0;
+        for (std::list< eoValueParam<double> >::iterator it = timeParams.begin(); it != timeParams.end(); ++it, ++i)
+        {
+            double t = eo::profiler.time(phaseIds[i]);
+            it->value() = t - lastTimes[i];
+            lastTimes[i] = t;
+        }
+        i = 0;
+        for (std::list< eoValueParam<unsigned long> >::iterator it = countParams.begin(); it != countParams.end(); ++it, ++i)
+        {
+            unsigned long n = eo::profiler.total(counterIds[i]);
+            it->value() = n - lastCounts[i];
+            lastCounts[i] = n;
+        }
+    }
+
+private:
+
+    std::list< eoValueParam<double> > timeParams;
+    std::vector<unsigned> phaseIds;
+    std::vector<double> lastTimes;
+    std::list< eoValueParam<unsigned long> > countParams;
+    std::vector<unsigned> counterIds;
+    std::vector<unsigned long> lastCounts;
+};
+
+/**
+    The times of the phases of a generation and its counts, as measured by
+    eo::profiler (thus only when compiled with WITH_PROFILER):
+    @code
+    eoProfileStat<EOT> profile;
+    checkpoint.add(profile);
+    monitor.add(profile.time("breed"));
+    monitor.add(profile.time("evaluate"));
+    monitor.add(profile.count("evaluations"));
+    @endcode
+    The phases of eoEasyEA are "breed", "evaluate", "replace" and "checkpoint",
+    the ones of moeoEasyEA are the same plus "fitness assignment" and
+    "diversity assignment". The counters are "evaluations", "copies" and
+    "allocations".
+
+    @ingroup Stats
+*/
+template <class EOT>
+class eoProfileStat : public eoStatBase<EOT>, public eoProfileValues
+{
+public:
+
+    void operator()(const eoPop<EOT>&)
+    {
+        update();
+    }
+
+    virtual std::string className(void) const { return "eoProfileStat"; }
+};
+
+/** @} */
+
+#endif
@@ -0,0 +1,226 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoProfiler.cpp
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include "eoProfiler.h"
+#include "eoParser.h"
+
+namespace
+{
+    std::string quote(const std::string& _s)
+    {
+        std::string result = "\"";
+        for (unsigned i = 0; i < _s.size(); ++i)
+        {
+            if (_s[i] == '"' || _s[i] == '\\')
+                result += '\\';
+            result += _s[i];
+        }
+        return result + "\"";
+    }
+
+    unsigned find(std::vector<std::string>& _names, const std::string& _name)
+    {
+        std::vector<std::string>::iterator it = std::find(_names.begin(), _names.end(), _name);
+        if (it != _names.end())
+            return it - _names.begin();
+        _names.push_back(_name);
+        return _names.size() - 1;
+    }
+
+    /** The accumulators of the calling thread, and the profiler they belong to */
+    struct ThreadCache
+    {
+        const void* profiler;
+        void* thread;
+    };
+
+    thread_local ThreadCache threadCache = {0, 0};
+}
+
+eoProfiler::eoProfiler() :
+    origin(std::chrono::steady_clock::now()),
+    tracing(false),
+    summaryFile("", "profile-summary", "File where the times of the phases are written at the end, as JSON", '\0'),
+    traceFile("", "profile-trace", "File where the timeline of the phases is written at the end, in the Chrome trace format", '\0')
+{
+}
+
+eoProfiler::~eoProfiler()
+{
+    if (!summaryFile.value().empty())
+    {
+        std::ofstream os(summaryFile.value().c_str());
+        printOn(os);
+    }
+    if (!traceFile.value().empty())
+    {
+        std::ofstream os(traceFile.value().c_str());
+        writeTrace(os);
+    }
+}
+
+unsigned eoProfiler::phase(const std::string& _name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return find(phaseNames, _name);
+}
+
+unsigned eoProfiler::counter(const std::string& _name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return find(counterNames, _name);
+}
+
+eoProfiler::Thread& eoProfiler::thread()
+{
+    if (threadCache.profiler == this)
+        return *static_cast<Thread*>(threadCache.thread);
+
+    // first record of this thread in this profiler
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.push_back(std::unique_ptr<Thread>(new Thread()));
+    threads.back()->id = threads.size() - 1;
+    threadCache.profiler = this;
+    threadCache.thread = threads.back().get();
+    return *threads.back();
+}
+
+void eoProfiler::add(unsigned _phase, double _start, double _duration)
+{
+    Thread& t = thread();
+    if (_phase >= t.times.size())
+    {
+        t.times.resize(_phase + 1, 0.0);
+        t.calls.resize(_phase + 1, 0);
+    }
+    t.times[_phase] += _duration;
+    t.calls[_phase]++;
+    if (tracing)
+    {
+        Event event = {_phase, _start, _duration};
+        t.events.push_back(event);
+    }
+}
+
+void eoProfiler::count(unsigned _counter, unsigned long _n)
+{
+    Thread& t = thread();
+    if (_counter >= t.counts.size())
+        t.counts.resize(_counter + 1, 0);
+    t.counts[_counter] += _n;
+}
+
+double eoProfiler::time(unsigned _phase) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    double total = 0;
+    for (std::list< std::unique_ptr<Thread> >::const_iterator it = threads.begin(); it != threads.end(); ++it)
+        if (_phase < (*it)->times.size())
+            total += (*it)->times[_phase];
+    return total / 1000;
+}
+
+unsigned long eoProfiler::calls(unsigned _phase) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    unsigned long total = 0;
+    for (std::list< std::unique_ptr<Thread> >::const_iterator it = threads.begin(); it != threads.end(); ++it)
+        if (_phase < (*it)->calls.size())
+            total += (*it)->calls[_phase];
+    return total;
+}
+
+unsigned long eoProfiler::total(unsigned _counter) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    unsigned long total = 0;
+    for (std::list< std::unique_ptr<Thread> >::const_iterator it = threads.begin(); it != threads.end(); ++it)
+        if (_counter < (*it)->counts.size())
+            total += (*it)->counts[_counter];
+    return total;
+}
+
+void eoProfiler::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (std::list< std::unique_ptr<Thread> >::iterator it = threads.begin(); it != threads.end(); ++it)
+    {
+        std::fill((*it)->times.begin(), (*it)->times.end(), 0.0);
+        std::fill((*it)->calls.begin(), (*it)->calls.end(), 0);
+        std::fill((*it)->counts.begin(), (*it)->counts.end(), 0);
+        (*it)->events.clear();
+    }
+}
+
+void eoProfiler::printOn(std::ostream& _os) const
+{
+    _os << "{\"phases\": {";
+    for (unsigned p = 0; p < phaseNames.size(); ++p)
+        _os << (p > 0 ? ", " : "") << quote(phaseNames[p])
+            << ": {\"time\": " << time(p) << ", \"calls\": " << calls(p) << "}";
+    _os << "}, \"counters\": {";
+    for (unsigned c = 0; c < counterNames.size(); ++c)
+        _os << (c > 0 ? ", " : "") << quote(counterNames[c]) << ": " << total(c);
+    _os << "}, \"threads\": " << threads.size() << "}" << std::endl;
+}
+
+void eoProfiler::writeTrace(std::ostream& _os) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ios::fmtflags flags = _os.flags();
+    _os << std::fixed << std::setprecision(3);
+    _os << "{\"traceEvents\": [";
+    bool first = true;
+    for (std::list< std::unique_ptr<Thread> >::const_iterator it = threads.begin(); it != threads.end(); ++it)
+    {
+        const std::vector<Event>& events = (*it)->events;
+        for (unsigned e = 0; e < events.size(); ++e)
+        {
+            _os << (first ? "\n" : ",\n")
+                << "{\"name\": " << quote(phaseNames[events[e].phase]) << ", \"cat\": \"eo\", \"ph\": \"X\""
+                << ", \"ts\": " << events[e].start << ", \"dur\": " << events[e].duration
+                << ", \"pid\": 0, \"tid\": " << (*it)->id << "}";
+            first = false;
+        }
+    }
+    _os << "\n], \"displayTimeUnit\": \"ms\"}" << std::endl;
+    _os.flags(flags);
+}
+
+void eoProfiler::_createParameters(eoParser& _parser)
+{
+    std::string section("Profiling");
+    _parser.processParam(summaryFile, section);
+    _parser.processParam(traceFile, section);
+}
+
+void make_profiler(eoParser& _parser)
+{
+    eo::profiler._createParameters(_parser);
+    if (!eo::profiler.traceFile.value().empty())
+        eo::profiler.trace(true);
+}
+
+eoProfiler eo::profiler;
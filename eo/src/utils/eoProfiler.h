@@ -0,0 +1,227 @@
+// -*- mode: c++; c-indent-level: 4; c++-member-init-indent: 8; comment-column: 35; -*-
+
+//-----------------------------------------------------------------------------
+// eoProfiler.h : times of the phases of the algorithms, and counters
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef eoProfiler_h
+#define eoProfiler_h
+
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../eoObject.h"
+#include "eoParam.h"
+
+class eoParser;
+
+/** @addtogroup Utilities
+ * @{
+ */
+
+/**
+    eoProfiler --> where the time of the algorithms goes.
+
+    The hot paths of the algorithms (the generation of eoEasyEA and moeoEasyEA,
+    the step of moLocalSearch, the selections, the populators and the merges)
+    are split in named phases, timed by scoped timers, and in named counters
+    (evaluations, copies, allocations). The instrumentation is compiled only
+    when WITH_PROFILER is defined (see the ENABLE_PROFILER CMake option),
+    otherwise the macros expand to nothing:
+    @code
+    {
+        EO_PROFILE_SCOPE("breed");
+        breed(_pop, offspring);
+    }
+    EO_PROFILE_COUNT("copies", offspring.size());
+    @endcode
+
+    Each thread accumulates in its own buffers, created on its first record,
+    so the timers of the parallel loops do not take any lock: only the first
+    use of a phase or of a counter by a call site does. The totals are summed
+    over the threads when they are read, which must be done out of the
+    parallel loops (e.g. in a checkpoint, see eoProfileStat and moProfileStat).
+
+    The totals are written as JSON by printOn, and, when tracing, every timed
+    scope is kept and written as a timeline in the Chrome trace event format
+    by writeTrace (to be opened in chrome://tracing or in Perfetto). Both can
+    be written at the end of the program when asked for on the command line
+    (see make_profiler).
+
+    A global eo::profiler is used by the macros.
+*/
+class eoProfiler : public eoObject
+{
+public:
+
+    /** A timed scope, in microseconds since the construction of the profiler */
+    struct Event
+    {
+        unsigned phase;
+        double start;
+        double duration;
+    };
+
+    eoProfiler();
+    ~eoProfiler();
+
+    virtual std::string className() const { return "eoProfiler"; }
+
+    /// the identifier of a phase, registered on its first use
+    unsigned phase(const std::string& _name);
+
+    /// the identifier of a counter, registered on its first use
+    unsigned counter(const std::string& _name);
+
+    /// microseconds since the construction of the profiler
+    double now() const
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    /// adds a timed scope of a phase, in microseconds, to the accumulators of the calling thread
+    void add(unsigned _phase, double _start, double _duration);
+
+    /// increments a counter of the calling thread
+    void count(unsigned _counter, unsigned long _n = 1);
+
+    /// the total time spent in a phase by all the threads, in milliseconds
+    double time(unsigned _phase) const;
+
+    /// the number of timed scopes of a phase, in all the threads
+    unsigned long calls(unsigned _phase) const;
+
+    /// the total of a counter, in all the threads
+    unsigned long total(unsigned _counter) const;
+
+    const std::vector<std::string>& phases() const { return phaseNames; }
+    const std::vector<std::string>& counters() const { return counterNames; }
+
+    /// keeps every timed scope, for writeTrace: their memory grows with the run
+    void trace(bool _tracing) { tracing = _tracing; }
+    bool isTracing() const { return tracing; }
+
+    /// clears the accumulators and the events of all the threads
+    void reset();
+
+    /// the totals, as JSON: {"phases": {"breed": {"time": ms, "calls": n}, ...}, "counters": {...}}
+    virtual void printOn(std::ostream& _os) const;
+
+    /// the events, in the Chrome trace event format
+    void writeTrace(std::ostream& _os) const;
+
+    friend void make_profiler(eoParser&);
+
+private:
+
+    /** The accumulators of a thread */
+    struct Thread
+    {
+        unsigned id;
+        std::vector<double> times;
+        std::vector<unsigned long> calls;
+        std::vector<unsigned long> counts;
+        std::vector<Event> events;
+    };
+
+    Thread& thread();
+
+    void _createParameters(eoParser& _parser);
+
+    std::chrono::steady_clock::time_point origin;
+    bool tracing;
+    std::vector<std::string> phaseNames;
+    std::vector<std::string> counterNames;
+    std::list< std::unique_ptr<Thread> > threads;
+    mutable std::mutex mutex;
+
+    eoValueParam<std::string> summaryFile;
+    eoValueParam<std::string> traceFile;
+};
+
+/** Asks for the summary and the trace of the profiler on the command line:
+ * --profile-summary=<file> and --profile-trace=<file>, written at the end of
+ * the program.
+ */
+void make_profiler(eoParser&);
+
+namespace eo
+{
+    /**
+     * profiler is the global profiler, used by the EO_PROFILE_SCOPE and
+     * EO_PROFILE_COUNT macros
+     */
+    extern eoProfiler profiler;
+}
+
+/**
+    Times the enclosing scope as a phase of eo::profiler.
+*/
+class eoProfileScope
+{
+public:
+    eoProfileScope(unsigned _phase) : phase(_phase), start(eo::profiler.now()) {}
+
+    ~eoProfileScope()
+    {
+        eo::profiler.add(phase, start, eo::profiler.now() - start);
+    }
+
+private:
+    unsigned phase;
+    double start;
+};
+
+/// the number of individuals of a population which are to be evaluated, for the "evaluations" counter
+template <class Pop>
+unsigned long eoProfileInvalid(const Pop& _pop)
+{
+    unsigned long n = 0;
+    for (unsigned i = 0; i < _pop.size(); ++i)
+        if (_pop[i].invalid())
+            ++n;
+    return n;
+}
+
+#define EO_PROFILE_CONCAT_(a, b) a##b
+#define EO_PROFILE_CONCAT(a, b) EO_PROFILE_CONCAT_(a, b)
+
+#ifdef WITH_PROFILER
+/// times the rest of the enclosing scope as the phase _name
+#define EO_PROFILE_SCOPE(_name) \
+    static const unsigned EO_PROFILE_CONCAT(eoProfilePhase_, __LINE__) = eo::profiler.phase(_name); \
+    eoProfileScope EO_PROFILE_CONCAT(eoProfileScope_, __LINE__)(EO_PROFILE_CONCAT(eoProfilePhase_, __LINE__))
+/// adds _n to the counter _name
+#define EO_PROFILE_COUNT(_name, _n) \
+    do { \
+        static const unsigned eoProfileCounter = eo::profiler.counter(_name); \
+        eo::profiler.count(eoProfileCounter, _n); \
+    } while (false)
+#else
+#define EO_PROFILE_SCOPE(_name)
+#define EO_PROFILE_COUNT(_name, _n) do {} while (false)
+#endif
+
+/** @} */
+
+#endif // eoProfiler_h
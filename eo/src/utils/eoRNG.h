@@ -53,6 +53,7 @@ typedef unsigned long uint32_t;
 // Relative includes
 #include "../eoPersistent.h"
 #include "../eoObject.h"
+#include "eoRngStream.h"
 
 
 
@@ -73,6 +74,11 @@ are provided that use the global random number generator: <tt>random</tt>,
 @warning If you want to repeatedly generated the same sequence of pseudo-random
 numbers, you should always reseed the generator at the beginning of your code.
 
+@warning The global generator is not thread-safe on its own. When an eoRngStream is
+bound to a thread by an eoRngStreamScope, all the draws this thread makes on the global
+<tt>rng</tt> are taken from the stream instead, which is what the parallel loops
+of the framework do.
+
 
 
 <h1>Documentation in original file</h1>
@@ -284,6 +290,32 @@ public :
         cached = false;
     }
 
+    /** Fill [first, last) with uniform random numbers in [min, max) */
+    template <typename It>
+    void fill_uniform(It first, It last, double min = 0.0, double max = 1.0)
+        {
+            if (eoRngStream* stream = redirection()) {
+                stream->fill_uniform(first, last, min, max);
+                return;
+            }
+            for (; first != last; ++first) {
+                *first = uniform(min, max);
+            }
+        }
+
+    /** Fill [first, last) with Gaussian deviates of the given mean and standard deviation */
+    template <typename It>
+    void fill_normal(It first, It last, double mean = 0.0, double stdev = 1.0)
+        {
+            if (eoRngStream* stream = redirection()) {
+                stream->fill_normal(first, last, mean, stdev);
+                return;
+            }
+            for (; first != last; ++first) {
+                *first = normal(mean, stdev);
+            }
+        }
+
     /** Random numbers using a negative exponential distribution
 
     @param mean Mean value of distribution
@@ -439,6 +471,12 @@ private:
     */
     void initialize(uint32_t seed);
 
+    /** @brief Stream to draw from instead of the own state, if any
+
+    Only the global generator is redirected, to the stream bound to the calling thread.
+    */
+    eoRngStream* redirection() const;
+
     /** @brief Array for the state */
     uint32_t *state;
 
@@ -539,8 +577,19 @@ inline uint32_t eoRng::restart()
 
 
 
+inline eoRngStream* eoRng::redirection() const
+{
+    eoRngStream* stream = eo::boundRngStream;
+    return (stream != nullptr && this == &eo::rng) ? stream : nullptr;
+}
+
+
+
 inline uint32_t eoRng::rand()
 {
+    if(eoRngStream* stream = redirection())
+        return stream->rand();
+
     if(--left < 0)
         return(restart());
     uint32_t y  = *next++;
@@ -554,6 +603,9 @@ inline uint32_t eoRng::rand()
 
 inline double eoRng::normal()
 {
+    if (eoRngStream* stream = redirection())
+        return stream->normal();
+
     if (cached) {
         cached = false;
         return cacheValue;
@@ -623,6 +675,17 @@ namespace eo
     @return ormally distributed random number
     */
     inline double normal() { return rng.normal(); }
+
+    /** Draw a seed for a family of eoRngStream from the global generator
+
+    Used by the parallel loops, so that the streams they create depend on the
+    seed given to the global eo::rng.
+    */
+    inline uint64_t streamSeed()
+    {
+        uint64_t high = rng.rand();
+        return (high << 32) | rng.rand();
+    }
 }
 
 
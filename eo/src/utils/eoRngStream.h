@@ -0,0 +1,296 @@
+/*
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation;
+   version 2 of the License.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef _eoRngStream_h
+#define _eoRngStream_h
+
+#include <cmath>
+#include <stdint.h>
+
+#include "../eoPersistent.h"
+#include "../eoObject.h"
+
+/** @addtogroup Random
+ * @{
+ * */
+
+/** Counter-based random number stream.
+
+The stream uses the Philox4x32-10 bijection of Salmon et al. (2011), applied on a
+128 bits counter under a 64 bits key. The counter is split in two halves: the high
+half is the stream id and the low half is the index of the current block of four
+numbers. Hence, any (seed, stream id) pair gives an independent and reproducible
+sequence, which costs a few bytes of state and nothing to create or to jump into.
+
+This makes it the right tool to give each thread, island or individual its own
+generator: the numbers drawn do not depend on which thread draws them, nor on when.
+
+The interface mimics the one of eoRng, plus bulk fill_uniform and fill_normal
+methods to draw whole blocks of numbers at once.
+
+@see eoRng, eoRngStreamScope
+*/
+class eoRngStream : public eoObject, public eoPersistent
+{
+public:
+    /** Constructor
+     * @param s seed, i.e. the key of the bijection
+     * @param id stream id
+     */
+    eoRngStream(uint64_t s = 0, uint64_t id = 0)
+    {
+        reseed(s, id);
+    }
+
+    /** Move to the beginning of a new stream
+     * @param s seed, i.e. the key of the bijection
+     * @param id stream id
+     */
+    void reseed(uint64_t s, uint64_t id = 0)
+    {
+        key = s;
+        stream = id;
+        block = 0;
+        used = 4;
+        cached = false;
+    }
+
+    /** Skip the next blocks of four 32 bits numbers */
+    void discard(uint64_t blocks)
+    {
+        block += blocks;
+        used = 4;
+        cached = false;
+    }
+
+    /** @return the seed of the stream */
+    uint64_t seed() const { return key; }
+
+    /** @return the id of the stream */
+    uint64_t id() const { return stream; }
+
+    /** rand() returns a random number in the range [0, rand_max) */
+    uint32_t rand()
+    {
+        if(used == 4) {
+            generate();
+        }
+        return buffer[used++];
+    }
+
+    /** rand_max() the maximum returned by rand() */
+    uint32_t rand_max() const { return uint32_t(0xffffffff); }
+
+    /** Random number from unifom distribution in [0, m) */
+    double uniform(double m = 1.0)
+    {
+        return m * double(rand()) / double(1.0 + rand_max());
+    }
+
+    /** Random number from unifom distribution in [min, max) */
+    double uniform(double min, double max)
+    {
+        return min + uniform(max - min);
+    }
+
+    /** Random integer number from unifom distribution in [0, m) */
+    uint32_t random(uint32_t m)
+    {
+        return uint32_t(uniform() * double(m));
+    }
+
+    /** Biased coin toss, true with probability bias */
+    bool flip(double bias = 0.5)
+    {
+        return uniform() < bias;
+    }
+
+    /** Zero mean Gaussian deviate with standard deviation 1 (Marsaglia polar method) */
+    double normal()
+    {
+        if(cached) {
+            cached = false;
+            return cacheValue;
+        }
+        double rSquare, var1, var2;
+        do {
+            var1 = 2.0 * uniform() - 1.0;
+            var2 = 2.0 * uniform() - 1.0;
+            rSquare = var1 * var1 + var2 * var2;
+        } while(rSquare >= 1.0 || rSquare == 0.0);
+        double factor = std::sqrt(-2.0 * std::log(rSquare) / rSquare);
+        cacheValue = var1 * factor;
+        cached = true;
+        return var2 * factor;
+    }
+
+    /** Gaussian deviate with zero mean and the given standard deviation */
+    double normal(double stdev) { return stdev * normal(); }
+
+    /** Gaussian deviate with the given mean and standard deviation */
+    double normal(double mean, double stdev) { return mean + normal(stdev); }
+
+    /** Forgets the cached value of normal() */
+    void clearCache() { cached = false; }
+
+    /** Fill [first, last) with uniform numbers in [min, max) */
+    template<class It>
+    void fill_uniform(It first, It last, double min = 0.0, double max = 1.0)
+    {
+        const double scale = (max - min) / double(1.0 + rand_max());
+        for(; first != last; ++first) {
+            *first = min + scale * double(rand());
+        }
+    }
+
+    /** Fill [first, last) with Gaussian deviates of the given mean and standard deviation
+     *
+     * Both numbers of each polar draw are used, so that the whole block costs about
+     * 1.27 pairs of uniform numbers per pair of deviates.
+     */
+    template<class It>
+    void fill_normal(It first, It last, double mean = 0.0, double stdev = 1.0)
+    {
+        if(first != last && cached) {
+            *first = mean + stdev * normal();
+            ++first;
+        }
+        while(first != last) {
+            double rSquare, var1, var2;
+            do {
+                var1 = 2.0 * uniform() - 1.0;
+                var2 = 2.0 * uniform() - 1.0;
+                rSquare = var1 * var1 + var2 * var2;
+            } while(rSquare >= 1.0 || rSquare == 0.0);
+            double factor = std::sqrt(-2.0 * std::log(rSquare) / rSquare);
+            *first = mean + stdev * var2 * factor;
+            ++first;
+            if(first == last) {
+                cacheValue = var1 * factor;
+                cached = true;
+                break;
+            }
+            *first = mean + stdev * var1 * factor;
+            ++first;
+        }
+    }
+
+    virtual std::string className() const { return "eoRngStream"; }
+
+    void printOn(std::ostream& _os) const
+    {
+        _os << key << ' ' << stream << ' ' << block << ' ' << used << ' ';
+        for(unsigned i = 0; i < 4; ++i) {
+            _os << buffer[i] << ' ';
+        }
+        // Enough digits for the cached deviate to be read back exactly
+        std::streamsize precision = _os.precision(17);
+        _os << cached << ' ' << cacheValue;
+        _os.precision(precision);
+    }
+
+    void readFrom(std::istream& _is)
+    {
+        _is >> key >> stream >> block >> used;
+        for(unsigned i = 0; i < 4; ++i) {
+            _is >> buffer[i];
+        }
+        _is >> cached >> cacheValue;
+    }
+
+protected:
+    /** Fill the buffer with the image of the current counter, then increment it */
+    void generate()
+    {
+        uint32_t c0 = uint32_t(block), c1 = uint32_t(block >> 32);
+        uint32_t c2 = uint32_t(stream), c3 = uint32_t(stream >> 32);
+        uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32);
+
+        for(unsigned r = 0; r < 10; ++r) {
+            uint64_t p0 = uint64_t(0xD2511F53U) * c0;
+            uint64_t p1 = uint64_t(0xCD9E8D57U) * c2;
+            uint32_t n0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+            uint32_t n2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+            c1 = uint32_t(p1);
+            c3 = uint32_t(p0);
+            c0 = n0;
+            c2 = n2;
+            k0 += 0x9E3779B9U;
+            k1 += 0xBB67AE85U;
+        }
+
+        buffer[0] = c0; buffer[1] = c1; buffer[2] = c2; buffer[3] = c3;
+        used = 0;
+        ++block;
+    }
+
+    uint64_t key;
+    uint64_t stream;
+    uint64_t block;
+    uint32_t buffer[4];
+    unsigned used;
+    bool cached;
+    double cacheValue;
+};
+
+namespace eo
+{
+    /** Stream bound to the calling thread by an eoRngStreamScope, if any.
+
+    While it is set, the draws on the global eo::rng made by the thread are
+    redirected to this stream.
+    */
+    inline thread_local eoRngStream* boundRngStream = nullptr;
+}
+
+/** Bind a stream to the calling thread for the lifetime of the scope.
+
+All the draws made on the global eo::rng by the current thread, including
+the ones of the operators holding a reference to it, are taken from the stream.
+The previous binding is restored at the end of the scope, so that scopes may be nested.
+
+@code
+#pragma omp parallel for
+for(size_t i = 0; i < pop.size(); ++i) {
+    eoRngStream stream(seed, i);
+    eoRngStreamScope scope(stream);
+    mutation(pop[i]); // uses eo::rng, hence the i-th stream
+}
+@endcode
+*/
+class eoRngStreamScope
+{
+public:
+    eoRngStreamScope(eoRngStream& _stream) : previous(eo::boundRngStream)
+    {
+        eo::boundRngStream = &_stream;
+    }
+
+    ~eoRngStreamScope()
+    {
+        eo::boundRngStream = previous;
+    }
+
+private:
+    eoRngStream* previous;
+
+    eoRngStreamScope(const eoRngStreamScope&);
+    eoRngStreamScope& operator=(const eoRngStreamScope&);
+};
+
+/** @} */
+
+#endif // _eoRngStream_h
@@ -134,11 +134,12 @@ class UF_random_generator
             : _max(max), _random(_rng)
         {}
 
-        T operator()() { return _random.random(_max); }
-        T operator()(T m) { return _random.random(m); }
+        // UniformRandomBitGenerator interface, as needed by std::shuffle
+        T operator()() { return T(_random.rand()); }
+        static constexpr T min() { return 0; }
+        static constexpr T max() { return T(0xffffffff); }
 
-        T min() { return 0; }
-        T max() { return _max; }
+        T operator()(T m) { return _random.random(m); }
 
     private :
         T _max;
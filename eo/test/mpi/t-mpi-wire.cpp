@@ -0,0 +1,247 @@
+/*
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation;
+    version 2 of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+Contact: http://eodev.sourceforge.net
+*/
+
+/*
+ * This file tests the binary format of eoMpiWire.h: populations of real, integer and bit strings, which are not
+ * eoserial::Persistent, are evaluated in parallel and must get the same fitnesses as a sequential evaluation, while
+ * their genomes are left unchanged. So must the objective vectors, fitnesses and diversities of their multi-objective
+ * counterparts.
+ *
+ * This test needs at least 2 processes to be launched.
+ */
+
+#include <eo>
+#include <eoPopEvalFunc.h>
+#include <es.h>
+#include <ga.h>
+#include <eoInt.h>
+#include <eoRealParticle.h>
+
+#include <core/moeoObjectiveVectorTraits.h>
+#include <core/moeoRealObjectiveVector.h>
+#include <core/moeoRealVector.h>
+#include <core/moeoIntVector.h>
+#include <core/moeoBitVector.h>
+
+#include <mpi/eoMpi.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+static_assert( eo::mpi::BinaryTraits< eoReal< eoMinimizingFitness > >::available, "eoReal should be sent in binary" );
+static_assert( eo::mpi::BinaryTraits< eoBit< double > >::available, "eoBit should be sent in binary" );
+static_assert( eo::mpi::BinaryTraits< eoInt< eoMaximizingFitness, int > >::available, "eoInt should be sent in binary" );
+
+typedef moeoRealObjectiveVector< moeoObjectiveVectorTraits > ObjectiveVector;
+
+static_assert( eo::mpi::BinaryTraits< moeoRealVector< ObjectiveVector > >::available, "moeoRealVector should be sent in binary" );
+static_assert( eo::mpi::BinaryTraits< moeoIntVector< ObjectiveVector > >::available, "moeoIntVector should be sent in binary" );
+static_assert( eo::mpi::BinaryTraits< moeoBitVector< ObjectiveVector > >::available, "moeoBitVector should be sent in binary" );
+
+/*
+ * The representations holding more than a genome and a fitness, and the Persistent ones, keep their own format.
+ */
+class PersistentReal : public eoReal< double >, public eoserial::Persistent
+{
+    public:
+    eoserial::Object* pack() const;
+    void unpack( const eoserial::Object* obj );
+};
+
+static_assert( !eo::mpi::BinaryTraits< PersistentReal >::available, "a Persistent eoReal should be sent as JSON" );
+static_assert( !eo::mpi::BinaryTraits< eoRealParticle< double > >::available, "eoRealParticle should not be sent in binary" );
+static_assert( !eo::mpi::BinaryTraits< eoEsStdev< double > >::available, "eoEsStdev should not be sent in binary" );
+
+/*
+ * Sum of the squares of the genes.
+ */
+template< class EOT >
+class SquareEval : public eoEvalFunc< EOT >
+{
+    public:
+    void operator()( EOT & eo )
+    {
+        if( eo.invalid() )
+        {
+            double sum = 0;
+            for( unsigned i = 0; i < eo.size(); ++i )
+            {
+                sum += double( eo[i] ) * double( eo[i] );
+            }
+            eo.fitness( sum );
+        }
+    }
+};
+
+/*
+ * Sum of the squares of the genes and number of genes as objectives, their difference as fitness and their ratio as
+ * diversity.
+ */
+template< class EOT >
+class MoeoSquareEval : public eoEvalFunc< EOT >
+{
+    public:
+    void operator()( EOT & eo )
+    {
+        if( eo.invalidObjectiveVector() )
+        {
+            ObjectiveVector objectives;
+            objectives[0] = 0;
+            for( unsigned i = 0; i < eo.size(); ++i )
+            {
+                objectives[0] += double( eo[i] ) * double( eo[i] );
+            }
+            objectives[1] = eo.size();
+            eo.objectiveVector( objectives );
+            eo.fitness( objectives[0] - objectives[1] );
+            eo.diversity( objectives[0] / objectives[1] );
+        }
+    }
+};
+
+/*
+ * Is true if the objective vectors, fitnesses, diversities (or their invalidity) and genomes are the same.
+ */
+template< class EOT >
+bool same( const EOT & a, const EOT & b )
+{
+    return a.invalidObjectiveVector() == b.invalidObjectiveVector()
+        && ( a.invalidObjectiveVector() || a.objectiveVector() == b.objectiveVector() )
+        && a.invalidFitness() == b.invalidFitness() && ( a.invalidFitness() || a.fitness() == b.fitness() )
+        && a.invalidDiversity() == b.invalidDiversity() && ( a.invalidDiversity() || a.diversity() == b.diversity() )
+        && static_cast< const vector< typename EOT::AtomType > & >( a ) == static_cast< const vector< typename EOT::AtomType > & >( b );
+}
+
+/*
+ * Evaluates a population in parallel and checks the fitnesses and the genomes against a sequential evaluation.
+ * The last individual is already evaluated with a wrong fitness, which must be kept.
+ */
+template< class EOT >
+bool check( eoInit< EOT > & init, const string & name )
+{
+    SquareEval< EOT > eval;
+    eo::mpi::DynamicAssignmentAlgorithm assign;
+    bool ok = true;
+
+    if( eo::mpi::Node::comm().rank() == eo::mpi::DEFAULT_MASTER )
+    {
+        eoPop< EOT > pop( 50, init );
+        pop.back().fitness( -1 );
+        eoPop< EOT > reference = pop;
+        for( unsigned i = 0; i < reference.size(); ++i )
+        {
+            eval( reference[i] );
+        }
+
+        eoParallelPopLoopEval< EOT > popEval( assign, eo::mpi::DEFAULT_MASTER, eval, 3 );
+        popEval( pop, pop );
+
+        for( unsigned i = 0; i < pop.size(); ++i )
+        {
+            if( pop[i].invalid() || pop[i].fitness() != reference[i].fitness()
+                || static_cast< vector< typename EOT::AtomType > & >( pop[i] ) != static_cast< vector< typename EOT::AtomType > & >( reference[i] ) )
+            {
+                ok = false;
+            }
+        }
+        cout << "[" << name << "]\t=>\t" << ( ok ? "OK" : "ERROR" ) << endl;
+    } else {
+        eoPop< EOT > pop;
+        eoParallelPopLoopEval< EOT > popEval( assign, eo::mpi::DEFAULT_MASTER, eval );
+        popEval( pop, pop );
+    }
+    return ok;
+}
+
+/*
+ * Same as check, for the multi-objective individuals. The last individual already has an objective vector and a
+ * fitness, but no diversity, which must be kept.
+ */
+template< class EOT >
+bool checkMoeo( eoInit< EOT > & init, const string & name )
+{
+    MoeoSquareEval< EOT > eval;
+    eo::mpi::DynamicAssignmentAlgorithm assign;
+    bool ok = true;
+
+    if( eo::mpi::Node::comm().rank() == eo::mpi::DEFAULT_MASTER )
+    {
+        eoPop< EOT > pop( 50, init );
+        ObjectiveVector objectives;
+        objectives[0] = -1;
+        objectives[1] = -2;
+        pop.back().objectiveVector( objectives );
+        pop.back().fitness( -3 );
+        eoPop< EOT > reference = pop;
+        for( unsigned i = 0; i < reference.size(); ++i )
+        {
+            eval( reference[i] );
+        }
+
+        eoParallelPopLoopEval< EOT > popEval( assign, eo::mpi::DEFAULT_MASTER, eval, 3 );
+        popEval( pop, pop );
+
+        for( unsigned i = 0; i < pop.size(); ++i )
+        {
+            if( !same( pop[i], reference[i] ) )
+            {
+                ok = false;
+            }
+        }
+        ok = ok && pop.back().invalidDiversity() && pop.back().fitness() == -3;
+        cout << "[" << name << "]\t=>\t" << ( ok ? "OK" : "ERROR" ) << endl;
+    } else {
+        eoPop< EOT > pop;
+        eoParallelPopLoopEval< EOT > popEval( assign, eo::mpi::DEFAULT_MASTER, eval );
+        popEval( pop, pop );
+    }
+    return ok;
+}
+
+int main( int ac, char** av )
+{
+    eo::mpi::Node::init( ac, av );
+    eo::log << eo::setlevel( eo::quiet );
+
+    eoUniformGenerator< double > realGen( -5, 5 );
+    eoInitFixedLength< eoReal< eoMinimizingFitness > > realInit( 100, realGen );
+
+    eoUniformGenerator< int > intGen( -100, 100 );
+    eoInitFixedLength< eoInt< eoMaximizingFitness, int > > intInit( 20, intGen );
+
+    eoUniformGenerator< bool > bitGen;
+    eoInitFixedLength< eoBit< double > > bitInit( 64, bitGen );
+
+    bool ok = check( realInit, "eoReal" );
+    ok = check( intInit, "eoInt" ) && ok;
+    ok = check( bitInit, "eoBit" ) && ok;
+
+    vector< bool > minimizing( 2, true );
+    moeoObjectiveVectorTraits::setup( 2, minimizing );
+
+    eoInitFixedLength< moeoRealVector< ObjectiveVector > > moeoRealInit( 100, realGen );
+    eoInitFixedLength< moeoIntVector< ObjectiveVector > > moeoIntInit( 20, intGen );
+    eoInitFixedLength< moeoBitVector< ObjectiveVector > > moeoBitInit( 64, bitGen );
+
+    ok = checkMoeo( moeoRealInit, "moeoRealVector" ) && ok;
+    ok = checkMoeo( moeoIntInit, "moeoIntVector" ) && ok;
+    ok = checkMoeo( moeoBitInit, "moeoBitVector" ) && ok;
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
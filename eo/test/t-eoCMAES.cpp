@@ -58,8 +58,8 @@ int main(int argc, char* argv[]) {
     char** rargv = new char*[argc+1];
     rargv[0] = argv[0];
     rargv[1] = (char*)"-N10";
-    for (int i = 2; i < argc; ++i) {
-	rargv[i] = argv[i-1];
+    for (int i = 1; i < argc; ++i) {
+	rargv[i+1] = argv[i];
     }
 
     eoParser parser(argc+1, rargv);
@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------------
+// t-eoCMAESVariants.cpp
+//-----------------------------------------------------------------------------
+
+#include <cassert>
+#include <iostream>
+
+#include <eoScalarFitness.h>
+#include <eoVector.h>
+#include <eoPop.h>
+#include <utils/eoRNG.h>
+
+#include <es/CMAState.h>
+#include <es/CMAParams.h>
+#include <es/eoCMAInit.h>
+#include <es/eoCMABreed.h>
+
+using namespace std;
+
+typedef eoMinimizingFitness FitT;
+typedef eoVector<FitT, double> EoType;
+
+double f_sphere(const vector<double>& values)
+{
+    double sum = 0.0;
+    for (unsigned i = 0; i < values.size(); ++i)
+        sum += values[i] * values[i];
+    return sum;
+}
+
+/** Best fitness reached by a (mu,lambda) CMA-ES after the given number of generations */
+double run(eo::CMAParams& params, unsigned generations)
+{
+    rng.reseed(42);
+    eo::CMAState state(params, vector<double>(params.n, 1.0));
+    eoCMAInit<FitT> init(state);
+    eoCMABreed<FitT> breed(state, params.lambda);
+
+    eoPop<EoType> parents(params.mu, init), offspring;
+    for (unsigned i = 0; i < parents.size(); ++i)
+        parents[i].fitness(f_sphere(parents[i]));
+
+    for (unsigned g = 0; g < generations; ++g) {
+        breed(parents, offspring);
+        for (unsigned i = 0; i < offspring.size(); ++i)
+            offspring[i].fitness(f_sphere(offspring[i]));
+        offspring.nth_element(params.mu);
+        offspring.resize(params.mu);
+        parents.swap(offspring);
+    }
+    return parents.best_element().fitness();
+}
+
+int main()
+{
+    const unsigned n = 20;
+    eo::CMAParams params;
+    params.defaults(n, 1000);
+
+    // Lazy eigen decompositions are computed every few generations only
+    assert(params.eigenInterval >= 1);
+
+    eo::CMAParams::Variant variants[] = {eo::CMAParams::full, eo::CMAParams::separable, eo::CMAParams::limited_memory};
+    for (unsigned v = 0; v < 3; ++v) {
+        params.variant = variants[v];
+        double best = run(params, 400);
+        cout << "variant " << variants[v] << ": " << best << endl;
+        assert(best < 1e-8);
+    }
+
+    // Decomposing C at every generation or lazily converges the same way
+    params.variant = eo::CMAParams::full;
+    params.eigenInterval = 1;
+    assert(run(params, 400) < 1e-8);
+    params.eigenInterval = 5;
+    assert(run(params, 400) < 1e-8);
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+//-----------------------------------------------------------------------------
+// t-eoEvalCache.cpp
+//-----------------------------------------------------------------------------
+
+#include <atomic>
+#include <thread>
+
+#include <eo>
+#include <ga.h>
+#include <es.h>
+
+//-----------------------------------------------------------------------------
+
+typedef eoBit<double> Bits;
+typedef eoReal<double> Real;
+
+/// counts its calls, from any thread
+class OneMax : public eoEvalFunc<Bits>
+{
+public:
+    OneMax() : calls(0) {}
+
+    void operator()(Bits& _eo)
+    {
+        calls++;
+        _eo.fitness(std::count(_eo.begin(), _eo.end(), true));
+    }
+
+    std::atomic<unsigned long> calls;
+};
+
+class Sphere : public eoEvalFunc<Real>
+{
+public:
+    void operator()(Real& _eo)
+    {
+        double sum = 0;
+        for (unsigned i = 0; i < _eo.size(); ++i)
+            sum += _eo[i] * _eo[i];
+        _eo.fitness(sum);
+    }
+};
+
+bool check(bool _ok, std::string _what)
+{
+    if (!_ok)
+        std::cout << "wrong " << _what << std::endl;
+    return _ok;
+}
+
+/// a population of _size bit strings, every one of the _distinct first ones being repeated
+eoPop<Bits> population(unsigned _size, unsigned _distinct)
+{
+    eoUniformGenerator<bool> uGen;
+    eoInitFixedLength<Bits> init(100, uGen);
+    eoPop<Bits> pop(_distinct, init);
+    for (unsigned i = _distinct; i < _size; ++i)
+        pop.push_back(pop[i % _distinct]);
+    return pop;
+}
+
+int main(int argc, char** argv)
+{
+    rng.reseed(42);
+    bool ok = true;
+
+    // the duplicates are not evaluated, and get the same fitness
+    {
+        OneMax oneMax;
+        eoEvalCache<Bits> cache(oneMax);
+        eoEvalCacheStat<Bits> stat(cache);
+        eoPopLoopEval<Bits> popEval(cache);
+        eoPop<Bits> pop = population(100, 60);
+        eoPop<Bits> empty;
+        popEval(empty, pop);
+        stat(pop);
+        ok &= check(oneMax.calls == 60, "number of evaluations");
+        ok &= check(cache.hits() == 40 && cache.misses() == 60 && cache.size() == 60, "hits and misses");
+        ok &= check(stat.value() == 0.4 && stat.hitCount().value() == 40, "hit rate");
+        for (unsigned i = 60; i < 100; ++i)
+            ok &= check(pop[i].fitness() == pop[i - 60].fitness(), "fitness of a duplicate");
+
+        // a modified individual is evaluated again, its former genotype is found again
+        pop[0][0] = !pop[0][0];
+        pop[0].invalidate();
+        cache(pop[0]);
+        ok &= check(oneMax.calls == 61 && pop[0].fitness() == std::count(pop[0].begin(), pop[0].end(), true), "modified individual");
+        pop[0][0] = !pop[0][0];
+        pop[0].invalidate();
+        cache(pop[0]);
+        ok &= check(oneMax.calls == 61 && pop[0].fitness() == pop[60].fitness(), "genotype found again");
+        stat(pop);
+        ok &= check(stat.value() == 0.5 && stat.missCount().value() == 1, "hit rate since the previous call");
+    }
+
+    // the vectors of real numbers, with a bounded cache
+    {
+        Sphere sphere;
+        eoEvalFuncCounter<Real> counter(sphere);
+        eoEvalCache<Real> cache(counter, 10, 4);
+        eoUniformGenerator<double> uGen(-1, 1);
+        eoInitFixedLength<Real> init(5, uGen);
+        eoPop<Real> pop(1000, init);
+        for (unsigned i = 0; i < pop.size(); ++i)
+            cache(pop[i]);
+        ok &= check(counter.value() == 1000 && cache.size() <= 10 && cache.size() == cache.capacity(), "bounded cache");
+        Real copy = pop.back();
+        copy.invalidate();
+        cache(copy);
+        ok &= check(counter.value() == 1000 && copy.fitness() == pop.back().fitness(), "last vector found");
+    }
+
+    // the capacity is not rounded down to a multiple of the number of shards
+    {
+        OneMax oneMax;
+        eoEvalCache<Bits> cache(oneMax, 100, 64);
+        eoPop<Bits> pop = population(1000, 1000);
+        for (unsigned i = 0; i < pop.size(); ++i)
+            cache(pop[i]);
+        ok &= check(cache.capacity() == 100 && cache.size() == 100, "capacity spread over the shards");
+    }
+
+    // the clock keeps the fitnesses used since its last turn
+    {
+        OneMax oneMax;
+        eoEvalCache<Bits> cache(oneMax, 4, 1);
+        eoPop<Bits> pop = population(5, 5);
+        for (unsigned i = 0; i < 4; ++i)
+            cache(pop[i]);
+        Bits copy = pop[0];
+        copy.invalidate();
+        cache(copy);
+        cache(pop[4]);
+        ok &= check(cache.size() == 4 && oneMax.calls == 5, "replacement");
+        copy.invalidate();
+        cache(copy);
+        ok &= check(oneMax.calls == 5, "used fitness kept");
+        copy = pop[1];
+        copy.invalidate();
+        cache(copy);
+        ok &= check(oneMax.calls == 6, "unused fitness replaced");
+    }
+
+    // the cache is disabled on the command line
+    {
+        const char* args[] = {argv[0], "--eval-cache-size=0"};
+        eoParser parser(2, const_cast<char**>(args));
+        OneMax oneMax;
+        eoEvalCache<Bits> cache(oneMax, parser);
+        eoPop<Bits> pop = population(10, 5);
+        for (unsigned i = 0; i < pop.size(); ++i)
+            cache(pop[i]);
+        ok &= check(oneMax.calls == 10 && cache.capacity() == 0, "disabled cache");
+    }
+
+    // several threads share the cache
+    {
+        OneMax oneMax;
+        eoEvalCache<Bits> cache(oneMax, 1000, 8);
+        const eoPop<Bits> pop = population(400, 100);
+        const unsigned threads = 4;
+        std::vector< eoPop<Bits> > pops(threads, pop);
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads; ++t)
+            workers.push_back(std::thread([&cache, &pops, t]() {
+                for (unsigned i = 0; i < pops[t].size(); ++i)
+                    cache(pops[t][i]);
+            }));
+        for (unsigned t = 0; t < threads; ++t)
+            workers[t].join();
+        ok &= check(cache.hits() + cache.misses() == threads * pop.size() && cache.misses() == oneMax.calls, "hits and misses of the threads");
+        ok &= check(cache.size() == 100 && oneMax.calls >= 100, "fitnesses of the threads");
+        for (unsigned t = 0; t < threads; ++t)
+            for (unsigned i = 0; i < pop.size(); ++i)
+                ok &= check(pops[t][i].fitness() == std::count(pop[i].begin(), pop[i].end(), true), "fitness in a thread");
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// t-eoEvalProcessPool.cpp
+//-----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include <eo>
+#include <es.h>
+
+//-----------------------------------------------------------------------------
+
+typedef eoReal<double> Real;
+
+// the stand-in evaluator, copied next to the test
+const std::string evaluator = "sh t-eoEvalProcessPool.sh";
+
+bool check(bool _ok, std::string _what)
+{
+    if (!_ok)
+        std::cout << "wrong " << _what << std::endl;
+    return _ok;
+}
+
+/// true if the fitnesses are the ones of the sphere, computed as the evaluator does
+bool sphere(const eoPop<Real>& _pop)
+{
+    for (unsigned i = 0; i < _pop.size(); ++i)
+    {
+        double sum = 0;
+        for (unsigned j = 0; j < _pop[i].size(); ++j)
+            sum += _pop[i][j] * _pop[i][j];
+        if (_pop[i].invalid() || _pop[i].fitness() != sum)
+            return false;
+    }
+    return true;
+}
+
+/// true if the evaluation throws an eoSystemError
+bool throws(eoEvalProcessPool<Real>& _eval, eoPop<Real>& _pop)
+{
+    eoPop<Real> parents;
+    try
+    {
+        _eval(parents, _pop);
+    }
+    catch (eoSystemError& e)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    rng.reseed(42);
+    eoUniformGenerator<double> uGen(-1, 1);
+    eoInitFixedLength<Real> init(5, uGen);
+    eoPop<Real> parents;
+    bool ok = true;
+
+    // the workers are kept from one generation to the next, the valid individuals are not sent
+    {
+        eoEvalProcessPool<Real> eval(evaluator, 3, 7, 2);
+        for (unsigned g = 0; g < 3; ++g)
+        {
+            eoPop<Real> pop(200, init);
+            for (unsigned i = 0; i < pop.size(); i += 10)
+                pop[i].fitness(-1);
+            eval(parents, pop);
+            for (unsigned i = 0; i < pop.size(); i += 10)
+            {
+                ok &= check(pop[i].fitness() == -1, "valid individual");
+                pop[i].invalidate();
+            }
+            eval(parents, pop);
+            ok &= check(sphere(pop), "fitnesses");
+        }
+        eoPop<Real> empty;
+        eval(parents, empty);
+        ok &= check(eval.size() == 3 && eval.failures() == 0, "failures");
+    }
+
+    // the workers which exit are started again
+    {
+        eoEvalProcessPool<Real> eval(evaluator + " crash 2", 2, 5, 3);
+        eoPop<Real> pop(100, init);
+        eval(parents, pop);
+        ok &= check(sphere(pop), "fitnesses with crashes");
+        ok &= check(eval.failures() > 0, "failures of the crashed workers");
+    }
+
+    // a hung worker is killed after the timeout
+    {
+        const char* marker = "t-eoEvalProcessPool.hang";
+        std::remove(marker);
+        eoEvalProcessPool<Real> eval(evaluator + " hang " + marker, 2, 4, 2, 0.5);
+        eoPop<Real> pop(50, init);
+        eval(parents, pop);
+        ok &= check(sphere(pop), "fitnesses with a hung worker");
+        ok &= check(eval.failures() == 1, "failure after a timeout");
+        std::remove(marker);
+    }
+
+    // the requests failing too many times throw
+    {
+        eoEvalProcessPool<Real> garbage(evaluator + " garbage", 2, 4, 2, 0, 1);
+        eoPop<Real> pop(10, init);
+        ok &= check(throws(garbage, pop), "malformed fitness");
+
+        eoEvalProcessPool<Real> failing("exit 3", 2);
+        ok &= check(throws(failing, pop) && failing.failures() == 3, "failing command");
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
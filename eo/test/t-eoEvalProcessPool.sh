@@ -0,0 +1,37 @@
+#!/bin/sh
+# Stand-in of an external evaluator for eoEvalProcessPool: answers the
+# requests of eoReal individuals with the sum of the squares of their values.
+#
+# Usage: t-eoEvalProcessPool.sh [mode] [argument]
+#   sphere            answers every request (the default)
+#   crash N           exits without answering its request number N+1
+#   hang FILE         sleeps on its first request if it is the first to create the directory FILE
+#   garbage           answers fitnesses which cannot be read
+
+# mawk reads its input by blocks, unless interactive
+case `awk -W version 2>&1` in
+    *mawk*) interactive="-W interactive" ;;
+esac
+
+exec awk $interactive -v mode="${1:-sphere}" -v arg="$2" '
+left == 0 {
+    id = $1; left = $2; requests++
+    if (mode == "crash" && requests > arg)
+        exit 3
+    if (mode == "hang" && system("mkdir " arg " 2>/dev/null") == 0)
+        system("sleep 60")
+    response = id " " left
+    next
+}
+{
+    # INVALID <size> <values>
+    sum = 0
+    for (i = 3; i <= NF; i++)
+        sum += $i * $i
+    response = response "\n" (mode == "garbage" ? "unreadable" : sprintf("%.17g", sum))
+    if (--left == 0) {
+        print response
+        fflush()
+    }
+}
+'
@@ -15,6 +15,7 @@
    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 
+#include <cassert>
 #include <iostream>
 #include <string>
 
@@ -24,13 +25,32 @@
 
 using EOT = eoBit<double>;
 
+/** Count the calls to the wrapped population evaluator. */
+class eoCountPopEval : public eoPopEvalFunc<EOT>
+{
+public:
+    eoCountPopEval(eoPopEvalFunc<EOT>& eval) : _eval(eval), calls(0) {}
+
+    void operator()(eoPop<EOT>& parents, eoPop<EOT>& offsprings)
+    {
+        _eval(parents, offsprings);
+        calls++;
+    }
+
+protected:
+    eoPopEvalFunc<EOT>& _eval;
+public:
+    size_t calls;
+};
+
 int main(int /*argc*/, char** /*argv*/)
 {
     size_t dim = 100;
     size_t pop_size = 10;
 
     oneMaxEval<EOT> evalfunc;
-    eoPopLoopEval<EOT> eval(evalfunc);
+    eoPopLoopEval<EOT> loop_eval(evalfunc);
+    eoCountPopEval eval(loop_eval);
 
     eoBooleanGenerator gen(0.5);
     eoInitFixedLength<EOT> init(dim, gen);
@@ -65,8 +85,18 @@ int main(int /*argc*/, char** /*argv*/)
     eoPop<EOT> pop;
     pop.append(pop_size, init);
     eval(pop,pop);
+    eval.calls = 0;
 
     algo(pop);
 
     std::cout << pop.best_element() << std::endl;
+
+    // Offsprings are evaluated by batches: at most one call for
+    // all crossed pairs and one for all offsprings, per generation.
+    size_t generations = dim*2;
+    assert(eval.calls <= 2 * generations);
+    assert(eval.calls >= generations);
+    for(auto& sol : pop) {
+        assert(not sol.invalid());
+    }
 }
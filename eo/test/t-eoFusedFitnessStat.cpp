@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+// t-eoFusedFitnessStat.cpp
+//-----------------------------------------------------------------------------
+
+#include <sstream>
+
+#include <eo>
+#include <es.h>
+#include <utils/eoFusedFitnessStat.h>
+
+//-----------------------------------------------------------------------------
+
+bool close(double _a, double _b)
+{
+    return std::fabs(_a - _b) <= 1e-9 * std::max(1.0, std::fabs(_a));
+}
+
+bool check(bool _ok, std::string _what)
+{
+    if (!_ok)
+        std::cout << _what << " differs from the usual statistic" << std::endl;
+    return _ok;
+}
+
+// compares the fused statistic with the usual ones, on a population with ties
+template <class EOT>
+bool compare(unsigned _size, unsigned _chunkSize, bool _parallel)
+{
+    eoPop<EOT> pop;
+    for (unsigned i = 0; i < _size; i++)
+    {
+        EOT sol(3, 0.0);
+        for (unsigned k = 0; k < sol.size(); k++)
+            sol[k] = rng.uniform(-1, 1);
+        sol.fitness(std::floor(10 * (sol[0] * sol[0] + sol[1] * sol[1] + sol[2] * sol[2])) / 10);
+        pop.push_back(sol);
+    }
+
+    eoQuadDistance<EOT> dist;
+    eoAverageStat<EOT> average;
+    eoSecondMomentStats<EOT> secondMoment;
+    eoBestFitnessStat<EOT> best;
+    eoNthElementFitnessStat<EOT> third(2);
+    eoNthElementStat<EOT> median(0.5, "Median");
+    eoInterquartileRangeStat<EOT> iqr;
+    eoScalarFitnessStat<EOT> fitnesses;
+    eoFDCStat<EOT> fdc(dist);
+
+    eoFusedFitnessStat<EOT> fused(_parallel, _chunkSize);
+    eoValueParam<typename EOT::Fitness>& fusedAverage = fused.average();
+    eoValueParam<std::pair<double, double> >& fusedSecondMoment = fused.secondMoment();
+    eoValueParam<typename EOT::Fitness>& fusedBest = fused.best();
+    eoValueParam<typename EOT::Fitness>& fusedWorst = fused.worst();
+    eoValueParam<typename EOT::Fitness>& fusedThird = fused.nthElement(2);
+    eoValueParam<typename EOT::Fitness>& fusedMedian = fused.quantile(0.5);
+    eoValueParam<typename EOT::Fitness>& fusedIqr = fused.interquartileRange();
+    eoValueParam<std::vector<double> >& fusedFitnesses = fused.fitnesses();
+    eoValueParam<double>& fusedFdc = fused.fdc(dist);
+
+    eoGenContinue<EOT> continuator(10);
+    eoCheckPoint<EOT> checkpoint(continuator);
+    checkpoint.add(average);
+    checkpoint.add(secondMoment);
+    checkpoint.add(best);
+    checkpoint.add(third);
+    checkpoint.add(median);
+    checkpoint.add(iqr);
+    checkpoint.add(fitnesses);
+    checkpoint.add(fdc);
+    checkpoint.add(fused);
+
+    // the monitors are fed as with the usual statistics
+    std::ostringstream os;
+    eoOStreamMonitor monitor(os);
+    monitor.add(fusedBest);
+    monitor.add(fusedSecondMoment);
+    monitor.add(fusedMedian);
+    checkpoint.add(monitor);
+    checkpoint(pop);
+
+    bool ok = true;
+    ok &= check(close(fusedAverage.value(), average.value()), "average");
+    ok &= check(close(fusedSecondMoment.value().first, secondMoment.value().first) &&
+                close(fusedSecondMoment.value().second, secondMoment.value().second), "second moment");
+    ok &= check(fusedBest.value() == best.value(), "best");
+    ok &= check(fusedWorst.value() == pop.worse_element().fitness(), "worst");
+    ok &= check(fusedThird.value() == third.value(), "nth element");
+    ok &= check(fusedMedian.value() == median.value(), "median");
+    ok &= check(fusedIqr.value() == iqr.value(), "interquartile range");
+    ok &= check(fusedFitnesses.value() == fitnesses.value(), "fitnesses");
+    ok &= check(std::fabs(fusedFdc.value() - fdc.value()) <= 1e-9, "FDC");
+    ok &= check(os.str().find(fusedBest.getValue()) != std::string::npos, "monitor");
+    return ok;
+}
+
+int main()
+{
+    rng.reseed(42);
+    bool ok = true;
+    // a single chunk, then several, in sequence and in parallel
+    ok &= compare< eoReal<double> >(1000, 4096, false);
+    ok &= compare< eoReal<eoMinimizingFitness> >(1000, 4096, false);
+    ok &= compare< eoReal<double> >(10001, 64, false);
+    ok &= compare< eoReal<eoMinimizingFitness> >(10001, 64, true);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
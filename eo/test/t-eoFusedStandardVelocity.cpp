@@ -0,0 +1,84 @@
+//-----------------------------------------------------------------------------
+// t-eoFusedStandardVelocity.cpp
+//-----------------------------------------------------------------------------
+
+#include <eo>
+
+//-----------------------------------------------------------------------------
+typedef eoMinimizingFitness FitT;
+typedef eoRealParticle < FitT > Particle;
+//-----------------------------------------------------------------------------
+
+// the objective function
+double real_value (const Particle & _particle)
+{
+    double sum = 0;
+    for (unsigned i = 0; i < _particle.size (); i++)
+        sum += pow(_particle[i],2);
+    return (sum);
+}
+
+const unsigned VEC_SIZE = 37;
+const unsigned POP_SIZE = 30;
+
+// builds and initializes a swarm
+void init(eoPop < Particle > & _pop, eoTopology < Particle > & _topology, eoEvalFunc < Particle > & _eval)
+{
+    rng.reseed(42);
+    eoUniformGenerator < double > uGen (-3, 3);
+    eoInitFixedLength < Particle > random (VEC_SIZE, uGen);
+    eoUniformGenerator < double > sGen (-2, 2);
+    eoVelocityInitFixedLength < Particle > veloRandom (VEC_SIZE, sGen);
+    eoFirstIsBestInit < Particle > localInit;
+    _pop.append (POP_SIZE, random);
+    eoInitializer < Particle > initializer(_eval, veloRandom, localInit, _topology, _pop);
+    initializer();
+}
+
+// runs the same PSO with an eoStandardVelocity and an eoStandardFlight, then with an eoFusedStandardVelocity
+bool check(eoTopology < Particle > & _topology1, eoTopology < Particle > & _topology2, const std::string & _name)
+{
+    eoEvalFuncPtr < Particle, double, const Particle & > eval (real_value);
+    eoRealVectorBounds velocityBounds (VEC_SIZE, -1.5, 1.5);
+    eoRealVectorBounds flightBounds (VEC_SIZE, -2.5, 2.5);
+
+    eoPop < Particle > pop1;
+    init(pop1, _topology1, eval);
+    eoStandardVelocity < Particle > velocity (_topology1, 0.7, 1.6, 2, velocityBounds);
+    eoStandardFlight < Particle > flight (flightBounds);
+    eoGenContinue < Particle > genCont1 (30);
+    eoSyncEasyPSO < Particle > pso1 (genCont1, eval, velocity, flight);
+    pso1 (pop1);
+
+    eoPop < Particle > pop2;
+    init(pop2, _topology2, eval);
+    eoFusedStandardVelocity < Particle > fused (_topology2, 0.7, 1.6, 2, velocityBounds, flightBounds);
+    eoGenContinue < Particle > genCont2 (30);
+    eoSyncEasyPSO < Particle > pso2 (genCont2, eval, fused);
+    pso2 (pop2);
+
+    for (unsigned i = 0; i < POP_SIZE; i++)
+    {
+        if (pop1[i] != pop2[i] || pop1[i].velocities != pop2[i].velocities
+            || pop1[i].bestPositions != pop2[i].bestPositions || pop1[i].fitness() != pop2[i].fitness())
+        {
+            std::cout << "[" << _name << "] different particle " << i << std::endl;
+            return false;
+        }
+    }
+    std::cout << "[" << _name << "] OK" << std::endl;
+    return true;
+}
+
+int main()
+{
+    eoStarTopology < Particle > star1, star2;
+    eoRingTopology < Particle > ring1 (5), ring2 (5);
+    eoLinearTopology < Particle > linear1 (5), linear2 (5);
+
+    bool ok = check(star1, star2, "eoStarTopology");
+    ok = check(ring1, ring2, "eoRingTopology") && ok;
+    ok = check(linear1, linear2, "eoLinearTopology") && ok;
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
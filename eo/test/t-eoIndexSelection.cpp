@@ -0,0 +1,163 @@
+//-----------------------------------------------------------------------------
+// t-eoIndexSelection.cpp
+//-----------------------------------------------------------------------------
+
+#include <eo>
+#include <ga.h>
+
+//-----------------------------------------------------------------------------
+typedef eoBit<double> Chrom;
+//-----------------------------------------------------------------------------
+
+const unsigned POP_SIZE = 40;
+const unsigned CHROM_SIZE = 64;
+
+double oneMax(const Chrom & _chrom)
+{
+    return std::count(_chrom.begin(), _chrom.end(), true);
+}
+
+bool same(const eoPop<Chrom> & _a, const eoPop<Chrom> & _b)
+{
+    if (_a.size() != _b.size())
+        return false;
+    for (unsigned i = 0; i < _a.size(); i++)
+        if (_a[i] != _b[i] || _a[i].invalid() != _b[i].invalid() || (!_a[i].invalid() && _a[i].fitness() != _b[i].fitness()))
+            return false;
+    return true;
+}
+
+// index() draws the same numbers as operator(), and gives the same individual
+bool checkIndex(eoSelectOne<Chrom> & _select, const eoPop<Chrom> & _pop)
+{
+    _select.setup(_pop);
+    rng.reseed(7);
+    std::vector<const Chrom*> selected;
+    for (unsigned i = 0; i < 100; i++)
+        selected.push_back(&_select(_pop));
+    rng.reseed(7);
+    for (unsigned i = 0; i < 100; i++)
+        if (&_pop[_select.index(_pop)] != selected[i])
+            return false;
+    return true;
+}
+
+// the former eoSGA, which copies the selected parents
+void referenceSGA(eoSelectOne<Chrom> & _select, eoQuadOp<Chrom> & _cross, eoMonOp<Chrom> & _mutate,
+                  eoEvalFunc<Chrom> & _eval, unsigned _generations, eoPop<Chrom> & _pop)
+{
+    eoSelectPerc<Chrom> select(_select);
+    eoInvalidateQuadOp<Chrom> cross(_cross);
+    eoInvalidateMonOp<Chrom> mutate(_mutate);
+    eoPop<Chrom> offspring;
+    for (unsigned g = 0; g < _generations; g++)
+    {
+        select(_pop, offspring);
+        for (unsigned i = 0; i < _pop.size() / 2; i++)
+            if (rng.flip(0.8) && cross(offspring[2 * i], offspring[2 * i + 1]))
+            {
+                offspring[2 * i].invalidate();
+                offspring[2 * i + 1].invalidate();
+            }
+        for (unsigned i = 0; i < offspring.size(); i++)
+            if (rng.flip(0.2) && mutate(offspring[i]))
+                offspring[i].invalidate();
+        _pop.swap(offspring);
+        apply<Chrom>(_eval, _pop);
+    }
+}
+
+// the replacement which moves gives the same population as the copies
+bool checkReplacement(eoReplacement<Chrom> & _replace, eoMerge<Chrom> & _merge, eoReduce<Chrom> & _reduce,
+                      const eoPop<Chrom> & _parents, const eoPop<Chrom> & _offspring)
+{
+    eoPop<Chrom> parents(_parents), offspring(_offspring);
+    rng.reseed(3);
+    _replace(parents, offspring);
+
+    eoPop<Chrom> reference(_offspring);
+    rng.reseed(3);
+    _merge(_parents, reference);
+    _reduce(reference, _parents.size());
+    return same(parents, reference);
+}
+
+int main()
+{
+    eoEvalFuncPtr<Chrom, double, const Chrom &> eval(oneMax);
+    eoUniformGenerator<bool> uniform;
+    eoInitFixedLength<Chrom> init(CHROM_SIZE, uniform);
+    rng.reseed(1);
+    eoPop<Chrom> pop(POP_SIZE, init);
+    apply<Chrom>(eval, pop);
+
+    bool ok = true;
+
+    eoDetTournamentSelect<Chrom> detTournament(3);
+    eoStochTournamentSelect<Chrom> stochTournament(0.8);
+    eoProportionalSelect<Chrom> proportional;
+    eoRandomSelect<Chrom> random;
+    eoBestSelect<Chrom> best;
+    eoSelectOne<Chrom>* selectors[] = {&detTournament, &stochTournament, &proportional, &random, &best};
+    for (unsigned s = 0; s < 5; s++)
+    {
+        if (!checkIndex(*selectors[s], pop))
+        {
+            std::cout << "index() differs from operator() for the selector " << s << std::endl;
+            ok = false;
+        }
+    }
+
+    // eoSGA is unchanged
+    eo1PtBitXover<Chrom> xover;
+    eoBitMutation<Chrom> mutation(1.0 / CHROM_SIZE);
+    eoGenContinue<Chrom> continuator(30);
+    eoSGA<Chrom> sga(detTournament, xover, 0.8, mutation, 0.2, eval, continuator);
+    eoPop<Chrom> sgaPop(pop), referencePop(pop);
+    rng.reseed(11);
+    sga(sgaPop);
+    rng.reseed(11);
+    referenceSGA(detTournament, xover, mutation, eval, 30, referencePop);
+    if (!same(sgaPop, referencePop))
+    {
+        std::cout << "eoSGA differs from the copying implementation" << std::endl;
+        ok = false;
+    }
+
+    // the replacements which move the parents
+    eoPop<Chrom> offspring(POP_SIZE, init);
+    apply<Chrom>(eval, offspring);
+    eoPlus<Chrom> plus;
+    eoElitism<Chrom> elitism(0.25);
+    eoTruncate<Chrom> truncate;
+    eoEPReduce<Chrom> epReduce(4);
+    eoMergeReduce<Chrom> plusTruncate(plus, truncate), plusEP(plus, epReduce), eliteTruncate(elitism, truncate);
+    if (!checkReplacement(plusTruncate, plus, truncate, pop, offspring) ||
+        !checkReplacement(plusEP, plus, epReduce, pop, offspring) ||
+        !checkReplacement(eliteTruncate, elitism, truncate, pop, offspring))
+    {
+        std::cout << "a replacement differs from the copying implementation" << std::endl;
+        ok = false;
+    }
+
+    // the survivors are moved
+    eoDeterministicSaDReplacement<Chrom> sad(0.2, 0.1, 0.2, 0.1);
+    eoPop<Chrom> parents(pop), children(offspring);
+    sad(parents, children);
+    if (parents.size() != POP_SIZE || parents.best_element().fitness() < std::max(pop.best_element().fitness(), offspring.best_element().fitness()))
+    {
+        std::cout << "eoDeterministicSaDReplacement lost the best individual" << std::endl;
+        ok = false;
+    }
+    for (unsigned i = 0; i < parents.size(); i++)
+        if (parents[i].size() != CHROM_SIZE || parents[i].fitness() != oneMax(parents[i]))
+        {
+            std::cout << "eoDeterministicSaDReplacement gave a moved individual" << std::endl;
+            ok = false;
+            break;
+        }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,253 @@
+//-----------------------------------------------------------------------------
+// t-eoLinearParseTree.cpp
+//-----------------------------------------------------------------------------
+
+#include <sstream>
+
+#include <gp/eoParseTree.h>
+#include <gp/eoLinearParseTree.h>
+#include <gp/eoLinearParseTreeOp.h>
+#include <gp/eoSymregNode.h>
+#include <gp/eoSymregBlockEval.h>
+#include <eo>
+
+//-----------------------------------------------------------------------------
+typedef eoMinimizingFitness FitT;
+typedef eoParseTree < FitT, eoSymregNode > Tree;
+typedef eoLinearParseTree < FitT, eoSymregNode > LinearTree;
+//-----------------------------------------------------------------------------
+
+const unsigned MAX_SIZE = 60;
+const unsigned N_ROWS = 1000;
+
+// the nodes of the trees
+std::vector < eoSymregNode > nodes()
+{
+    std::vector < eoSymregNode > init;
+    init.push_back(eoSymregNode(eoSymregNode::Variable, 0));
+    init.push_back(eoSymregNode(eoSymregNode::Variable, 1));
+    init.push_back(eoSymregNode(eoSymregNode::Constant, 0, 0.5));
+    init.push_back(eoSymregNode(eoSymregNode::Constant, 0, 0.));
+    init.push_back(eoSymregNode(eoSymregNode::Constant, 0, 1. / 3.));
+    init.push_back(eoSymregNode(eoSymregNode::Plus));
+    init.push_back(eoSymregNode(eoSymregNode::Minus));
+    init.push_back(eoSymregNode(eoSymregNode::Multiplies));
+    init.push_back(eoSymregNode(eoSymregNode::Divides));
+    init.push_back(eoSymregNode(eoSymregNode::Negate));
+    init.push_back(eoSymregNode(eoSymregNode::Sin));
+    init.push_back(eoSymregNode(eoSymregNode::Cos));
+    return init;
+}
+
+// the labels of the nodes of a tree
+std::string labels(const Tree & _tree)
+{
+    std::ostringstream os;
+    std::copy(_tree.ebegin(), _tree.eend(), std::ostream_iterator < eoSymregNode > (os, " "));
+    return os.str();
+}
+
+std::string labels(const LinearTree & _tree)
+{
+    std::ostringstream os;
+    std::copy(_tree.begin(), _tree.end(), std::ostream_iterator < eoSymregNode > (os, " "));
+    return os.str();
+}
+
+// true if both values are equal, or both not a number
+bool same(double _a, double _b)
+{
+    return (_a == _b) || (_a != _a && _b != _b) || (std::fabs(_a - _b) <= 1e-12 * std::fabs(_a));
+}
+
+// applies the same operators on trees and on linear trees, and compares them
+bool checkOperators(eoParseTreeDepthInit < FitT, eoSymregNode > & _init, std::vector < eoSymregNode > & _nodes)
+{
+    // the mutations need an initializer without state, as it is called twice per generation
+    eoParseTreeDepthInit < FitT, eoSymregNode > grow(4, _nodes, true, false);
+
+    eoSubtreeXOver < FitT, eoSymregNode > xover(MAX_SIZE);
+    eoBranchMutation < FitT, eoSymregNode > mutation(grow, MAX_SIZE);
+    eoPointMutation < FitT, eoSymregNode > pointMutation(_nodes);
+
+    eoLinearParseTreeInit < FitT, eoSymregNode > linearInit(grow);
+    eoLinearSubtreeXOver < FitT, eoSymregNode > linearXover(MAX_SIZE);
+    eoLinearBranchMutation < FitT, eoSymregNode > linearMutation(linearInit, MAX_SIZE);
+    eoLinearPointMutation < FitT, eoSymregNode > linearPointMutation(_nodes);
+
+    rng.reseed(42);
+    eoPop < Tree > pop(30, _init);
+    eoPop < LinearTree > linearPop;
+    for (unsigned i = 0; i < pop.size(); i++)
+        linearPop.push_back(LinearTree(pop[i]));
+
+    for (unsigned g = 0; g < 50; g++)
+    {
+        rng.reseed(g + 1);
+        for (unsigned i = 0; i + 1 < pop.size(); i += 2)
+        {
+            xover(pop[i], pop[i + 1]);
+            mutation(pop[i]);
+            pointMutation(pop[i + 1]);
+        }
+        rng.reseed(g + 1);
+        for (unsigned i = 0; i + 1 < linearPop.size(); i += 2)
+        {
+            linearXover(linearPop[i], linearPop[i + 1]);
+            linearMutation(linearPop[i]);
+            linearPointMutation(linearPop[i + 1]);
+        }
+        for (unsigned i = 0; i < pop.size(); i++)
+        {
+            if (labels(pop[i]) != labels(linearPop[i]) || pop[i].size() > MAX_SIZE)
+            {
+                std::cout << "generation " << g << ", individual " << i << ":" << std::endl;
+                std::cout << labels(pop[i]) << std::endl << labels(linearPop[i]) << std::endl;
+                return false;
+            }
+        }
+    }
+
+    // conversion to a parse tree and persistence
+    for (unsigned i = 0; i < linearPop.size(); i++)
+    {
+        Tree tree(linearPop[i].toTree());
+        linearPop[i].fitness(i);
+        std::stringstream ss;
+        ss << linearPop[i];
+        LinearTree read(ss);
+        if (labels(tree) != labels(linearPop[i]) || labels(read) != labels(linearPop[i]) || read.fitness() != linearPop[i].fitness())
+            return false;
+        // the constants are read back exactly
+        if (read.size() != linearPop[i].size() || !std::equal(read.begin(), read.end(), linearPop[i].begin()))
+            return false;
+    }
+    return true;
+}
+
+// the dataset, with divisions by 0
+void dataset(std::vector < std::vector < double > > & _inputs, std::vector < double > & _target)
+{
+    _inputs.assign(2, std::vector < double > (N_ROWS));
+    _target.resize(N_ROWS);
+    for (unsigned r = 0; r < N_ROWS; r++)
+    {
+        _inputs[0][r] = rng.uniform(-2, 2);
+        _inputs[1][r] = (r % 10 == 0) ? 0. : rng.uniform(-2, 2);
+        _target[r] = _inputs[0][r] * _inputs[0][r] - _inputs[1][r];
+    }
+}
+
+// compares the block evaluation with the evaluation of the trees row by row
+bool checkEval(eoParseTreeDepthInit < FitT, eoSymregNode > & _init)
+{
+    std::vector < std::vector < double > > inputs;
+    std::vector < double > target;
+    dataset(inputs, target);
+    // a block size which does not divide the number of rows
+    eoSymregBlockEval < Tree > eval(inputs, target, 64);
+    eoSymregBlockEval < LinearTree > linearEval(inputs, target, 64);
+
+    rng.reseed(42);
+    eoPop < Tree > pop(100, _init);
+    std::vector < double > row(2), outputs, linearOutputs;
+    for (unsigned i = 0; i < pop.size(); i++)
+    {
+        LinearTree linear(pop[i]);
+        eval.predict(pop[i], outputs);
+        linearEval.predict(linear, linearOutputs);
+
+        double error = 0.0;
+        for (unsigned r = 0; r < N_ROWS; r++)
+        {
+            row[0] = inputs[0][r];
+            row[1] = inputs[1][r];
+            double output;
+            pop[i].apply(output, row);
+            if (!same(output, outputs[r]) || !same(output, linearOutputs[r]))
+            {
+                std::cout << "row " << r << " of individual " << i << ": " << output << " != " << outputs[r] << std::endl;
+                return false;
+            }
+            error += (output - target[r]) * (output - target[r]);
+        }
+        error = sqrt(error / N_ROWS);
+        if (!(error <= 1e+20))
+            error = 1e+20;
+
+        eval(pop[i]);
+        linearEval(linear);
+        if (!same(error, pop[i].fitness()) || !same(error, linear.fitness()))
+        {
+            std::cout << "fitness of individual " << i << ": " << error << " != " << pop[i].fitness() << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// evaluates populations by apply, with eo::parallel enabled, and compares them with a sequential evaluation
+bool checkParallel(eoParseTreeDepthInit < FitT, eoSymregNode > & _init, char* _name)
+{
+    std::vector < std::vector < double > > inputs;
+    std::vector < double > target;
+    dataset(inputs, target);
+    eoSymregBlockEval < Tree > eval(inputs, target, 64);
+    eoSymregBlockEval < LinearTree > linearEval(inputs, target, 64);
+    eoSubtreeCache < eoSymregNode > cache(1000);
+    eoSymregBlockEval < LinearTree > cachedEval(inputs, target, cache, 64);
+
+    rng.reseed(42);
+    eoPop < Tree > pop(200, _init);
+    eoPop < LinearTree > linearPop, cachedPop;
+    std::vector < double > errors(pop.size());
+    for (unsigned i = 0; i < pop.size(); i++)
+    {
+        linearPop.push_back(LinearTree(pop[i]));
+        errors[i] = linearEval.error(linearPop[i]);
+    }
+    cachedPop = linearPop;
+
+    const char* args[] = {_name, "--parallelize-loop=1"};
+    eoParser parser(2, const_cast < char** > (args));
+    make_parallel(parser);
+    apply < Tree > (eval, pop);
+    apply < LinearTree > (linearEval, linearPop);
+    apply < LinearTree > (cachedEval, cachedPop);
+
+    for (unsigned i = 0; i < pop.size(); i++)
+    {
+        if (!same(errors[i], pop[i].fitness()) || !same(errors[i], linearPop[i].fitness()) || !same(errors[i], cachedPop[i].fitness()))
+        {
+            std::cout << "parallel fitness of individual " << i << ": " << errors[i] << " != " << linearPop[i].fitness() << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int, char** argv)
+{
+    std::vector < eoSymregNode > init = nodes();
+    eoParseTreeDepthInit < FitT, eoSymregNode > initializer(6, init, true, true);
+
+    bool ok = true;
+    if (!checkOperators(initializer, init))
+    {
+        std::cout << "the operators of eoLinearParseTree differ from those of eoParseTree" << std::endl;
+        ok = false;
+    }
+    if (!checkEval(initializer))
+    {
+        std::cout << "eoSymregBlockEval differs from the evaluation of the trees" << std::endl;
+        ok = false;
+    }
+    if (!checkParallel(initializer, argv[0]))
+    {
+        std::cout << "eoSymregBlockEval differs when the individuals are evaluated in parallel" << std::endl;
+        ok = false;
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
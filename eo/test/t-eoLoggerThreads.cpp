@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+// t-eoLoggerThreads.cpp
+//-----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <eo>
+
+//-----------------------------------------------------------------------------
+
+bool check(bool _ok, std::string _what)
+{
+    if (!_ok)
+        std::cout << "wrong " << _what << std::endl;
+    return _ok;
+}
+
+unsigned formatted = 0;
+
+/// counts how many times a message is formatted
+std::string message(unsigned _i)
+{
+    formatted++;
+    std::ostringstream os;
+    os << "message " << _i;
+    return os.str();
+}
+
+int main()
+{
+    const char* fileName = "t-eoLoggerThreads.txt";
+    std::remove(fileName);
+
+    eo::log << eo::setlevel(eo::progress) << eo::file(fileName);
+    bool ok = true;
+
+    // the messages of the levels which are not selected are not formatted
+    EO_LOG(eo::debug) << message(0) << std::endl;
+    eo::log << eo::debug << 3.14 << std::endl;
+    ok &= check(formatted == 0, "short-circuit of the disabled levels");
+    ok &= check(!eo::log.good(), "state of a disabled level");
+    EO_LOG(eo::progress) << message(0) << std::endl;
+    ok &= check(formatted == 1 && eo::log.good(), "enabled level");
+
+    // every thread writes in its own ring, drained in the background
+    const unsigned threads = 4;
+    const unsigned messages = 20000;
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+        workers.push_back(std::thread([t, messages]() {
+            for (unsigned i = 0; i < messages; ++i)
+                EO_LOG(eo::progress) << "thread " << t << " message " << i << std::endl;
+        }));
+    for (unsigned t = 0; t < threads; ++t)
+        workers[t].join();
+
+    // a message longer than a ring is written at once
+    std::string longMessage(100000, 'x');
+    eo::log << eo::progress << longMessage << std::endl;
+    eo::log.wait();
+
+    std::ifstream is(fileName);
+    std::string line;
+    std::vector<unsigned> next(threads, 0);
+    unsigned lines = 0, longLines = 0;
+    bool ordered = true;
+    while (std::getline(is, line))
+    {
+        lines++;
+        unsigned t, i;
+        if (line == longMessage)
+            longLines++;
+        else if (std::sscanf(line.c_str(), "thread %u message %u", &t, &i) == 2)
+        {
+            ordered &= (t < threads && i == next[t]);
+            next[t] = i + 1;
+        }
+    }
+    ok &= check(lines == threads * messages + 2, "number of lines");
+    ok &= check(ordered, "order of the messages of each thread");
+    ok &= check(longLines == 1, "long message");
+
+    eo::log << std::cerr;
+    std::remove(fileName);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
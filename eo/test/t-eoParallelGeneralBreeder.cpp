@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// t-eoParallelGeneralBreeder.cpp
+//-----------------------------------------------------------------------------
+
+#include <set>
+
+#include <eo>
+#include <eoInt.h>
+#include <eoOrderXover.h>
+#include <eoSwapMutation.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//-----------------------------------------------------------------------------
+typedef eoInt<eoMinimizingFitness> Chrom;
+//-----------------------------------------------------------------------------
+
+const unsigned POP_SIZE = 50;
+const unsigned CHROM_SIZE = 30;
+
+// the number of inversions of the permutation
+class Inversions : public eoEvalFunc<Chrom>
+{
+public:
+    void operator()(Chrom & _chrom)
+    {
+        if (_chrom.invalid())
+        {
+            unsigned n = 0;
+            for (unsigned i = 0; i < _chrom.size(); i++)
+                for (unsigned j = i + 1; j < _chrom.size(); j++)
+                    n += _chrom[i] > _chrom[j];
+            _chrom.fitness(n);
+        }
+    }
+};
+
+bool isPermutation(const Chrom & _chrom)
+{
+    std::set<int> values(_chrom.begin(), _chrom.end());
+    return _chrom.size() == CHROM_SIZE && values.size() == CHROM_SIZE;
+}
+
+// breeds offspring from the same parents and seed, with the given number of threads
+eoPop<Chrom> breed(const eoPop<Chrom> & _parents, unsigned _threads, unsigned _offspring)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(_threads);
+#else
+    (void) _threads;
+#endif
+    eoDetTournamentSelect<Chrom> select(3);
+    eoOrderXover<Chrom> xover;
+    eoSwapMutation<Chrom> mutation;
+    eoSGAGenOp<Chrom> op(xover, 0.8, mutation, 0.3);
+    eoParallelGeneralBreeder<Chrom> breeder(select, op, _offspring, false, 3);
+
+    eoPop<Chrom> offspring;
+    rng.reseed(42);
+    breeder(_parents, offspring);
+    return offspring;
+}
+
+int main(int, char** argv)
+{
+    const char* args[] = {argv[0], "--parallelize-loop=1"};
+    eoParser parser(2, const_cast<char**>(args));
+    make_parallel(parser);
+
+    Inversions eval;
+    eoInitPermutation<Chrom> init(CHROM_SIZE);
+    rng.reseed(1);
+    eoPop<Chrom> parents(POP_SIZE, init);
+    apply<Chrom>(eval, parents);
+
+    bool ok = true;
+
+    // the offspring do not depend on the number of threads
+    eoPop<Chrom> reference = breed(parents, 1, 77);
+    for (unsigned threads = 2; threads <= 4; threads++)
+    {
+        eoPop<Chrom> offspring = breed(parents, threads, 77);
+        for (unsigned i = 0; i < offspring.size(); i++)
+        {
+            if (offspring[i] != reference[i])
+            {
+                std::cout << "the offspring " << i << " differ with " << threads << " threads" << std::endl;
+                ok = false;
+                break;
+            }
+        }
+    }
+
+    // the operators are applied, and only them
+    unsigned changed = 0;
+    for (unsigned i = 0; i < reference.size(); i++)
+    {
+        if (!isPermutation(reference[i]))
+        {
+            std::cout << "the offspring " << i << " is not a permutation" << std::endl;
+            ok = false;
+        }
+        changed += reference[i].invalid();
+    }
+    if (reference.size() != 77 || changed == 0 || changed == reference.size())
+    {
+        std::cout << reference.size() << " offspring, " << changed << " modified" << std::endl;
+        ok = false;
+    }
+
+    // in an eoEasyEA
+    eoDetTournamentSelect<Chrom> select(3);
+    eoOrderXover<Chrom> xover;
+    eoSwapMutation<Chrom> mutation;
+    eoSGAGenOp<Chrom> op(xover, 0.8, mutation, 0.3);
+    eoParallelGeneralBreeder<Chrom> breeder(select, op);
+    eoGenContinue<Chrom> continuator(20);
+    eoPlusReplacement<Chrom> replace;
+    eoEasyEA<Chrom> ea(continuator, eval, breeder, replace);
+
+    double before = parents.best_element().fitness();
+    ea(parents);
+    std::cout << "best fitness: " << before << " -> " << parents.best_element().fitness() << std::endl;
+    if (parents.size() != POP_SIZE || double(parents.best_element().fitness()) > before)
+    {
+        ok = false;
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
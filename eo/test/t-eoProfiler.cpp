@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------
+// t-eoProfiler.cpp
+//-----------------------------------------------------------------------------
+
+// the instrumentation of the headers is compiled in this test only
+#define WITH_PROFILER
+
+#include <sstream>
+
+#include <eo>
+#include <ga.h>
+
+//-----------------------------------------------------------------------------
+
+typedef eoBit<double> Indi;
+
+class OneMax : public eoEvalFunc<Indi>
+{
+public:
+    void operator()(Indi& _indi)
+    {
+        if (_indi.invalid())
+        {
+            EO_PROFILE_COUNT("one max", 1);
+            _indi.fitness(std::count(_indi.begin(), _indi.end(), true));
+        }
+    }
+};
+
+bool check(bool _ok, std::string _what)
+{
+    if (!_ok)
+        std::cout << "wrong " << _what << std::endl;
+    return _ok;
+}
+
+unsigned phase(std::string _name)
+{
+    const std::vector<std::string>& phases = eo::profiler.phases();
+    return std::find(phases.begin(), phases.end(), _name) - phases.begin();
+}
+
+unsigned counter(std::string _name)
+{
+    const std::vector<std::string>& counters = eo::profiler.counters();
+    return std::find(counters.begin(), counters.end(), _name) - counters.begin();
+}
+
+int main(int argc, char** argv)
+{
+    const char* args[] = {argv[0], "--parallelize-loop=1"};
+    eoParser parser(2, const_cast<char**>(args));
+    make_parallel(parser);
+    make_profiler(parser);
+    eo::profiler.trace(true);
+    rng.reseed(42);
+
+    const unsigned popSize = 20;
+    const unsigned generations = 10;
+    eoUniformGenerator<bool> uGen;
+    eoInitFixedLength<Indi> init(30, uGen);
+    eoPop<Indi> pop(popSize, init);
+
+    OneMax eval;
+    eoDetTournamentSelect<Indi> selectOne(2);
+    eoSelectPerc<Indi> select(selectOne);
+    eo1PtBitXover<Indi> xover;
+    eoBitMutation<Indi> mutation(0.1);
+    eoSGATransform<Indi> transform(xover, 0.7, mutation, 1.0);
+    eoGenerationalReplacement<Indi> replace;
+    eoGenContinue<Indi> continuator(generations);
+    eoCheckPoint<Indi> checkpoint(continuator);
+
+    // the stats are computed by the checkpoint, at the end of every generation
+    eoProfileStat<Indi> profile;
+    eoValueParam<double>& breedTime = profile.time("breed");
+    eoValueParam<unsigned long>& evaluations = profile.count("evaluations");
+    checkpoint.add(profile);
+    std::ostringstream os;
+    eoOStreamMonitor monitor(os);
+    monitor.add(breedTime);
+    monitor.add(evaluations);
+    checkpoint.add(monitor);
+
+    eoEasyEA<Indi> ea(checkpoint, eval, select, transform, replace);
+    ea(pop);
+
+    bool ok = true;
+
+    // every phase of every generation is timed
+    ok &= check(phase("breed") < eo::profiler.phases().size(), "phases");
+    ok &= check(eo::profiler.calls(phase("breed")) == generations, "calls of breed");
+    ok &= check(eo::profiler.calls(phase("evaluate")) == generations + 1, "calls of evaluate");
+    ok &= check(eo::profiler.calls(phase("replace")) == generations, "calls of replace");
+    ok &= check(eo::profiler.calls(phase("checkpoint")) == generations, "calls of checkpoint");
+    ok &= check(eo::profiler.time(phase("breed")) > 0, "time of breed");
+
+    // the evaluations counted by the algorithm are the ones done by the parallel loops of all the threads
+    unsigned long oneMax = eo::profiler.total(counter("one max"));
+    ok &= check(eo::profiler.total(counter("evaluations")) == oneMax, "evaluations");
+    ok &= check(oneMax > popSize, "evaluations of the threads");
+    ok &= check(eo::profiler.total(counter("copies")) == generations * popSize, "copies");
+
+    // the stat gives the increments of the last generation
+    ok &= check(breedTime.value() > 0 && breedTime.value() <= eo::profiler.time(phase("breed")), "stat of breed");
+    ok &= check(evaluations.value() > 0 && evaluations.value() <= popSize, "stat of the evaluations");
+    ok &= check(!os.str().empty(), "monitor");
+
+    // the summary and the trace
+    std::ostringstream summary, trace;
+    eo::profiler.printOn(summary);
+    eo::profiler.writeTrace(trace);
+    ok &= check(summary.str().find("\"breed\": {\"time\": ") != std::string::npos, "summary");
+    ok &= check(trace.str().find("\"name\": \"replace\", \"cat\": \"eo\", \"ph\": \"X\"") != std::string::npos, "trace");
+
+    eo::profiler.reset();
+    ok &= check(eo::profiler.calls(phase("breed")) == 0 && eo::profiler.total(counter("copies")) == 0, "reset");
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
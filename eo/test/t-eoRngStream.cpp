@@ -0,0 +1,148 @@
+//-----------------------------------------------------------------------------
+// t-eoRngStream.cpp
+//-----------------------------------------------------------------------------
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <eo>
+#include <utils/eoRNG.h>
+#include <utils/eoRngStream.h>
+
+using namespace std;
+
+typedef EO<double> EOT_Real;
+
+/** Records the first number drawn on eo::rng by each individual */
+class DrawOp : public eoUF<EOT_Real&, void>
+{
+public:
+    void operator()(EOT_Real& _eo) { _eo.fitness(rng.uniform()); }
+};
+
+int main(int, char** argv)
+{
+    // Same seed and stream: same sequence
+    eoRngStream a(42, 7), b(42, 7);
+    for(unsigned i = 0; i < 1000; ++i)
+        assert(a.rand() == b.rand());
+
+    // Other stream or other seed: other sequence
+    eoRngStream c(42, 8), d(43, 7);
+    a.reseed(42, 7);
+    unsigned same = 0;
+    for(unsigned i = 0; i < 1000; ++i) {
+        uint32_t x = a.rand();
+        same += (x == c.rand()) + (x == d.rand());
+    }
+    assert(same < 3);
+
+    // Jumping ahead skips whole blocks of four numbers
+    a.reseed(1, 2);
+    b.reseed(1, 2);
+    for(unsigned i = 0; i < 8; ++i)
+        a.rand();
+    b.discard(2);
+    assert(a.rand() == b.rand());
+
+    // Uniform numbers are in range and the bulk version draws the same numbers
+    a.reseed(5);
+    b.reseed(5);
+    vector<double> block(1000);
+    a.fill_uniform(block.begin(), block.end(), -1, 3);
+    double sum = 0;
+    for(unsigned i = 0; i < block.size(); ++i) {
+        assert(block[i] >= -1 && block[i] < 3);
+        assert(std::abs(block[i] - b.uniform(-1, 3)) < 1e-12);
+        sum += block[i];
+    }
+    assert(std::abs(sum / block.size() - 1) < 0.2);
+
+    // Normal deviates
+    const size_t num(10000);
+    vector<double> normals(num);
+    a.fill_normal(normals.begin(), normals.end(), 100., 5.);
+    double mean = 0, var = 0;
+    for(size_t i = 0; i < num; ++i)
+        mean += normals[i];
+    mean /= num;
+    for(size_t i = 0; i < num; ++i)
+        var += (normals[i] - mean) * (normals[i] - mean);
+    var /= num;
+    assert(std::abs(mean - 100.) < 0.5);
+    assert(std::abs(std::sqrt(var) - 5.) < 0.5);
+
+    // Saving and loading a stream resumes the sequence
+    a.reseed(9, 9);
+    a.normal();
+    stringstream ss;
+    a.printOn(ss);
+    b.readFrom(ss);
+    for(unsigned i = 0; i < 10; ++i)
+        assert(a.normal() == b.normal());
+
+    // A bound stream takes over the global generator, nested scopes are restored
+    rng.reseed(1);
+    eoRngStream bound(3, 4), reference(3, 4), inner(5, 6);
+    {
+        eoRngStreamScope scope(bound);
+        assert(rng.rand() == reference.rand());
+        {
+            eoRngStreamScope innerScope(inner);
+            rng.rand();
+        }
+        assert(rng.rand() == reference.rand());
+        assert(rng.normal() == reference.normal());
+        vector<double> v(5), w(5);
+        rng.fill_uniform(v.begin(), v.end());
+        reference.fill_uniform(w.begin(), w.end());
+        assert(v == w);
+    }
+    assert(eo::boundRngStream == nullptr);
+
+    // Other generators are not redirected
+    eoRng own(1);
+    eoRng other(1);
+    {
+        eoRngStreamScope scope(bound);
+        assert(own.rand() == other.rand());
+    }
+
+    // apply() gives the same draws whatever the number of threads
+    const char* args[] = {argv[0], "--parallelize-loop=1"};
+    eoParser parser(2, const_cast<char**>(args));
+    make_parallel(parser);
+
+    eoPop<EOT_Real> pop;
+    pop.resize(100);
+    DrawOp draw;
+    rng.reseed(42);
+#ifdef _OPENMP
+    omp_set_num_threads(1);
+#endif
+    apply<EOT_Real>(draw, pop);
+    vector<double> first;
+    for(unsigned i = 0; i < pop.size(); ++i)
+        first.push_back(pop[i].fitness());
+
+    rng.reseed(42);
+#ifdef _OPENMP
+    omp_set_num_threads(4);
+#endif
+    apply<EOT_Real>(draw, pop);
+    for(unsigned i = 0; i < pop.size(); ++i)
+        assert(pop[i].fitness() == first[i]);
+
+    return 0;
+}
+
+// Local Variables:
+// coding: iso-8859-1
+// mode: C++
+// c-file-offsets: ((c . 0))
+// c-file-style: "Stroustrup"
+// fill-column: 80
+// End:
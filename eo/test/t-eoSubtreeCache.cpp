@@ -0,0 +1,94 @@
+//-----------------------------------------------------------------------------
+// t-eoSubtreeCache.cpp
+//-----------------------------------------------------------------------------
+
+#include <gp/eoParseTree.h>
+#include <gp/eoSymregNode.h>
+#include <gp/eoSymregBlockEval.h>
+#include <gp/eoSubtreeCache.h>
+#include <eo>
+
+//-----------------------------------------------------------------------------
+typedef eoMinimizingFitness FitT;
+typedef eoParseTree < FitT, eoSymregNode > Tree;
+//-----------------------------------------------------------------------------
+
+const unsigned N_ROWS = 5000;
+
+// runs a few generations, evaluating the offspring with and without a cache of the given capacity
+bool check(unsigned _capacity)
+{
+    std::vector < eoSymregNode > nodes;
+    nodes.push_back(eoSymregNode(eoSymregNode::Variable, 0));
+    nodes.push_back(eoSymregNode(eoSymregNode::Variable, 1));
+    nodes.push_back(eoSymregNode(eoSymregNode::Constant, 0, 2.));
+    nodes.push_back(eoSymregNode(eoSymregNode::Plus));
+    nodes.push_back(eoSymregNode(eoSymregNode::Minus));
+    nodes.push_back(eoSymregNode(eoSymregNode::Multiplies));
+    nodes.push_back(eoSymregNode(eoSymregNode::Divides));
+    nodes.push_back(eoSymregNode(eoSymregNode::Sin));
+
+    rng.reseed(42);
+    std::vector < std::vector < double > > inputs(2, std::vector < double > (N_ROWS));
+    std::vector < double > target(N_ROWS);
+    for (unsigned r = 0; r < N_ROWS; r++)
+    {
+        inputs[0][r] = rng.uniform(-2, 2);
+        inputs[1][r] = rng.uniform(-2, 2);
+        target[r] = inputs[0][r] * inputs[1][r] + sin(inputs[0][r]);
+    }
+
+    eoSubtreeCache < eoSymregNode > cache(_capacity);
+    eoSymregBlockEval < Tree > eval(inputs, target);
+    eoSymregBlockEval < Tree > cachedEval(inputs, target, cache);
+    eoSubtreeCacheStat < Tree, eoSymregNode > hitRate(cache);
+
+    eoParseTreeDepthInit < FitT, eoSymregNode > init(5, nodes, true, true);
+    eoSubtreeXOver < FitT, eoSymregNode > xover(50);
+    eoBranchMutation < FitT, eoSymregNode > mutation(init, 50);
+
+    eoPop < Tree > pop(50, init);
+    for (unsigned g = 0; g < 10; g++)
+    {
+        for (unsigned i = 0; i + 1 < pop.size(); i += 2)
+        {
+            xover(pop[i], pop[i + 1]);
+            if (rng.flip(0.2))
+                mutation(pop[i]);
+        }
+        for (unsigned i = 0; i < pop.size(); i++)
+        {
+            double error = eval.error(pop[i]);
+            double cachedError = cachedEval.error(pop[i]);
+            if (error != cachedError)
+            {
+                std::cout << "generation " << g << ", individual " << i << ": " << error << " != " << cachedError << std::endl;
+                return false;
+            }
+        }
+        if (cache.size() > _capacity)
+        {
+            std::cout << cache.size() << " subtrees in a cache of capacity " << _capacity << std::endl;
+            return false;
+        }
+        hitRate(pop);
+    }
+
+    std::vector < double > outputs, cachedOutputs;
+    eval.predict(pop[0], outputs);
+    cachedEval.predict(pop[0], cachedOutputs);
+
+    std::cout << "capacity " << _capacity << ": " << cache.hits() << " hits, " << cache.misses() << " misses, "
+              << "hit rate " << cache.hitRate() << ", last generation " << hitRate.value() << std::endl;
+    return (outputs == cachedOutputs) && (cache.hits() > 0) && (hitRate.value() > 0);
+}
+
+int main()
+{
+    bool ok = check(100000);
+    // most subtrees are removed before being used again
+    ok = check(20) && ok;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
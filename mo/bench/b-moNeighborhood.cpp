@@ -0,0 +1,168 @@
+/*
+ * Time of the scan of a whole neighborhood (every neighbor evaluated, in the
+ * order of a moOrderNeighborhood), with the full evaluation of each neighbor
+ * (moFullEvalByModif) and with the incremental evaluation of the problem, on
+ * the problems of problems/eval: OneMax, NK landscapes (K=4), random MaxSAT
+ * (3-SAT, 4 clauses per variable) and UBQP on bit strings of 100 to 1000 bits
+ * (bit flip neighborhood), and random QAP instances of 20 to 100 objects
+ * (swap neighborhood). The time per scan is reported, in milliseconds.
+ *
+ * Usage: b-moNeighborhood [maxSize] [scans]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <mo>
+#include <eoInt.h>
+#include <ga/eoBit.h>
+#include <problems/bitString/moBitNeighbor.h>
+#include <eval/oneMaxEval.h>
+#include <eval/nkLandscapesEval.h>
+#include <eval/maxSATeval.h>
+#include <eval/ubqpEval.h>
+#include <eval/qapEval.h>
+#include <problems/eval/moOneMaxIncrEval.h>
+#include <problems/eval/moNKlandscapesIncrEval.h>
+#include <problems/eval/moMaxSATincrEval.h>
+#include <problems/eval/moUBQPSimpleIncrEval.h>
+#include <problems/eval/moQAPIncrEval.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef eoBit<unsigned int> Bits;
+typedef moBitNeighbor<unsigned int> BitNeighbor;
+typedef eoBit<double> RealBits;
+typedef moBitNeighbor<double> RealBitNeighbor;
+typedef eoBit<int> IntBits;
+typedef moBitNeighbor<int> IntBitNeighbor;
+typedef eoInt<eoMinimizingFitness> Permutation;
+typedef moIndexedSwapNeighbor<Permutation> SwapNeighbor;
+
+/** Time of a scan of the neighborhood, in milliseconds */
+template <class Neighbor>
+double time(moNeighborhood<Neighbor> & neighborhood, moEval<Neighbor> & eval, typename Neighbor::EOT & sol, unsigned scans)
+{
+    Neighbor neighbor;
+    auto start = chrono::steady_clock::now();
+    for(unsigned s = 0; s < scans; ++s)
+    {
+        neighborhood.init(sol, neighbor);
+        eval(sol, neighbor);
+        while(neighborhood.cont(sol))
+        {
+            neighborhood.next(sol, neighbor);
+            eval(sol, neighbor);
+        }
+    }
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / scans;
+}
+
+/** Times of the full and incremental scans of a random bit string, printed and recorded */
+template <class Neighbor>
+void bench(eoBenchReport & report, const string & problem, unsigned n, eoEvalFunc<typename Neighbor::EOT> & fullEval,
+           moEval<Neighbor> & incrEval, unsigned scans)
+{
+    typename Neighbor::EOT sol(n);
+    for(unsigned i = 0; i < n; ++i)
+        sol[i] = rng.flip();
+    fullEval(sol);
+
+    moOrderNeighborhood<Neighbor> neighborhood(n);
+    moFullEvalByModif<Neighbor> modifEval(fullEval);
+    double full = time(neighborhood, modifEval, sol, scans);
+    double incr = time(neighborhood, incrEval, sol, scans);
+
+    cout << setw(10) << problem << setw(8) << n << setw(14) << full << setw(14) << incr << endl;
+    report.record("full").param("problem", problem).param("size", n).value("time", full, "ms");
+    report.record("incremental").param("problem", problem).param("size", n).value("time", incr, "ms");
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxSize = argc > 1 ? atoi(argv[1]) : 1000;
+    unsigned scans = argc > 2 ? atoi(argv[2]) : 5;
+    eoBenchReport report("b-moNeighborhood");
+    const char* file = "b-moNeighborhood.dat";
+
+    cout << "maxSize=" << maxSize << " scans=" << scans << endl;
+    cout << "time per scan of the neighborhood (ms)" << endl;
+    cout << setw(10) << "problem" << setw(8) << "size" << setw(14) << "full" << setw(14) << "incremental" << endl;
+
+    rng.reseed(42);
+    unsigned sizes[] = {100, 1000};
+    for(unsigned n : sizes)
+    {
+        if(n > maxSize)
+            break;
+
+        oneMaxEval<Bits> oneMax;
+        moOneMaxIncrEval<BitNeighbor> oneMaxIncr;
+        bench(report, "OneMax", n, oneMax, oneMaxIncr, scans);
+
+        nkLandscapesEval<RealBits> nk(n, 4);
+        moNKlandscapesIncrEval<RealBitNeighbor> nkIncr(nk);
+        bench(report, "NK", n, nk, nkIncr, scans);
+
+        MaxSATeval<Bits> maxSat(n, 4 * n, 3);
+        moMaxSATincrEval<BitNeighbor> maxSatIncr(maxSat);
+        bench(report, "MaxSAT", n, maxSat, maxSatIncr, scans);
+
+        // a random dense instance, in the format 1 of ORLIB
+        ofstream os(file);
+        os << 1 << endl << n << endl;
+        for(unsigned i = 0; i < n; ++i)
+        {
+            for(unsigned j = 0; j < n; ++j)
+                os << rng.random(201) - 100 << " ";
+            os << endl;
+        }
+        os.close();
+        string fileName(file);
+        UbqpEval<IntBits> ubqp(fileName, 1);
+        moUBQPSimpleIncrEval<IntBitNeighbor> ubqpIncr(ubqp);
+        bench(report, "UBQP", n, ubqp, ubqpIncr, scans);
+    }
+
+    for(unsigned n = 20; n <= maxSize / 10; n *= 5)
+    {
+        // a random asymmetric instance, in the format of QAPlib
+        ofstream os(file);
+        os << n << endl;
+        for(unsigned m = 0; m < 2; ++m)
+            for(unsigned i = 0; i < n; ++i)
+            {
+                for(unsigned j = 0; j < n; ++j)
+                    os << rng.random(100) << " ";
+                os << endl;
+            }
+        os.close();
+        QAPeval<Permutation> qap(file);
+        moQAPIncrEval<SwapNeighbor> qapIncr(qap);
+
+        eoInitPermutation<Permutation> init(n);
+        Permutation sol;
+        init(sol);
+        qap(sol);
+
+        moOrderNeighborhood<SwapNeighbor> neighborhood(n * (n - 1) / 2);
+        moFullEvalByModif<SwapNeighbor> modifEval(qap);
+        double full = time(neighborhood, modifEval, sol, scans);
+        double incr = time(neighborhood, qapIncr, sol, scans);
+
+        cout << setw(10) << "QAP" << setw(8) << n << setw(14) << full << setw(14) << incr << endl;
+        report.record("full").param("problem", "QAP").param("size", n).value("time", full, "ms");
+        report.record("incremental").param("problem", "QAP").param("size", n).value("time", incr, "ms");
+    }
+
+    remove(file);
+    return 0;
+}
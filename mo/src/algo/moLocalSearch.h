@@ -40,6 +40,7 @@
 #include <neighborhood/moNeighborhood.h>
 #include <eoEvalFunc.h>
 #include <eoOp.h>
+#include <utils/eoProfiler.h>
 
 /**
  * the main algorithm of the local search
@@ -69,8 +70,11 @@ public:
 	 */
 	virtual bool operator()(EOT & _solution) {
 
-		if (_solution.invalid())
+		if (_solution.invalid()) {
+			EO_PROFILE_SCOPE("evaluate");
+			EO_PROFILE_COUNT("evaluations", 1);
 			fullEval(_solution);
+		}
 
 		// initialization of the parameter of the search (for example fill empty the tabu list)
 		searchExplorer.initParam(_solution);
@@ -80,18 +84,25 @@ public:
 
 		bool b;
 		do {
-			// explore the neighborhood of the solution
-			searchExplorer(_solution);
-			// if a solution in the neighborhood can be accepted
-			if (searchExplorer.accept(_solution)) {
-				searchExplorer.move(_solution);
-				searchExplorer.moveApplied(true);
-			} else
-				searchExplorer.moveApplied(false);
-
-			// update the parameter of the search (for ex. Temperature of the SA)
-			searchExplorer.updateParam(_solution);
-
+			{
+				EO_PROFILE_SCOPE("neighborhood");
+				// explore the neighborhood of the solution
+				searchExplorer(_solution);
+			}
+			{
+				EO_PROFILE_SCOPE("accept");
+				// if a solution in the neighborhood can be accepted
+				if (searchExplorer.accept(_solution)) {
+					searchExplorer.move(_solution);
+					searchExplorer.moveApplied(true);
+				} else
+					searchExplorer.moveApplied(false);
+
+				// update the parameter of the search (for ex. Temperature of the SA)
+				searchExplorer.updateParam(_solution);
+			}
+
+			EO_PROFILE_SCOPE("continuator");
 			b = (*cont)(_solution);
 		} while (b && searchExplorer.isContinue(_solution));
 
@@ -41,12 +41,16 @@
 #include <comparator/moNeighborComparator.h>
 #include <comparator/moSolNeighborComparator.h>
 #include <neighborhood/moNeighborhood.h>
+#include <neighborhood/moIndexNeighborhoodScan.h>
 #include <vector>
 #include <algorithm>   // std::sort
 
 /**
  * All possible statitic on the neighborhood fitness
  * to combine with other specific statistic to print them
+ *
+ * The neighborhood is scanned in parallel when the loops are parallelized
+ * (see moIndexNeighborhoodScan).
  */
 template< class Neighbor >
 class moNeighborhoodStat : public moStat<typename Neighbor::EOT, bool>
@@ -69,7 +73,8 @@ public :
             moStat<EOT, bool>(true, "neighborhood"),
             neighborhood(_neighborhood), eval(_eval),
             neighborComparator(_neighborComparator),
-            solNeighborComparator(_solNeighborComparator)
+            solNeighborComparator(_solNeighborComparator),
+            parallelScan(_neighborhood, _eval)
     {}
 
     /**
@@ -83,7 +88,8 @@ public :
             moStat<EOT, bool>(true, "neighborhood"),
             neighborhood(_neighborhood), eval(_eval),
             neighborComparator(defaultNeighborComp),
-            solNeighborComparator(defaultSolNeighborComp)
+            solNeighborComparator(defaultSolNeighborComp),
+            parallelScan(_neighborhood, _eval)
     {}
 
     /**
@@ -107,43 +113,38 @@ public :
 	  // to save the fitness values of the neighbors
 	  std::vector<double> neighborFitness;
 
-	  //init the first neighbor
-	  neighborhood.init(_solution, current);
-
-            //eval the _solution moved with the neighbor and stock the result in the neighbor
-            eval(_solution, current);
-
-            // init the statistics
-            value() = true;
-
-            mean = current.fitness();
-	    neighborFitness.push_back( (double) current.fitness() );
-            nb      = 1;
-            nbInf   = 0;
-            nbEqual = 0;
-            nbSup   = 0;
-
-            if (solNeighborComparator.equals(_solution, current))
-                nbEqual++;
-            else if (solNeighborComparator(_solution, current))
-                nbSup++;
-            else
-                nbInf++;
-
-            //initialize the best neighbor
-            best   = current;
-            lowest = current;
+            if (parallelScan.isEnabled()) {
+                StatVisitor visitor(*this);
+                parallelScan(_solution, visitor);
+
+                value() = true;
+                neighborFitness.swap(visitor.fitness);
+                mean = 0;
+                for (unsigned int i = 0; i < neighborFitness.size(); i++)
+                    mean += neighborFitness[i];
+                nb      = neighborFitness.size();
+                nbInf   = visitor.nbInf;
+                nbEqual = visitor.nbEqual;
+                nbSup   = visitor.nbSup;
+                best    = visitor.best;
+                lowest  = visitor.lowest;
+            }
+            else {
+                //init the first neighbor
+                neighborhood.init(_solution, current);
 
-            //test all others neighbors
-            while (neighborhood.cont(_solution)) {
-                //next neighbor
-                neighborhood.next(_solution, current);
-                //eval
+                //eval the _solution moved with the neighbor and stock the result in the neighbor
                 eval(_solution, current);
 
-                mean += current.fitness();
-		neighborFitness.push_back( (double) current.fitness() );
-                nb++;
+                // init the statistics
+                value() = true;
+
+                mean = current.fitness();
+                neighborFitness.push_back( (double) current.fitness() );
+                nb      = 1;
+                nbInf   = 0;
+                nbEqual = 0;
+                nbSup   = 0;
 
                 if (solNeighborComparator.equals(_solution, current))
                     nbEqual++;
@@ -152,12 +153,35 @@ public :
                 else
                     nbInf++;
 
-                //if we found a better neighbor, update the best
-                if (neighborComparator(best, current))
-                    best = current;
-
-                if (neighborComparator(current, lowest))
-                    lowest = current;
+                //initialize the best neighbor
+                best   = current;
+                lowest = current;
+
+                //test all others neighbors
+                while (neighborhood.cont(_solution)) {
+                    //next neighbor
+                    neighborhood.next(_solution, current);
+                    //eval
+                    eval(_solution, current);
+
+                    mean += current.fitness();
+                    neighborFitness.push_back( (double) current.fitness() );
+                    nb++;
+
+                    if (solNeighborComparator.equals(_solution, current))
+                        nbEqual++;
+                    else if (solNeighborComparator(_solution, current))
+                        nbSup++;
+                    else
+                        nbInf++;
+
+                    //if we found a better neighbor, update the best
+                    if (neighborComparator(best, current))
+                        best = current;
+
+                    if (neighborComparator(current, lowest))
+                        lowest = current;
+                }
             }
 
             max = best.fitness();
@@ -275,6 +299,49 @@ public :
 
 protected:
 
+    /**
+     * The statistics of a range of the parallel scan
+     */
+    class StatVisitor
+    {
+    public:
+        StatVisitor(moNeighborhoodStat& _stat) : stat(&_stat), nbInf(0), nbEqual(0), nbSup(0) {}
+
+        void operator()(EOT & _solution, Neighbor & _neighbor) {
+            fitness.push_back( (double) _neighbor.fitness() );
+
+            if (stat->solNeighborComparator.equals(_solution, _neighbor))
+                nbEqual++;
+            else if (stat->solNeighborComparator(_solution, _neighbor))
+                nbSup++;
+            else
+                nbInf++;
+
+            if (fitness.size() == 1 || stat->neighborComparator(best, _neighbor))
+                best = _neighbor;
+            if (fitness.size() == 1 || stat->neighborComparator(_neighbor, lowest))
+                lowest = _neighbor;
+        }
+
+        void merge(StatVisitor & _next) {
+            if (_next.fitness.empty())
+                return;
+            if (fitness.empty() || stat->neighborComparator(best, _next.best))
+                best = _next.best;
+            if (fitness.empty() || stat->neighborComparator(_next.lowest, lowest))
+                lowest = _next.lowest;
+            fitness.insert(fitness.end(), _next.fitness.begin(), _next.fitness.end());
+            nbInf += _next.nbInf;
+            nbEqual += _next.nbEqual;
+            nbSup += _next.nbSup;
+        }
+
+        moNeighborhoodStat* stat;
+        std::vector<double> fitness;
+        unsigned int nbInf, nbEqual, nbSup;
+        Neighbor best, lowest;
+    };
+
     //the neighborhood
     Neighborhood& neighborhood ;
     moEval<Neighbor>& eval;
@@ -289,6 +356,9 @@ protected:
     // compare the fitness values of the solution and the neighbor
     moSolNeighborComparator<Neighbor> defaultSolNeighborComp;
 
+    // scan of the neighborhood by the threads
+    moIndexNeighborhoodScan<Neighbor> parallelScan;
+
     // the stastics of the fitness
     Fitness max, min;
 
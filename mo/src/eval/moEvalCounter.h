@@ -32,6 +32,7 @@ Contact: paradiseo-help@lists.gforge.inria.fr
 
 #include <eval/moEval.h>
 #include <utils/eoParam.h>
+#include <utils/eoProfiler.h>
 
 /**
     Counts the number of neighbor evaluations actually performed, 
@@ -54,7 +55,13 @@ public:
      * @param _neighbor a neighbor
      */
     void operator()(EOT& _solution, Neighbor& _neighbor) {
-        value()++;
+        // the neighborhoods may be scanned by several threads
+        unsigned long& n = value();
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        n++;
+        EO_PROFILE_COUNT("neighbor evaluations", 1);
         eval(_solution, _neighbor);
     }
 
@@ -39,12 +39,17 @@
 #include <comparator/moNeighborComparator.h>
 #include <comparator/moSolNeighborComparator.h>
 #include <neighborhood/moNeighborhood.h>
+#include <neighborhood/moIndexNeighborhoodScan.h>
 #include <vector>
 #include <utils/eoRNG.h>
 
 /**
  * Explorer for Hill-Climbing
  * which choose randomly one of the best solution in the neighborhood at each iteration
+ *
+ * The neighborhood is scanned in parallel when the loops are parallelized
+ * (see moIndexNeighborhoodScan): the best neighbors are then in the order of
+ * their indices.
  */
 template< class Neighbor >
 class moRandomBestHCexplorer : public moNeighborhoodExplorer<Neighbor>
@@ -71,7 +76,8 @@ public:
                            moSolNeighborComparator<Neighbor>& _solNeighborComparator) :
             moNeighborhoodExplorer<Neighbor>(_neighborhood, _eval),
             neighborComparator(_neighborComparator),
-            solNeighborComparator(_solNeighborComparator) {
+            solNeighborComparator(_solNeighborComparator),
+            parallelScan(_neighborhood, _eval) {
         isAccept = false;
     }
 
@@ -112,7 +118,16 @@ public:
     virtual void operator()(EOT & _solution) {
 
         //Test if _solution has a Neighbor
-        if (neighborhood.hasNeighbor(_solution)) {
+        bool hasNeighbor = neighborhood.hasNeighbor(_solution);
+        if (hasNeighbor && parallelScan.isEnabled()) {
+            BestsVisitor visitor(neighborComparator);
+            parallelScan(_solution, visitor);
+            bestVector.swap(visitor.bests);
+
+            // choose randomly one of the best solutions
+            selectedNeighbor = bestVector[rng.random(bestVector.size())];
+        }
+        else if (hasNeighbor) {
             //init the first neighbor
             neighborhood.init(_solution, currentNeighbor);
 
@@ -189,10 +204,43 @@ public:
     };
 
 protected:
+    /**
+     * The best neighbors of a range of the parallel scan
+     */
+    class BestsVisitor
+    {
+    public:
+        BestsVisitor(moNeighborComparator<Neighbor>& _comparator) : comparator(&_comparator) {}
+
+        void operator()(EOT & _solution, Neighbor & _neighbor) {
+            if (bests.empty() || (*comparator)(bests[0], _neighbor)) {
+                bests.clear();
+                bests.push_back(_neighbor);
+            }
+            else if (comparator->equals(_neighbor, bests[0]))
+                bests.push_back(_neighbor);
+        }
+
+        void merge(BestsVisitor & _next) {
+            if (_next.bests.empty())
+                return;
+            if (bests.empty() || (*comparator)(bests[0], _next.bests[0]))
+                bests.swap(_next.bests);
+            else if (comparator->equals(_next.bests[0], bests[0]))
+                bests.insert(bests.end(), _next.bests.begin(), _next.bests.end());
+        }
+
+        moNeighborComparator<Neighbor>* comparator;
+        std::vector<Neighbor> bests;
+    };
+
     // comparator between solution and neighbor or between neighbors
     moNeighborComparator<Neighbor>& neighborComparator;
     moSolNeighborComparator<Neighbor>& solNeighborComparator;
 
+    // scan of the neighborhood by the threads
+    moIndexNeighborhoodScan<Neighbor> parallelScan;
+
     // the best solutions in the neighborhood
     std::vector<Neighbor> bestVector;
 
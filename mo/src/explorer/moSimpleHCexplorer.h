@@ -39,9 +39,14 @@
 #include <comparator/moNeighborComparator.h>
 #include <comparator/moSolNeighborComparator.h>
 #include <neighborhood/moNeighborhood.h>
+#include <neighborhood/moIndexNeighborhoodScan.h>
 
 /**
  * Explorer for a simple Hill-climbing
+ *
+ * The neighborhood is scanned in parallel when the loops are parallelized
+ * (see moIndexNeighborhoodScan): the best neighbor is then the one of lowest
+ * index among the equal ones.
  */
 template< class Neighbor >
 class moSimpleHCexplorer : public moNeighborhoodExplorer<Neighbor>
@@ -62,7 +67,7 @@ public:
      * @param _neighborComparator a neighbor comparator
      * @param _solNeighborComparator solution vs neighbor comparator
      */
-    moSimpleHCexplorer(Neighborhood& _neighborhood, moEval<Neighbor>& _eval, moNeighborComparator<Neighbor>& _neighborComparator, moSolNeighborComparator<Neighbor>& _solNeighborComparator) : moNeighborhoodExplorer<Neighbor>(_neighborhood, _eval), neighborComparator(_neighborComparator), solNeighborComparator(_solNeighborComparator) {
+    moSimpleHCexplorer(Neighborhood& _neighborhood, moEval<Neighbor>& _eval, moNeighborComparator<Neighbor>& _neighborComparator, moSolNeighborComparator<Neighbor>& _solNeighborComparator) : moNeighborhoodExplorer<Neighbor>(_neighborhood, _eval), neighborComparator(_neighborComparator), solNeighborComparator(_solNeighborComparator), parallelScan(_neighborhood, _eval) {
         isAccept = false;
     }
 
@@ -96,7 +101,13 @@ public:
      */
     virtual void operator()(EOT & _solution) {
         //Test if _solution has a Neighbor
-        if (neighborhood.hasNeighbor(_solution)) {
+        bool hasNeighbor = neighborhood.hasNeighbor(_solution);
+        if (hasNeighbor && parallelScan.isEnabled()) {
+            BestVisitor visitor(neighborComparator);
+            parallelScan(_solution, visitor);
+            selectedNeighbor = visitor.best;
+        }
+        else if (hasNeighbor) {
             //init the first neighbor
             neighborhood.init(_solution, currentNeighbor);
 
@@ -155,10 +166,40 @@ public:
     }
 
 private:
+    /**
+     * The best neighbor of a range of the parallel scan
+     */
+    class BestVisitor
+    {
+    public:
+        BestVisitor(moNeighborComparator<Neighbor>& _comparator) : comparator(&_comparator), found(false) {}
+
+        void operator()(EOT & _solution, Neighbor & _neighbor) {
+            if (!found || (*comparator)(best, _neighbor)) {
+                best = _neighbor;
+                found = true;
+            }
+        }
+
+        void merge(BestVisitor & _next) {
+            if (_next.found && (!found || (*comparator)(best, _next.best))) {
+                best = _next.best;
+                found = true;
+            }
+        }
+
+        moNeighborComparator<Neighbor>* comparator;
+        bool found;
+        Neighbor best;
+    };
+
     // comparator between solution and neighbor or between neighbors
     moNeighborComparator<Neighbor>& neighborComparator;
     moSolNeighborComparator<Neighbor>& solNeighborComparator;
 
+    // scan of the neighborhood by the threads
+    moIndexNeighborhoodScan<Neighbor> parallelScan;
+
     // true if the move is accepted
     bool isAccept ;
 };
@@ -42,9 +42,14 @@
 #include <memory/moIntensification.h>
 #include <memory/moDiversification.h>
 #include <neighborhood/moNeighborhood.h>
+#include <neighborhood/moIndexNeighborhoodScan.h>
 
 /**
  * Explorer for a Tabu Search
+ *
+ * The neighborhood is scanned in parallel when the loops are parallelized
+ * (see moIndexNeighborhoodScan): the selected neighbor is then the one of
+ * lowest index among the equal best ones which are not tabu or aspirated.
  */
 template< class Neighbor >
 class moTSexplorer : public moNeighborhoodExplorer<Neighbor>
@@ -77,7 +82,8 @@ public:
                  moAspiration<Neighbor> & _aspiration
                 ) :
             moNeighborhoodExplorer<Neighbor>(_neighborhood, _eval), neighborComparator(_neighborComparator), solNeighborComparator(_solNeighborComparator),
-            tabuList(_tabuList), intensification(_intensification), diversification(_diversification), aspiration(_aspiration)
+            tabuList(_tabuList), intensification(_intensification), diversification(_diversification), aspiration(_aspiration),
+            parallelScan(_neighborhood, _eval)
     {
         isAccept = false;
     }
@@ -139,7 +145,20 @@ public:
         bool found=false;
         intensification(_solution);
         diversification(_solution);
-        if (neighborhood.hasNeighbor(_solution))
+        bool hasNeighbor = neighborhood.hasNeighbor(_solution);
+        if (hasNeighbor && parallelScan.isEnabled())
+        {
+            // the tabu list may cache what depends on the solution: done before the threads check it
+            neighborhood.init(_solution, currentNeighbor);
+            tabuList.check(_solution, currentNeighbor);
+
+            BestVisitor visitor(*this);
+            parallelScan(_solution, visitor);
+            if (visitor.found)
+                selectedNeighbor = visitor.best;
+            isAccept = visitor.found;
+        }
+        else if (hasNeighbor)
         {
             //init the current neighbor
             neighborhood.init(_solution, currentNeighbor);
@@ -222,6 +241,34 @@ protected:
     using moNeighborhoodExplorer<Neighbor>::neighborhood;
     using moNeighborhoodExplorer<Neighbor>::eval;
 
+    /**
+     * The best neighbor of a range of the parallel scan, among the ones which are not tabu or aspirated
+     */
+    class BestVisitor
+    {
+    public:
+        BestVisitor(moTSexplorer& _explorer) : explorer(&_explorer), found(false) {}
+
+        void operator()(EOT & _solution, Neighbor & _neighbor) {
+            if ((!explorer->tabuList.check(_solution, _neighbor) || explorer->aspiration(_solution, _neighbor))
+                    && (!found || explorer->neighborComparator(best, _neighbor))) {
+                best = _neighbor;
+                found = true;
+            }
+        }
+
+        void merge(BestVisitor & _next) {
+            if (_next.found && (!found || explorer->neighborComparator(best, _next.best))) {
+                best = _next.best;
+                found = true;
+            }
+        }
+
+        moTSexplorer* explorer;
+        bool found;
+        Neighbor best;
+    };
+
     // comparator between solution and neighbor or between neighbors
     moNeighborComparator<Neighbor>& neighborComparator;
     moSolNeighborComparator<Neighbor>& solNeighborComparator;
@@ -241,6 +288,9 @@ protected:
     // true if the move is accepted
     bool isAccept ;
 
+    // scan of the neighborhood by the threads
+    moIndexNeighborhoodScan<Neighbor> parallelScan;
+
 };
 
 
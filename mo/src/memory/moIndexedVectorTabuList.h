@@ -43,6 +43,9 @@ Contact: paradiseo-help@lists.gforge.inria.fr
  * The tabu tenure could be random between two bounds 
  * such as in robust tabu search
  *
+ * Each neighbor stores the iteration until which it is tabu,
+ * so that the update of the tabu list is done in constant time
+ *
  */
 template<class Neighbor >
 class moIndexedVectorTabuList : public moTabuList<Neighbor>
@@ -55,7 +58,7 @@ public:
      * @param _maxSize maximum size of the tabu list
      * @param _howlong how many iteration a move is tabu
      */
-    moIndexedVectorTabuList(unsigned int _maxSize, unsigned int _howlong) : maxSize(_maxSize), howlong(_howlong), robust(false) {
+    moIndexedVectorTabuList(unsigned int _maxSize, unsigned int _howlong) : maxSize(_maxSize), howlong(_howlong), robust(false), iteration(0) {
         tabuList.resize(_maxSize);
     }
 
@@ -65,7 +68,7 @@ public:
      * @param _howlongMin minimal number of iterations during a move is tabu
      * @param _howlongMax maximal number of iterations during a move is tabu
      */
- moIndexedVectorTabuList(unsigned int _maxSize, unsigned int _howlongMin, unsigned int _howlongMax) : maxSize(_maxSize), howlongMin(_howlongMin), howlongMax(_howlongMax), robust(true) {
+ moIndexedVectorTabuList(unsigned int _maxSize, unsigned int _howlongMin, unsigned int _howlongMax) : maxSize(_maxSize), howlongMin(_howlongMin), howlongMax(_howlongMax), robust(true), iteration(0) {
         tabuList.resize(_maxSize);
     }
 
@@ -89,19 +92,17 @@ public:
 	  // random value between min and max
 	  howlong = howlongMin + rng.random(howlongMax - howlongMin);
 
-	tabuList[_neighbor.index()] = howlong;
+	tabuList[_neighbor.index()] = iteration + howlong;
       }
     }
 
     /**
-     * update the tabulist by decreasing the number of tabu iteration
+     * update the tabulist: next iteration
      * @param _sol unused solution
      * @param _neighbor unused neighbor
      */
     virtual void update(EOT & _sol, Neighbor & _neighbor) {
-      for (unsigned int i = 0; i < maxSize; i++)
-	if (tabuList[i] > 0)
-	  tabuList[i]--;
+      iteration++;
     }
 
     /**
@@ -111,7 +112,7 @@ public:
      * @return true if tabuList contains _sol
      */
     virtual bool check(EOT & _sol, Neighbor & _neighbor) {
-      return (tabuList[_neighbor.index()] > 0);
+      return (tabuList[_neighbor.index()] > iteration);
     }
 
     /**
@@ -120,18 +121,19 @@ public:
     virtual void clearMemory() {
       for (unsigned int i = 0; i < maxSize; i++)
 	tabuList[i] = 0;
+      iteration = 0;
     }
 
     void print(){
     	std::cout << "Tabulist:" << std::endl;
     	for(int i=0; i<tabuList.size(); i++)
-	  std::cout << i << ": " << tabuList[i] << std::endl;
+	  std::cout << i << ": " << (tabuList[i] > iteration ? tabuList[i] - iteration : 0) << std::endl;
     }
 
 
 protected:
-    //tabu list
-    std::vector< unsigned int > tabuList;
+    //tabu list: iteration until which each neighbor is tabu
+    std::vector< unsigned long > tabuList;
     //maximum size of the tabu list
     unsigned int maxSize;
     //how many iteration a move is tabu
@@ -142,6 +144,8 @@ protected:
     unsigned int howlongMax;
     // true: robust tabu search way
     bool robust;
+    // current iteration
+    unsigned long iteration;
 };
 
 #endif
@@ -31,26 +31,37 @@ Contact: paradiseo-help@lists.gforge.inria.fr
 #define _moNeighborVectorTabuList_h
 
 #include <memory/moTabuList.h>
+#include <memory/moTabuHashTable.h>
+#include <neighborhood/moIndexNeighbor.h>
 #include <vector>
 #include <iostream>
+#include <limits>
+#include <type_traits>
 
 /**
- * Tabu List of neighbors stocked in a vector
+ * Tabu List of neighbors
+ *
+ * The indexed neighbors (moIndexNeighbor) are stored by their index in a hash table, so
+ * that a neighbor is checked in constant time; the other neighbors are stored in a vector
+ * and compared with equals.
+ * In both cases, each neighbor stores the iteration until which it is tabu, so that the
+ * update of the tabu list is done in constant time.
  */
 template<class Neighbor >
 class moNeighborVectorTabuList : public moTabuList<Neighbor>
 {
 public:
     typedef typename Neighbor::EOT EOT;
+    typedef typename Neighbor::Fitness Fitness;
 
     /**
      * Constructor
      * @param _maxSize maximum size of the tabu list
      * @param _howlong how many iteration a move is tabu (0 -> no limits)
      */
-    moNeighborVectorTabuList(unsigned int _maxSize, unsigned int _howlong) : maxSize(_maxSize), howlong(_howlong), index(0) {
-        tabuList.reserve(_maxSize);
-        tabuList.resize(0);
+    moNeighborVectorTabuList(unsigned int _maxSize, unsigned int _howlong) : maxSize(_maxSize), howlong(_howlong), index(0), iteration(0), indexList(_maxSize) {
+        if (!Indexed::value)
+            tabuList.reserve(_maxSize);
     }
 
     /**
@@ -68,18 +79,7 @@ public:
      * @param _neighbor the current neighbor
      */
     virtual void add(EOT & _sol, Neighbor & _neighbor) {
-
-        if (tabuList.size() < maxSize) {
-            std::pair<Neighbor, unsigned int> tmp;
-            tmp.first=_neighbor;
-            tmp.second=howlong;
-            tabuList.push_back(tmp);
-        }
-        else {
-            tabuList[index%maxSize].first = _neighbor;
-            tabuList[index%maxSize].second = howlong;
-            index++;
-        }
+        add(_neighbor, Indexed());
     }
 
     /**
@@ -88,24 +88,20 @@ public:
      * @param _neighbor unused neighbor
      */
     virtual void update(EOT & _sol, Neighbor & _neighbor) {
-        if (howlong > 0)
-            for (unsigned int i=0; i<tabuList.size(); i++)
-                if (tabuList[i].second > 0)
-                    tabuList[i].second--;
+        if (howlong > 0) {
+            iteration++;
+            indexList.update();
+        }
     }
 
     /**
      * check if the move is tabu
      * @param _sol unused solution
      * @param _neighbor the current neighbor
-     * @return true if tabuList contains _sol
+     * @return true if tabuList contains _neighbor
      */
     virtual bool check(EOT & _sol, Neighbor & _neighbor) {
-        for (unsigned int i=0; i<tabuList.size(); i++) {
-            if ((howlong > 0 && tabuList[i].second > 0 && tabuList[i].first.equals(_neighbor)) || (howlong==0 && tabuList[i].first.equals(_neighbor)))
-                return true;
-        }
-        return false;
+        return check(_neighbor, Indexed());
     }
 
     /**
@@ -113,7 +109,9 @@ public:
      */
     virtual void clearMemory() {
         tabuList.resize(0);
+        indexList.clear();
         index = 0;
+        iteration = 0;
     }
 
     void print(){
@@ -122,17 +120,52 @@ public:
     		std::cout << i << ": " << tabuList[i].first.index() << std::endl;
     }
 
-
 private:
-    //tabu list
-    std::vector< std::pair<Neighbor, unsigned int> > tabuList;
+    // true if the neighbors are stored by index
+    typedef std::is_base_of< moIndexNeighbor<EOT, Fitness>, Neighbor > Indexed;
+
+    void add(Neighbor & _neighbor, std::true_type) {
+        indexList.add(_neighbor.index(), howlong);
+    }
+
+    void add(Neighbor & _neighbor, std::false_type) {
+        if (maxSize == 0)
+            return;
+        unsigned long expire = (howlong > 0) ? iteration + howlong : std::numeric_limits<unsigned long>::max();
+        if (tabuList.size() < maxSize) {
+            tabuList.push_back(std::pair<Neighbor, unsigned long>(_neighbor, expire));
+        }
+        else {
+            tabuList[index%maxSize].first = _neighbor;
+            tabuList[index%maxSize].second = expire;
+            index++;
+        }
+    }
+
+    bool check(Neighbor & _neighbor, std::true_type) {
+        return indexList.contains(_neighbor.index());
+    }
+
+    bool check(Neighbor & _neighbor, std::false_type) {
+        for (unsigned int i=0; i<tabuList.size(); i++) {
+            if (tabuList[i].second > iteration && tabuList[i].first.equals(_neighbor))
+                return true;
+        }
+        return false;
+    }
+
+    //tabu list of the neighbors, with the iteration until which they are tabu
+    std::vector< std::pair<Neighbor, unsigned long> > tabuList;
     //maximum size of the tabu list
     unsigned int maxSize;
     //how many iteration a move is tabu
     unsigned int howlong;
     //index on the tabulist
     unsigned long index;
-
+    //current iteration
+    unsigned long iteration;
+    //tabu list of the indexed neighbors
+    moTabuHashTable indexList;
 };
 
 #endif
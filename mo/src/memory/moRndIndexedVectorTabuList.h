@@ -52,6 +52,8 @@ public:
   using moIndexedVectorTabuList<Neighbor>::maxSize;
   //how many iteration a move is tabu
   using moIndexedVectorTabuList<Neighbor>::howlong;
+  //current iteration
+  using moIndexedVectorTabuList<Neighbor>::iteration;
 
   /**
    * Constructor
@@ -69,7 +71,7 @@ public:
    */
   virtual void add(EOT & _sol, Neighbor & _neighbor) {
     if (_neighbor.index() < maxSize) 
-      tabuList[_neighbor.index()] = howlong + rng.uniform(howlongRnd) ;
+      tabuList[_neighbor.index()] = iteration + howlong + rng.uniform(howlongRnd) ;
   }
 
 
@@ -31,11 +31,17 @@ Contact: paradiseo-help@lists.gforge.inria.fr
 #define _moSolVectorTabuList_h
 
 #include <memory/moTabuList.h>
-#include <vector>
-#include <iostream>
+#include <memory/moTabuHashTable.h>
+#include <memory/moZobristHash.h>
 
 /**
- * Tabu List of solution stocked in a vector
+ * Tabu List of solutions
+ *
+ * The solutions are stored as their Zobrist hash (moZobristHash) in a hash table,
+ * so that a neighbor is checked by computing its hash from the one of the current
+ * solution, without copying or comparing whole solutions.
+ * The hash of the current solution is computed at the first check following an
+ * init, add or update of the tabu list.
  */
 template<class Neighbor >
 class moSolVectorTabuList : public moTabuList<Neighbor>
@@ -43,15 +49,20 @@ class moSolVectorTabuList : public moTabuList<Neighbor>
 public:
     typedef typename Neighbor::EOT EOT;
 
+    /**
+     * Constructor, the hash of a neighbor is computed by moving a copy of the solution
+     * @param _maxSize maximum size of the tabu list
+     * @param _howlong how many iteration a solution is tabu (0 -> no limits)
+     */
+    moSolVectorTabuList(unsigned int _maxSize, unsigned int _howlong) : hash(defaultHash), tabuList(_maxSize), howlong(_howlong), currentSol(NULL) {}
+
     /**
      * Constructor
      * @param _maxSize maximum size of the tabu list
-     * @param _howlong how many iteration a solution is tabu
+     * @param _howlong how many iteration a solution is tabu (0 -> no limits)
+     * @param _hash the hash of the solutions, which can give the hash of a neighbor in constant time (moBitZobristHash, moSwapZobristHash...)
      */
-    moSolVectorTabuList(unsigned int _maxSize, unsigned int _howlong) : maxSize(_maxSize), howlong(_howlong) {
-        tabuList.reserve(_maxSize);
-        tabuList.resize(0);
-    }
+    moSolVectorTabuList(unsigned int _maxSize, unsigned int _howlong, moZobristHash<Neighbor> & _hash) : hash(_hash), tabuList(_maxSize), howlong(_howlong), currentSol(NULL) {}
 
     /**
      * init the tabuList by clearing the memory
@@ -68,67 +79,56 @@ public:
      * @param _neighbor unused neighbor
      */
     virtual void add(EOT & _sol, Neighbor & _neighbor) {
-
-        if (tabuList.size() < maxSize) {
-            std::pair<EOT, unsigned int> tmp;
-            tmp.first=_sol;
-            tmp.second=howlong;
-            tabuList.push_back(tmp);
-        }
-        else {
-            tabuList[index%maxSize].first = _sol;
-            tabuList[index%maxSize].second = howlong;
-            index++;
-        }
+        tabuList.add(hash.hash(_sol), howlong);
+        currentSol = NULL;
     }
 
     /**
-     * update the tabulist: NOTHING TO DO
+     * update the tabulist
      * @param _sol the current solution
      * @param _neighbor the current neighbor (unused)
      */
     virtual void update(EOT & _sol, Neighbor & _neighbor) {
         if (howlong > 0)
-            for (unsigned int i=0; i<tabuList.size(); i++)
-                if (tabuList[i].second > 0)
-                    tabuList[i].second--;
+            tabuList.update();
+        currentSol = NULL;
     }
 
     /**
      * check if the solution is tabu
      * @param _sol the current solution
-     * @param _neighbor the current neighbor (unused)
-     * @return true if tabuList contains _sol
+     * @param _neighbor the current neighbor
+     * @return true if tabuList contains the solution obtained by the move of _neighbor
      */
     virtual bool check(EOT & _sol, Neighbor & _neighbor) {
-        EOT tmp=_sol;
-        _neighbor.move(tmp);
-        for (unsigned int i=0; i<tabuList.size(); i++) {
-            if ((howlong > 0 && tabuList[i].second > 0 && tabuList[i].first == tmp) || (howlong==0 && tabuList[i].first==tmp))
-                return true;
+        if (currentSol != &_sol) {
+            currentHash = hash.hash(_sol);
+            currentSol = &_sol;
         }
-        return false;
+        return tabuList.contains(hash.hash(_sol, currentHash, _neighbor));
     }
 
     /**
      * clearMemory: remove all solution of the tabuList
      */
     virtual void clearMemory() {
-        tabuList.resize(0);
-        index = 0;
+        tabuList.clear();
+        currentSol = NULL;
     }
 
-
 private:
+    //default hash of the solutions
+    moZobristHash<Neighbor> defaultHash;
+    //hash of the solutions
+    moZobristHash<Neighbor> & hash;
     //tabu list
-    std::vector< std::pair<EOT, unsigned int> > tabuList;
-    //maximum size of the tabu list
-    unsigned int maxSize;
+    moTabuHashTable tabuList;
     //how many iteration a move is tabu
     unsigned int howlong;
-    //index on the tabulist
-    unsigned long index;
-
+    //solution whose hash is currentHash (NULL if it has to be computed)
+    EOT * currentSol;
+    //hash of the current solution
+    unsigned long long currentHash;
 };
 
 #endif
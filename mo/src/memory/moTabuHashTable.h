@@ -0,0 +1,186 @@
+/*
+<moTabuHashTable.h>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+Sébastien Verel, Arnaud Liefooghe, Jérémie Humeau
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#ifndef _moTabuHashTable_h
+#define _moTabuHashTable_h
+
+#include <cstddef>
+#include <vector>
+#include <limits>
+
+/**
+ * Open addressing hash table of the tabu keys (hash of a solution, index of a move...)
+ *
+ * Like in the vector tabu lists, only the maxSize last added keys are kept, and a key
+ * is tabu during howlong iterations (0 -> until maxSize newer keys are added).
+ * Instead of counters decreased at each iteration, every key stores its rank of
+ * addition and the iteration until which it is tabu, so that update, add and contains
+ * are done in constant (amortized) time.
+ * The expired keys are removed when the table is rebuilt, as it becomes full.
+ */
+class moTabuHashTable
+{
+public:
+
+    /**
+     * Constructor
+     * @param _maxSize maximum number of tabu keys
+     */
+    moTabuHashTable(unsigned int _maxSize) : maxSize(_maxSize) {
+        clear();
+    }
+
+    /**
+     * add a key, which becomes tabu
+     * @param _key the key
+     * @param _howlong how many iteration the key is tabu (0 -> no limits)
+     */
+    void add(unsigned long long _key, unsigned int _howlong) {
+        if (maxSize == 0)
+            return;
+        if (2 * (used + 1) > table.size())
+            rebuild();
+
+        unsigned long expire = (_howlong > 0) ? iteration + _howlong : std::numeric_limits<unsigned long>::max();
+        std::size_t i = find(_key);
+        if (!table[i].used) {
+            table[i].used = true;
+            table[i].key = _key;
+            used++;
+        }
+        table[i].rank = nbAdded++;
+        table[i].expire = expire;
+    }
+
+    /**
+     * next iteration
+     */
+    void update() {
+        iteration++;
+    }
+
+    /**
+     * @param _key the key
+     * @return true if the key is tabu
+     */
+    bool contains(unsigned long long _key) const {
+        if (maxSize == 0)
+            return false;
+        const Entry & e = table[find(_key)];
+        return e.used && alive(e);
+    }
+
+    /**
+     * remove all the keys
+     */
+    void clear() {
+        table.assign(16, Entry());
+        used = 0;
+        nbAdded = 0;
+        iteration = 0;
+    }
+
+private:
+
+    struct Entry {
+        Entry() : key(0), rank(0), expire(0), used(false) {}
+        unsigned long long key;
+        // rank of the last addition of the key
+        unsigned long rank;
+        // first iteration when the key is no more tabu
+        unsigned long expire;
+        bool used;
+    };
+
+    /**
+     * @return true if the key of the entry is still tabu
+     */
+    bool alive(const Entry & _e) const {
+        return _e.rank + maxSize >= nbAdded && _e.expire > iteration;
+    }
+
+    /**
+     * mix the bits of the key (end of splitmix64), so that consecutive keys are spread
+     */
+    static unsigned long long mix(unsigned long long _key) {
+        _key = (_key ^ (_key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        _key = (_key ^ (_key >> 27)) * 0x94d049bb133111ebULL;
+        return _key ^ (_key >> 31);
+    }
+
+    /**
+     * @return the position of the key, or of the empty entry where it would be inserted
+     */
+    std::size_t find(unsigned long long _key) const {
+        std::size_t mask = table.size() - 1;
+        std::size_t i = mix(_key) & mask;
+        while (table[i].used && table[i].key != _key)
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    /**
+     * remove the expired keys, and double the size of the table if the remaining
+     * keys fill more than a quarter of it
+     */
+    void rebuild() {
+        std::vector<Entry> old;
+        old.swap(table);
+
+        std::size_t nbAlive = 0;
+        for (std::size_t i = 0; i < old.size(); i++)
+            if (old[i].used && alive(old[i]))
+                nbAlive++;
+
+        std::size_t size = old.size();
+        while (4 * (nbAlive + 1) > size)
+            size *= 2;
+        table.assign(size, Entry());
+
+        used = 0;
+        for (std::size_t i = 0; i < old.size(); i++)
+            if (old[i].used && alive(old[i])) {
+                table[find(old[i].key)] = old[i];
+                used++;
+            }
+    }
+
+    // the entries, the size is a power of 2
+    std::vector<Entry> table;
+    // number of used entries (tabu or expired)
+    std::size_t used;
+    // maximum number of tabu keys
+    unsigned int maxSize;
+    // number of keys added since the last clear
+    unsigned long nbAdded;
+    // current iteration
+    unsigned long iteration;
+};
+
+#endif
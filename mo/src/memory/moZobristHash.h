@@ -0,0 +1,99 @@
+/*
+<moZobristHash.h>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+Sébastien Verel, Arnaud Liefooghe, Jérémie Humeau
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#ifndef _moZobristHash_h
+#define _moZobristHash_h
+
+#include <functional>
+
+/**
+ * Zobrist hashing of the solutions which are vectors (bit strings, permutations...)
+ *
+ * The hash of a solution is the xor of the keys of its (position, value) pairs, so that
+ * the hash of a neighbor can be computed from the hash of the solution by only
+ * considering the positions changed by the move.
+ * This class computes the hash of a neighbor by moving a copy of the solution;
+ * the subclasses (moBitZobristHash, moSwapZobristHash) do it in constant time.
+ */
+template< class Neighbor >
+class moZobristHash
+{
+public:
+    typedef typename Neighbor::EOT EOT;
+    typedef typename EOT::value_type AtomType;
+
+    /**
+     * Constructor
+     * @param _seed seed of the keys
+     */
+    moZobristHash(unsigned long long _seed = 0x9e3779b97f4a7c15ULL) : seed(_seed) {}
+
+    virtual ~moZobristHash() {}
+
+    /**
+     * @param _sol a solution
+     * @return the hash of the solution
+     */
+    unsigned long long hash(const EOT & _sol) {
+        unsigned long long h = 0;
+        for (unsigned int i = 0; i < _sol.size(); i++)
+            h ^= key(i, _sol[i]);
+        return h;
+    }
+
+    /**
+     * @param _sol the current solution
+     * @param _hash the hash of the current solution
+     * @param _neighbor a neighbor of the solution
+     * @return the hash of the solution obtained by the move of the neighbor
+     */
+    virtual unsigned long long hash(EOT & _sol, unsigned long long _hash, Neighbor & _neighbor) {
+        EOT tmp = _sol;
+        _neighbor.move(tmp);
+        return hash(tmp);
+    }
+
+    /**
+     * @param _i a position
+     * @param _value a value
+     * @return the key of the value at the position (splitmix64)
+     */
+    unsigned long long key(unsigned int _i, const AtomType & _value) const {
+        unsigned long long z = seed + (_i + 1) * 0x9e3779b97f4a7c15ULL + std::hash<AtomType>()(_value) * 0xd6e8feb86659fd93ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+protected:
+    // seed of the keys
+    unsigned long long seed;
+};
+
+#endif
@@ -91,6 +91,7 @@
 #include <continuator/moNeighborFitnessStat.h>
 #include <continuator/moNeighborhoodStat.h>
 #include <continuator/moNeutralDegreeNeighborStat.h>
+#include <continuator/moProfileStat.h>
 #include <continuator/moSecondMomentNeighborStat.h>
 #include <continuator/moSizeNeighborStat.h>
 #include <continuator/moSolutionStat.h>
@@ -144,7 +145,9 @@
 #include <memory/moRndIndexedVectorTabuList.h>
 #include <memory/moSolVectorTabuList.h>
 #include <memory/moRndIndexedVectorTabuList.h>
+#include <memory/moTabuHashTable.h>
 #include <memory/moTabuList.h>
+#include <memory/moZobristHash.h>
 
 #include <neighborhood/moBackableNeighbor.h>
 #include <neighborhood/moBackwardVectorVNSelection.h>
@@ -153,6 +156,7 @@
 #include <neighborhood/moForwardVectorVNSelection.h>
 #include <neighborhood/moIndexNeighbor.h>
 #include <neighborhood/moIndexNeighborhood.h>
+#include <neighborhood/moIndexNeighborhoodScan.h>
 #include <neighborhood/moNeighbor.h>
 #include <neighborhood/moNeighborhood.h>
 #include <neighborhood/moOrderNeighborhood.h>
@@ -176,17 +180,20 @@
 #include <problems/bitString/moBitsNeighborhood.h>
 #include <problems/bitString/moBitsWithoutReplNeighborhood.h>
 #include <problems/bitString/moBitsWithReplNeighborhood.h>
+#include <problems/bitString/moBitZobristHash.h>
 
 #include <problems/permutation/moIndexedSwapNeighbor.h>
 #include <problems/permutation/moShiftNeighbor.h>
 #include <problems/permutation/moSwapNeighbor.h>
 #include <problems/permutation/moSwapNeighborhood.h>
+#include <problems/permutation/moSwapZobristHash.h>
 #include <problems/permutation/moTwoOptExNeighbor.h>
 #include <problems/permutation/moTwoOptExNeighborhood.h>
 
 //#include <problems/eval/moMaxSATincrEval.h>
 //#include <problems/eval/moOneMaxIncrEval.h>
 //#include <problems/eval/moQAPIncrEval.h>
+//#include <problems/eval/moQAPdoubleIncrEvaluation.h>
 //#include <problems/eval/moRoyalRoadIncrEval.h>
 //#include <problems/eval/moUBQPSimpleIncrEval.h>
 //#include <problems/eval/moUBQPdoubleIncrEvaluation.h>
@@ -0,0 +1,184 @@
+/*
+ <moIndexNeighborhoodScan.h>
+ Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+ Sebastien Verel, Arnaud Liefooghe, Jeremie Humeau
+
+ This software is governed by the CeCILL license under French law and
+ abiding by the rules of distribution of free software.  You can  use,
+ modify and/ or redistribute the software under the terms of the CeCILL
+ license as circulated by CEA, CNRS and INRIA at the following URL
+ "http://www.cecill.info".
+
+ As a counterpart to the access to the source code and  rights to copy,
+ modify and redistribute granted by the license, users are provided only
+ with a limited warranty  and the software's author,  the holder of the
+ economic rights,  and the successive licensors  have only  limited liability.
+
+ In this respect, the user's attention is drawn to the risks associated
+ with loading,  using,  modifying and/or developing or reproducing the
+ software by the user in light of its specific status of free software,
+ that may mean  that it is complicated to manipulate,  and  that  also
+ therefore means  that it is reserved for developers  and  experienced
+ professionals having in-depth computer knowledge. Users are therefore
+ encouraged to load and test the software's suitability as regards their
+ requirements in conditions enabling the security of their systems and/or
+ data to be ensured and,  more generally, to use and operate it in the
+ same conditions as regards security.
+ The fact that you are presently reading this means that you have had
+ knowledge of the CeCILL license and that you accept its terms.
+
+ ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+ Contact: paradiseo-help@lists.gforge.inria.fr
+ */
+
+
+#ifndef _moIndexNeighborhoodScan_h
+#define _moIndexNeighborhoodScan_h
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <eval/moEval.h>
+#include <neighborhood/moIndexNeighbor.h>
+#include <neighborhood/moOrderNeighborhood.h>
+#include <neighborhood/moRndWithoutReplNeighborhood.h>
+#include <utils/eoParallel.h>
+#include <utils/eoRNG.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Parallel scan of all the neighbors of a solution, by their indices
+ *
+ * The scan is enabled when the loops are parallelized (see make_parallel),
+ * the neighbors are moIndexNeighbor and the neighborhood visits every index
+ * once (moOrderNeighborhood, moRndWithoutReplNeighborhood): the indices are
+ * split in contiguous ranges, scanned by the OpenMP threads with their own
+ * copy of the solution, their own neighbor, and, for each index, their own
+ * rng stream. Every range gathers what it visits in its own copy of a visitor,
+ * and the visitors of the ranges are merged in the order of the indices,
+ * so that the result does not depend on the number of threads.
+ *
+ * A Visitor has:
+ *  - void operator()(EOT& _solution, Neighbor& _neighbor), visiting an
+ *    evaluated neighbor of the solution, which is not to be modified, and
+ *  - void merge(Visitor& _next), merging the visitor of the next range.
+ *
+ * The evaluation function is called by several threads at once: the
+ * incremental evaluations only read the solution, and the full ones work on
+ * the copy of the range, but the evaluation functions with a state must
+ * protect it (as moEvalCounter does).
+ */
+template<class Neighbor>
+class moIndexNeighborhoodScan
+{
+public:
+    typedef typename Neighbor::EOT EOT;
+    typedef typename EOT::Fitness Fitness;
+    typedef moNeighborhood<Neighbor> Neighborhood;
+
+    /**
+     * Constructor
+     * @param _neighborhood the neighborhood
+     * @param _eval the evaluation function
+     */
+    moIndexNeighborhoodScan(Neighborhood& _neighborhood, moEval<Neighbor>& _eval) :
+            neighborhood(_neighborhood), eval(_eval) {}
+
+    /**
+     * @return true if the neighborhood is scanned in parallel
+     */
+    bool isEnabled() {
+#ifdef _OPENMP
+        return eo::parallel.isEnabled() && scannable(Indexed());
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Visit all the neighbors of a solution which has neighbors
+     * @param _solution the solution
+     * @param _visitor a visitor which has not visited anything yet, copied for every range, then merged from them
+     */
+    template<class Visitor>
+    void operator()(EOT & _solution, Visitor & _visitor) {
+        scan(_solution, _visitor, Indexed());
+    }
+
+private:
+    // true if the neighbors have an index
+    typedef std::is_base_of< moIndexNeighbor<EOT, Fitness>, Neighbor > Indexed;
+
+    bool scannable(std::false_type) {
+        return false;
+    }
+
+    bool scannable(std::true_type) {
+        return dynamic_cast< moOrderNeighborhood<Neighbor>* >(&neighborhood) != NULL
+               || dynamic_cast< moRndWithoutReplNeighborhood<Neighbor>* >(&neighborhood) != NULL;
+    }
+
+    template<class Visitor>
+    void scan(EOT & _solution, Visitor & _visitor, std::false_type) {
+    }
+
+    template<class Visitor>
+    void scan(EOT & _solution, Visitor & _visitor, std::true_type) {
+        // the neighborhood may set its size from the solution
+        Neighbor first;
+        neighborhood.init(_solution, first);
+        unsigned int size = dynamic_cast< moIndexNeighborhood<Neighbor>& >(neighborhood).getNeighborhoodSize();
+
+        // a few ranges per thread, for the dynamic scheduling to balance them
+        unsigned int threads = 1;
+#ifdef _OPENMP
+        threads = omp_get_max_threads();
+#endif
+        unsigned int ranges = std::max(1u, std::min(size, eo::parallel.isDynamic() ? 4 * threads : threads));
+        std::vector<Visitor> visitors(ranges, _visitor);
+        const uint64_t seed = eo::streamSeed();
+
+        if (eo::parallel.isDynamic()) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int r = 0; r < (int) ranges; r++)
+                scanRange(_solution, first, visitors[r], (unsigned long) size * r / ranges, (unsigned long) size * (r + 1) / ranges, seed);
+        }
+        else {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int r = 0; r < (int) ranges; r++)
+                scanRange(_solution, first, visitors[r], (unsigned long) size * r / ranges, (unsigned long) size * (r + 1) / ranges, seed);
+        }
+
+        _visitor = visitors[0];
+        for (unsigned int r = 1; r < ranges; r++)
+            _visitor.merge(visitors[r]);
+    }
+
+    template<class Visitor>
+    void scanRange(EOT & _solution, Neighbor & _first, Visitor & _visitor, unsigned int _begin, unsigned int _end, uint64_t _seed) {
+        EOT solution(_solution);
+        Neighbor neighbor(_first);
+        eoRngStream stream;
+        eoRngStreamScope scope(stream);
+        for (unsigned int i = _begin; i < _end; i++) {
+            stream.reseed(_seed, i);
+            neighbor.index(solution, i);
+            eval(solution, neighbor);
+            _visitor(_solution, neighbor);
+        }
+    }
+
+    Neighborhood & neighborhood;
+    moEval<Neighbor> & eval;
+};
+
+#endif
@@ -0,0 +1,65 @@
+/*
+<moBitZobristHash.h>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+Sébastien Verel, Arnaud Liefooghe, Jérémie Humeau
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#ifndef _moBitZobristHash_h
+#define _moBitZobristHash_h
+
+#include <memory/moZobristHash.h>
+
+/**
+ * Zobrist hashing of the bit strings, for the neighbors which flip the bit of their index (moBitNeighbor)
+ */
+template< class Neighbor >
+class moBitZobristHash : public moZobristHash<Neighbor>
+{
+public:
+    typedef typename Neighbor::EOT EOT;
+
+    using moZobristHash<Neighbor>::hash;
+    using moZobristHash<Neighbor>::key;
+
+    /**
+     * @param _seed seed of the keys
+     */
+    moBitZobristHash(unsigned long long _seed = 0x9e3779b97f4a7c15ULL) : moZobristHash<Neighbor>(_seed) {}
+
+    /**
+     * @param _sol the current solution
+     * @param _hash the hash of the current solution
+     * @param _neighbor a neighbor of the solution
+     * @return the hash of the solution with the bit of the neighbor flipped
+     */
+    virtual unsigned long long hash(EOT & _sol, unsigned long long _hash, Neighbor & _neighbor) {
+        unsigned int i = _neighbor.index();
+        bool bit = _sol[i];
+        return _hash ^ key(i, bit) ^ key(i, !bit);
+    }
+};
+
+#endif
@@ -0,0 +1,195 @@
+/*
+  <moQAPdoubleIncrEvaluation.h>
+  Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+  Sebastien Verel, Arnaud Liefooghe, Jeremie Humeau
+
+  This software is governed by the CeCILL license under French law and
+  abiding by the rules of distribution of free software.  You can  use,
+  modify and/ or redistribute the software under the terms of the CeCILL
+  license as circulated by CEA, CNRS and INRIA at the following URL
+  "http://www.cecill.info".
+
+  As a counterpart to the access to the source code and  rights to copy,
+  modify and redistribute granted by the license, users are provided only
+  with a limited warranty  and the software's author,  the holder of the
+  economic rights,  and the successive licensors  have only  limited liability.
+
+  In this respect, the user's attention is drawn to the risks associated
+  with loading,  using,  modifying and/or developing or reproducing the
+  software by the user in light of its specific status of free software,
+  that may mean  that it is complicated to manipulate,  and  that  also
+  therefore means  that it is reserved for developers  and  experienced
+  professionals having in-depth computer knowledge. Users are therefore
+  encouraged to load and test the software's suitability as regards their
+  requirements in conditions enabling the security of their systems and/or
+  data to be ensured and,  more generally, to use and operate it in the
+  same conditions as regards security.
+  The fact that you are presently reading this means that you have had
+  knowledge of the CeCILL license and that you accept its terms.
+
+  ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+  Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#ifndef moQAPdoubleIncrEvaluation_H
+#define moQAPdoubleIncrEvaluation_H
+
+#include <vector>
+
+#include <eval/moDoubleIncrEvaluation.h>
+#include <explorer/moNeighborhoodExplorer.h>
+#include <eval/qapEval.h>
+
+/**
+ * The neighborhood evaluation for the QAP with the swap neighborhood
+ * The double incremental evaluation is used (E. Taillard, Robust taboo search for the QAP, 1991)
+ *
+ * The delta of every swap is kept from an iteration to another: after the swap (u, v),
+ * the delta of a swap (r, s) with r, s not in {u, v} is updated in O(1),
+ * the other ones are computed in O(n), so that the whole neighborhood is evaluated in O(n^2).
+ *
+ * The neighbors are indexed swaps (moIndexedSwapNeighbor), and the size of the neighborhood is n(n-1)/2.
+ * The evaluation of a neighbor is then given by moDoubleIncrNeighborhoodEval, in a moEvaluatedNeighborhood.
+ *
+ * BECAREFULL: This object must be added to the moCheckpoint of the local search (init method)
+ */
+template<class Neighbor, typename ElemType = long int>
+class moQAPdoubleIncrEvaluation : public moDoubleIncrEvaluation<Neighbor>
+{
+public:
+  typedef typename Neighbor::EOT EOT;
+  typedef typename EOT::Fitness Fitness;
+
+  using moDoubleIncrEvaluation<Neighbor>::deltaFitness;
+  using moDoubleIncrEvaluation<Neighbor>::firstEval;
+  using moDoubleIncrEvaluation<Neighbor>::neighborhoodSize;
+
+  /**
+   * Constructor 
+   *
+   * @param _qapEval full evaluation of the QAP problem
+   */
+  moQAPdoubleIncrEvaluation(QAPeval<EOT, ElemType> & _qapEval) : moDoubleIncrEvaluation<Neighbor>(_qapEval.getNbVar() * (_qapEval.getNbVar() - 1) / 2), searchExplorer(NULL)
+  {
+    n = _qapEval.getNbVar();
+    A = _qapEval.getA()[0];
+    B = _qapEval.getB()[0];
+    delta.resize(neighborhoodSize);
+  }
+  
+  void neighborhoodExplorer(moNeighborhoodExplorer<Neighbor> & _searchExplorer) {
+    searchExplorer = & _searchExplorer;
+  }
+
+  /**
+   *  Evaluation of the neighborhood
+   *
+   * @param _solution the current solution 
+   */
+  virtual void operator()(EOT & _solution) {
+    if (firstEval) {
+      firstEval = false;
+
+      // the two positions swapped by each neighbor
+      if (first.size() != neighborhoodSize) {
+	Neighbor neighbor;
+	first.resize(neighborhoodSize);
+	second.resize(neighborhoodSize);
+	for (unsigned k = 0; k < neighborhoodSize; k++) {
+	  neighbor.index(_solution, k);
+	  first[k] = neighbor.first();
+	  second[k] = neighbor.second();
+	}
+      }
+
+      // compute the delta in the simple incremental way O(n)
+      for (unsigned k = 0; k < neighborhoodSize; k++)
+	delta[k] = computeDelta(_solution, first[k], second[k]);
+    } else {
+
+      if (searchExplorer->moveApplied()) { 
+	// the selectedNeighbor is the swap (u, v) which has been applied to the solution
+	unsigned u = searchExplorer->getSelectedNeighbor().first();
+	unsigned v = searchExplorer->getSelectedNeighbor().second();
+
+	for (unsigned k = 0; k < neighborhoodSize; k++) {
+	  unsigned r = first[k];
+	  unsigned s = second[k];
+	  if (r == u || r == v || s == u || s == v)
+	    delta[k] = computeDelta(_solution, r, s);
+	  else
+	    delta[k] += updateDelta(_solution, r, s, u, v);
+	}
+      }
+    }
+
+    for (unsigned k = 0; k < neighborhoodSize; k++)
+      deltaFitness[k] = delta[k];
+  }
+
+  /*
+   * to get the number of objects, of variables
+   *
+   * @return number of objects
+   */
+  int getNbVar() {
+    return n;
+  }
+
+private:
+  /**
+   * delta of the swap (r, s) in O(n)
+   */
+  ElemType computeDelta(EOT & _p, unsigned _r, unsigned _s) {
+    const ElemType * ar = A + _r * n;
+    const ElemType * as = A + _s * n;
+    const ElemType * bpr = B + _p[_r] * n;
+    const ElemType * bps = B + _p[_s] * n;
+
+    ElemType d = (ar[_r] - as[_s]) * (bps[_p[_s]] - bpr[_p[_r]]) + (ar[_s] - as[_r]) * (bps[_p[_r]] - bpr[_p[_s]]);
+
+    for (unsigned k = 0; k < (unsigned) n; k++)
+      if (k != _r && k != _s) {
+	const ElemType * ak = A + k * n;
+	const ElemType * bpk = B + _p[k] * n;
+	d += (ak[_r] - ak[_s]) * (bpk[_p[_s]] - bpk[_p[_r]]) + (ar[k] - as[k]) * (bps[_p[k]] - bpr[_p[k]]);
+      }
+
+    return d;
+  }
+
+  /**
+   * variation of the delta of the swap (r, s) after the swap (u, v) in O(1), 
+   * where _p is the solution after the swap (u, v) and r, s are not in {u, v}
+   */
+  ElemType updateDelta(EOT & _p, unsigned _r, unsigned _s, unsigned _u, unsigned _v) {
+    unsigned pr = _p[_r], ps = _p[_s], pu = _p[_u], pv = _p[_v];
+
+    return (A[_r * n + _u] - A[_r * n + _v] + A[_s * n + _v] - A[_s * n + _u]) *
+      (B[ps * n + pu] - B[ps * n + pv] + B[pr * n + pv] - B[pr * n + pu]) +
+      (A[_u * n + _r] - A[_v * n + _r] + A[_v * n + _s] - A[_u * n + _s]) *
+      (B[pu * n + ps] - B[pv * n + ps] + B[pv * n + pr] - B[pu * n + pr]);
+  }
+
+  // number of variables
+  int n;
+  
+  // matrix A, row by row
+  const ElemType * A;
+  
+  // matrix B, row by row
+  const ElemType * B;
+
+  // delta of each swap
+  std::vector<ElemType> delta;
+
+  // positions swapped by each neighbor
+  std::vector<unsigned> first;
+  std::vector<unsigned> second;
+
+  /** The search explorer of the local search */
+  moNeighborhoodExplorer<Neighbor> * searchExplorer;
+};
+
+#endif
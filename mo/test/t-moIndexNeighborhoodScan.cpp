@@ -0,0 +1,199 @@
+/*
+  <t-moIndexNeighborhoodScan.cpp>
+  Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+  Sébastien Verel, Arnaud Liefooghe, Jérémie Humeau
+
+  This software is governed by the CeCILL license under French law and
+  abiding by the rules of distribution of free software.  You can  use,
+  modify and/ or redistribute the software under the terms of the CeCILL
+  license as circulated by CEA, CNRS and INRIA at the following URL
+  "http://www.cecill.info".
+
+  As a counterpart to the access to the source code and  rights to copy,
+  modify and redistribute granted by the license, users are provided only
+  with a limited warranty  and the software's author,  the holder of the
+  economic rights,  and the successive licensors  have only  limited liability.
+
+  In this respect, the user's attention is drawn to the risks associated
+  with loading,  using,  modifying and/or developing or reproducing the
+  software by the user in light of its specific status of free software,
+  that may mean  that it is complicated to manipulate,  and  that  also
+  therefore means  that it is reserved for developers  and  experienced
+  professionals having in-depth computer knowledge. Users are therefore
+  encouraged to load and test the software's suitability as regards their
+  requirements in conditions enabling the security of their systems and/or
+  data to be ensured and,  more generally, to use and operate it in the
+  same conditions as regards security.
+  The fact that you are presently reading this means that you have had
+  knowledge of the CeCILL license and that you accept its terms.
+
+  ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+  Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#include <ga/eoBit.h>
+#include <eoInit.h>
+#include <utils/eoParser.h>
+#include <utils/eoParallel.h>
+#include <problems/bitString/moBitNeighbor.h>
+#include <eval/nkLandscapesEval.h>
+#include <problems/eval/moNKlandscapesIncrEval.h>
+#include <problems/eval/moOneMaxIncrEval.h>
+#include <eval/moFullEvalByModif.h>
+#include <eval/moEvalCounter.h>
+#include <neighborhood/moOrderNeighborhood.h>
+#include <neighborhood/moRndWithReplNeighborhood.h>
+#include <explorer/moSimpleHCexplorer.h>
+#include <explorer/moRandomBestHCexplorer.h>
+#include <explorer/moTSexplorer.h>
+#include <memory/moNeighborVectorTabuList.h>
+#include <memory/moDummyIntensification.h>
+#include <memory/moDummyDiversification.h>
+#include <memory/moAspiration.h>
+#include <continuator/moNeighborhoodStat.h>
+#include <neighborhood/moIndexNeighborhoodScan.h>
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cassert>
+
+#ifdef _OPENMP
+#include <omp.h>
+#elif defined(WITH_OPENMP)
+#error "mo is built without the OpenMP flags"
+#endif
+
+typedef eoBit<double> Solution;
+typedef moBitNeighbor<double> Neighbor;
+
+/** Sets the parallelization of the loops on 4 threads, as from the command line */
+void parallelize(bool _enabled, bool _dynamic) {
+    std::string loop = std::string("--parallelize-loop=") + (_enabled ? "1" : "0");
+    std::string schedule = std::string("--parallelize-dynamic=") + (_dynamic ? "1" : "0");
+    const char* args[] = {"t-moIndexNeighborhoodScan", loop.c_str(), schedule.c_str(), "--parallelize-nthreads=4"};
+    eoParser parser(4, const_cast<char**>(args));
+    make_parallel(parser);
+}
+
+/** No tabu neighbor is aspirated */
+class NoAspiration : public moAspiration<Neighbor> {
+public:
+    void init(Solution & _sol) {}
+    void update(Solution & _sol, Neighbor & _neighbor) {}
+    bool operator()(Solution & _sol, Neighbor & _neighbor) { return false; }
+};
+
+/** What a scan of the neighborhood of the solution finds */
+struct Scan {
+    unsigned int hc, ts;
+    double best, mean, sd;
+    unsigned int nbSup, nbEqual, nbInf;
+    double randomBest;
+};
+
+Scan scan(Solution & _solution, moEval<Neighbor> & _eval, moNeighborhood<Neighbor> & _nh) {
+    Scan result;
+    moNeighborComparator<Neighbor> ncomp;
+    moSolNeighborComparator<Neighbor> sncomp;
+
+    moSimpleHCexplorer<Neighbor> hc(_nh, _eval, ncomp, sncomp);
+    hc(_solution);
+    result.hc = hc.getSelectedNeighbor().index();
+
+    // the best neighbor is tabu
+    moNeighborVectorTabuList<Neighbor> tabuList(10, 10);
+    moDummyIntensification<Neighbor> intens;
+    moDummyDiversification<Neighbor> diver;
+    NoAspiration aspir;
+    moTSexplorer<Neighbor> ts(_nh, _eval, ncomp, sncomp, tabuList, intens, diver, aspir);
+    ts.initParam(_solution);
+    tabuList.add(_solution, hc.getSelectedNeighbor());
+    ts(_solution);
+    assert(ts.accept(_solution));
+    result.ts = ts.getSelectedNeighbor().index();
+
+    moNeighborhoodStat<Neighbor> stat(_nh, _eval);
+    stat(_solution);
+    result.best = stat.getMax();
+    result.mean = stat.getMean();
+    result.sd = stat.getSD();
+    result.nbSup = stat.getNbSup();
+    result.nbEqual = stat.getNbEqual();
+    result.nbInf = stat.getNbInf();
+
+    moRandomBestHCexplorer<Neighbor> randomBest(_nh, _eval, ncomp, sncomp);
+    randomBest.initParam(_solution);
+    randomBest(_solution);
+    result.randomBest = randomBest.getSelectedNeighbor().fitness();
+
+    return result;
+}
+
+bool operator==(const Scan & _a, const Scan & _b) {
+    return _a.hc == _b.hc && _a.ts == _b.ts && _a.best == _b.best && _a.mean == _b.mean && _a.sd == _b.sd
+           && _a.nbSup == _b.nbSup && _a.nbEqual == _b.nbEqual && _a.nbInf == _b.nbInf && _a.randomBest == _b.randomBest;
+}
+
+int main() {
+
+    std::cout << "[t-moIndexNeighborhoodScan] => START" << std::endl;
+
+    int N = 300;
+    int K = 2;
+    rng.reseed(0);
+    nkLandscapesEval<Solution> fullEval(N, K);
+    moNKlandscapesIncrEval<Neighbor> incrEval(fullEval);
+    moEvalCounter<Neighbor> incrCounter(incrEval);
+    // the full evaluation by modification of the solution works on a copy in each thread
+    moFullEvalByModif<Neighbor> modifEval(fullEval);
+
+    eoUniformGenerator<bool> uGen;
+    eoInitFixedLength<Solution> init(N, uGen);
+    Solution solution;
+    init(solution);
+    fullEval(solution);
+
+    moOrderNeighborhood<Neighbor> nh(N);
+    moIndexNeighborhoodScan<Neighbor> nhScan(nh, incrCounter);
+    moRndWithReplNeighborhood<Neighbor> rndNh(N);
+    moIndexNeighborhoodScan<Neighbor> rndNhScan(rndNh, incrCounter);
+
+    parallelize(false, false);
+    assert(!nhScan.isEnabled());
+    Scan sequential = scan(solution, incrCounter, nh);
+    Scan sequentialModif = scan(solution, modifEval, nh);
+    assert(sequential.ts != sequential.hc);
+    assert(sequential.randomBest == sequential.best);
+
+    parallelize(true, false);
+#ifdef WITH_OPENMP
+    // the neighborhoods visiting every index once only, scanned in several ranges
+    assert(nhScan.isEnabled());
+    assert(!rndNhScan.isEnabled());
+    assert(omp_get_max_threads() == 4);
+#endif
+    unsigned long evaluations = incrCounter.value();
+    Scan parallel = scan(solution, incrCounter, nh);
+    assert(incrCounter.value() - evaluations == 4 * (unsigned long) N);
+    assert(parallel == sequential);
+    assert(scan(solution, modifEval, nh) == sequentialModif);
+
+    parallelize(true, true);
+    assert(scan(solution, incrCounter, nh) == sequential);
+    assert(scan(solution, modifEval, nh) == sequentialModif);
+
+    // only ties: the neighbor of lowest index is the best one
+    moOneMaxIncrEval<Neighbor> oneMax;
+    Solution zeros(N, false);
+    zeros.fitness(0);
+    Scan ties = scan(zeros, oneMax, nh);
+    assert(ties.hc == 0 && ties.ts == 1 && ties.nbSup == (unsigned int) N);
+    parallelize(false, false);
+    assert(scan(zeros, oneMax, nh) == ties);
+
+    std::cout << "[t-moIndexNeighborhoodScan] => OK" << std::endl;
+
+    return EXIT_SUCCESS;
+}
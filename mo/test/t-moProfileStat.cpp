@@ -0,0 +1,99 @@
+/*
+<t-moProfileStat.cpp>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+Sébastien Verel, Arnaud Liefooghe, Jérémie Humeau
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+// the instrumentation of the headers is compiled in this test only
+#define WITH_PROFILER
+
+#include <algo/moFirstImprHC.h>
+#include <continuator/moCheckpoint.h>
+#include <continuator/moTrueContinuator.h>
+#include <continuator/moProfileStat.h>
+#include <eval/moEvalCounter.h>
+#include "moTestClass.h"
+#include <eval/oneMaxEval.h>
+
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <cassert>
+
+unsigned phase(std::string _name) {
+    const std::vector<std::string>& phases = eo::profiler.phases();
+    return std::find(phases.begin(), phases.end(), _name) - phases.begin();
+}
+
+unsigned counter(std::string _name) {
+    const std::vector<std::string>& counters = eo::profiler.counters();
+    return std::find(counters.begin(), counters.end(), _name) - counters.begin();
+}
+
+int main() {
+
+    std::cout << "[t-moProfileStat] => START" << std::endl;
+
+    bitNeighborhood nh(8);
+    oneMaxEval<bitVector> fullEval;
+    evalOneMax oneMax(8);
+    moEvalCounter<bitNeighbor> eval(oneMax);
+
+    moTrueContinuator<bitNeighbor> cont;
+    moCheckpoint<bitNeighbor> checkpoint(cont);
+    moProfileStat<bitVector> profile;
+    eoValueParam<double>& scanTime = profile.time("neighborhood");
+    eoValueParam<unsigned long>& neighborEvals = profile.count("neighbor evaluations");
+    checkpoint.add(profile);
+
+    moFirstImprHC<bitNeighbor> hc(nh, fullEval, eval, checkpoint);
+
+    // a solution with 5 ones: 5 improving moves, then a step without any
+    bitVector sol(8, false);
+    for (unsigned i = 0; i < 5; i++)
+        sol[i] = true;
+    hc(sol);
+    assert(sol.fitness() == 0);
+
+    // every step is timed
+    unsigned long steps = eo::profiler.calls(phase("neighborhood"));
+    assert(steps == 6);
+    assert(eo::profiler.calls(phase("accept")) == steps);
+    assert(eo::profiler.calls(phase("continuator")) == steps);
+    assert(eo::profiler.calls(phase("evaluate")) == 1);
+    assert(eo::profiler.total(counter("evaluations")) == 1);
+    assert(eo::profiler.total(counter("neighbor evaluations")) == eval.value());
+
+    // the stat gives the increments of the last step: a scan of the whole neighborhood
+    assert(neighborEvals.value() == 8);
+    assert(scanTime.value() > 0);
+    assert(scanTime.value() <= eo::profiler.time(phase("neighborhood")));
+
+    assert(profile.className() == "moProfileStat");
+    std::cout << "[t-moProfileStat] => OK" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/*
+<t-moQAPdoubleIncrEvaluation.cpp>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+Sébastien Verel, Arnaud Liefooghe, Jérémie Humeau
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#include <memory/moSolVectorTabuList.h>
+
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <cassert>
+
+#include <mo>
+#include <eoInt.h>
+#include <eval/qapEval.h>
+#include <problems/eval/moQAPIncrEval.h>
+#include <problems/eval/moQAPdoubleIncrEvaluation.h>
+
+typedef eoInt<eoMinimizingFitness> Permutation;
+typedef moIndexedSwapNeighbor<Permutation> Neighbor;
+
+/**
+ * Evaluation which checks the double incremental evaluation against the simple incremental one
+ */
+class CheckedEval : public moEval<Neighbor>
+{
+public:
+    CheckedEval(moEval<Neighbor> & _eval, moEval<Neighbor> & _reference) : eval(_eval), reference(_reference), nbEval(0), ok(true) {}
+
+    void operator()(Permutation & _sol, Neighbor & _neighbor) {
+        reference(_sol, _neighbor);
+        eoMinimizingFitness f = _neighbor.fitness();
+        eval(_sol, _neighbor);
+        if (_neighbor.fitness() != f)
+            ok = false;
+        nbEval++;
+    }
+
+    moEval<Neighbor> & eval;
+    moEval<Neighbor> & reference;
+    unsigned int nbEval;
+    bool ok;
+};
+
+int main() {
+
+    std::cout << "[t-moQAPdoubleIncrEvaluation] => START" << std::endl;
+
+    // random asymmetric instance
+    const unsigned int n = 12;
+    const char * file = "t-moQAPdoubleIncrEvaluation.dat";
+    rng.reseed(1);
+    std::ofstream os(file);
+    os << n << std::endl;
+    for (unsigned int m = 0; m < 2; m++)
+        for (unsigned int i = 0; i < n; i++) {
+            for (unsigned int j = 0; j < n; j++)
+                os << rng.random(10) << " ";
+            os << std::endl;
+        }
+    os.close();
+
+    QAPeval<Permutation> fullEval(file);
+    moQAPIncrEval<Neighbor> incrEval(fullEval);
+    moQAPdoubleIncrEvaluation<Neighbor> doubleIncrEval(fullEval);
+    moDoubleIncrNeighborhoodEval<Neighbor> neighborEval(doubleIncrEval);
+    CheckedEval eval(neighborEval, incrEval);
+
+    moOrderNeighborhood<Neighbor> swapNeighborhood(n * (n - 1) / 2);
+    moEvaluatedNeighborhood<Neighbor> neighborhood(swapNeighborhood, doubleIncrEval);
+
+    moIterContinuator<Neighbor> cont(50, false);
+    moCheckpoint<Neighbor> checkpoint(cont);
+    checkpoint.add(doubleIncrEval);
+
+    moNeighborVectorTabuList<Neighbor> tabuList(10, 10);
+    moNeighborComparator<Neighbor> neighborComp;
+    moSolNeighborComparator<Neighbor> solNeighborComp;
+    moDummyIntensification<Neighbor> intensification;
+    moDummyDiversification<Neighbor> diversification;
+    moBestImprAspiration<Neighbor> aspiration;
+    moTS<Neighbor> ts(neighborhood, fullEval, eval, neighborComp, solNeighborComp, checkpoint, tabuList, intensification, diversification, aspiration);
+    doubleIncrEval.neighborhoodExplorer(ts.getExplorer());
+
+    Permutation sol(n);
+    for (unsigned int i = 0; i < n; i++)
+        sol[i] = i;
+    fullEval(sol);
+
+    // every neighbor evaluated by the tabu search is checked
+    Permutation current = sol;
+    ts(sol);
+
+    assert(eval.ok);
+    assert(eval.nbEval == 50 * n * (n - 1) / 2);
+    Permutation best = sol;
+    fullEval(best);
+    assert(best.fitness() == sol.fitness());
+    assert(!(sol.fitness() < current.fitness()));
+
+    std::remove(file);
+
+    std::cout << "[t-moQAPdoubleIncrEvaluation] => OK" << std::endl;
+
+    return EXIT_SUCCESS;
+}
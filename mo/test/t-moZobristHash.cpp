@@ -0,0 +1,118 @@
+/*
+<t-moZobristHash.cpp>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2010
+
+Sébastien Verel, Arnaud Liefooghe, Jérémie Humeau
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#include <memory/moSolVectorTabuList.h>
+
+#include <memory/moSolVectorTabuList.h>
+#include <problems/bitString/moBitZobristHash.h>
+#include <problems/permutation/moSwapZobristHash.h>
+#include <problems/permutation/moIndexedSwapNeighbor.h>
+#include <eoInt.h>
+#include "moTestClass.h"
+
+#include <iostream>
+#include <cstdlib>
+#include <cassert>
+
+typedef eoInt<eoMinimizingFitness> Permutation;
+typedef moSwapNeighbor<Permutation> swapNeighbor;
+typedef moIndexedSwapNeighbor<Permutation> indexedSwapNeighbor;
+
+int main() {
+
+    std::cout << "[t-moZobristHash] => START" << std::endl;
+
+    //the hash of a neighbor is the hash of the moved solution
+    moZobristHash<bitNeighbor> fullBitHash;
+    moBitZobristHash<bitNeighbor> bitHash;
+    bitVector sol(100, true);
+    for (unsigned int i = 0; i < sol.size(); i += 3)
+        sol[i] = false;
+    unsigned long long h = bitHash.hash(sol);
+    assert(h == fullBitHash.hash(sol));
+    for (unsigned int i = 0; i < sol.size(); i++) {
+        bitNeighbor n;
+        n.index(i);
+        bitVector tmp = sol;
+        n.move(tmp);
+        assert(bitHash.hash(sol, h, n) == bitHash.hash(tmp));
+        assert(fullBitHash.hash(sol, h, n) == bitHash.hash(tmp));
+        assert(bitHash.hash(sol, h, n) != h);
+    }
+
+    moSwapZobristHash<swapNeighbor> swapHash;
+    moSwapZobristHash<indexedSwapNeighbor> indexedSwapHash;
+    Permutation perm(10);
+    for (unsigned int i = 0; i < perm.size(); i++)
+        perm[i] = (7 * i) % 10;
+    h = swapHash.hash(perm);
+    assert(h == indexedSwapHash.hash(perm));
+    for (unsigned int k = 0; k < 45; k++) {
+        indexedSwapNeighbor n;
+        n.index(perm, k);
+        swapNeighbor m;
+        m.setIndices(n.first(), n.second());
+        Permutation tmp = perm;
+        n.move(tmp);
+        assert(indexedSwapHash.hash(perm, h, n) == swapHash.hash(tmp));
+        assert(swapHash.hash(perm, h, m) == swapHash.hash(tmp));
+    }
+
+    //the tabu list gives the same answers with the incremental hash
+    moSolVectorTabuList<bitNeighbor> test(2, 2, bitHash);
+    bitVector sol1(4, true);
+    bitVector sol2(4, true);
+    sol2[0] = false;
+    bitNeighbor n1, n2;
+    n1.index(0);
+    n2.index(1);
+    test.init(sol1);
+    test.add(sol1, n1);
+    assert(test.check(sol2, n1));
+    assert(!test.check(sol2, n2));
+    test.update(sol2, n1);
+    assert(test.check(sol2, n1));
+    test.update(sol2, n1);
+    assert(!test.check(sol2, n1));
+
+    //the solution is hashed again after an update
+    test.add(sol1, n1);
+    test.update(sol1, n1);
+    assert(test.check(sol2, n1));
+    sol2[0] = true;
+    sol2[1] = false;
+    test.update(sol2, n1);
+    assert(!test.check(sol2, n1));
+    test.add(sol1, n1);
+    assert(test.check(sol2, n2));
+
+    std::cout << "[t-moZobristHash] => OK" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+/*
+ * Compare the updates of moeoUnboundedArchive and moeoNDTreeArchive with a
+ * stream of candidates approaching the spherical front of DTLZ2, as the
+ * neighbors inserted by a Pareto local search. Both archives end with the
+ * same solutions; the time per candidate is reported, in microseconds.
+ *
+ * Usage: b-moeoArchive [candidates]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <moeo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef moeoRealObjectiveVector < moeoObjectiveVectorTraits > ObjectiveVector;
+typedef MOEO < ObjectiveVector, double, double > Solution;
+
+/** Candidates on spheres of radius decreasing to 1 */
+void candidates(unsigned nObjectives, eoPop < Solution > & pop)
+{
+    vector < double > x(nObjectives - 1);
+    for(unsigned s = 0; s < pop.size(); s++)
+    {
+        for(unsigned i = 0; i < x.size(); i++)
+            x[i] = rng.uniform();
+        double radius = 1 + rng.uniform() * (pop.size() - s) / pop.size();
+
+        ObjectiveVector objVec;
+        for(unsigned j = 0; j < nObjectives; j++)
+        {
+            double f = radius;
+            for(unsigned i = 0; i < nObjectives - 1 - j; i++)
+                f *= cos(x[i] * M_PI / 2);
+            if(j > 0)
+                f *= sin(x[nObjectives - 1 - j] * M_PI / 2);
+            objVec[j] = f;
+        }
+        pop[s].objectiveVector(objVec);
+    }
+}
+
+/** Time per candidate, in microseconds */
+double timeIt(moeoArchive < Solution > & archive, eoPop < Solution > & pop)
+{
+    auto start = chrono::steady_clock::now();
+    for(unsigned s = 0; s < pop.size(); s++)
+        archive(pop[s]);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, micro>(stop - start).count() / pop.size();
+}
+
+int main(int argc, char** argv)
+{
+    unsigned nCandidates = argc > 1 ? atoi(argv[1]) : 20000;
+    eoBenchReport report("b-moeoArchive");
+
+    cout << "candidates=" << nCandidates << endl;
+    cout << "time per candidate (us)" << endl;
+    cout << setw(6) << "M" << setw(10) << "archive" << setw(12) << "unbounded" << setw(12) << "nd-tree" << endl;
+
+    unsigned objectives[] = {2, 3, 5};
+    for(unsigned m : objectives)
+    {
+        vector < bool > bObjectives(m, true);
+        moeoObjectiveVectorTraits::setup(m, bObjectives);
+        eoPop < Solution > pop;
+        pop.resize(nCandidates);
+        rng.reseed(42);
+        candidates(m, pop);
+
+        moeoUnboundedArchive < Solution > unbounded;
+        moeoNDTreeArchive < Solution > ndTree;
+        double times[2];
+        times[0] = timeIt(unbounded, pop);
+        times[1] = timeIt(ndTree, pop);
+        if(!ndTree.equals(unbounded))
+        {
+            cerr << "different archives with " << m << " objectives" << endl;
+            return EXIT_FAILURE;
+        }
+
+        cout << setw(6) << m << setw(10) << ndTree.size() << setw(12) << times[0] << setw(12) << times[1] << endl;
+        const char* names[] = {"unbounded", "nd-tree"};
+        for(unsigned a = 0; a < 2; a++)
+            report.record(names[a]).param("objectives", m).param("candidates", nCandidates).value("archive", ndTree.size(), "solutions").value("time", times[a], "us");
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/*
+ * Compare moeoExactHypervolume with the slicing algorithm of moeoHyperVolumeMetric
+ * on fronts of DTLZ2 (points of the unit sphere), from 100 to 10000 points.
+ * An algorithm is not run anymore on larger fronts once it has taken more than a
+ * few seconds.
+ *
+ * Usage: b-moeoHypervolume [maxPoints] [maxSeconds]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <moeo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef moeoRealObjectiveVector < moeoObjectiveVectorTraits > ObjectiveVector;
+
+/** Random points of the DTLZ2 Pareto front */
+void dtlz2(unsigned n, unsigned m, moeoObjectiveMatrix & front)
+{
+    front.resize(n, m);
+    for(unsigned i = 0; i < n; i++)
+    {
+        double norm = 0;
+        for(unsigned j = 0; j < m; j++)
+        {
+            front[i][j] = std::fabs(rng.normal());
+            norm += front[i][j] * front[i][j];
+        }
+        for(unsigned j = 0; j < m; j++)
+            front[i][j] /= std::sqrt(norm);
+    }
+}
+
+/** Time of the slicing algorithm, in milliseconds */
+double timeSlicing(const moeoObjectiveMatrix & front, const vector<double> & reference, double & value)
+{
+    moeoHyperVolumeMetric < ObjectiveVector > metric(false, 1.1);
+    vector < vector < double > > points(front.size(), vector<double>(reference.size()));
+    auto start = chrono::steady_clock::now();
+    for(unsigned i = 0; i < front.size(); i++)
+        for(unsigned j = 0; j < reference.size(); j++)
+            points[i][j] = reference[j] - front[i][j];
+    value = metric.calc_hypervolume(points, points.size(), reference.size());
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/** Time of the exact algorithm, in milliseconds */
+double timeExact(const moeoObjectiveMatrix & front, const vector<double> & reference, double & value)
+{
+    moeoExactHypervolume hypervolume;
+    auto start = chrono::steady_clock::now();
+    value = hypervolume(front, reference);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/** Time of the exclusive contributions of every point, in milliseconds */
+double timeContributions(const moeoObjectiveMatrix & front, const vector<double> & reference)
+{
+    moeoExactHypervolume hypervolume;
+    vector < double > contributions;
+    auto start = chrono::steady_clock::now();
+    hypervolume.contributions(front, reference, contributions);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/** Print and record a time, or '-' if the algorithm was skipped */
+void print(eoBenchReport & report, const string & name, unsigned m, unsigned n, double time, int width)
+{
+    if(time < 0)
+        cout << setw(width) << "-";
+    else
+    {
+        cout << setw(width) << time;
+        report.record(name).param("M", m).param("points", n).value("time", time, "ms");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxPoints = argc > 1 ? atoi(argv[1]) : 10000;
+    double maxSeconds = argc > 2 ? atof(argv[2]) : 2.0;
+    eoBenchReport report("b-moeoHypervolume");
+
+    cout << "maxPoints=" << maxPoints << " maxSeconds=" << maxSeconds << endl;
+    cout << "time (ms), '-' when skipped" << endl;
+    cout << setw(4) << "M" << setw(8) << "points" << setw(14) << "hypervolume"
+         << setw(12) << "slicing" << setw(12) << "exact" << setw(16) << "contributions" << endl;
+
+    unsigned objectives[] = {2, 3, 4, 5, 6};
+    for(unsigned m : objectives)
+    {
+        vector < bool > bObjectives(m, true);
+        moeoObjectiveVectorTraits::setup(m, bObjectives);
+        vector < double > reference(m, 1.1);
+        bool slicing = true, exact = true, contributions = true;
+        for(unsigned n = 100; n <= maxPoints; n *= 10)
+        {
+            moeoObjectiveMatrix front;
+            rng.reseed(42);
+            dtlz2(n, m, front);
+
+            double value = 0, other = 0;
+            cout << setw(4) << m << setw(8) << n;
+            double tExact = exact ? timeExact(front, reference, value) : -1;
+            double tSlicing = slicing ? timeSlicing(front, reference, other) : -1;
+            double tContributions = contributions ? timeContributions(front, reference) : -1;
+            cout << setw(14) << (exact ? value : other);
+            print(report, "slicing", m, n, tSlicing, 12);
+            print(report, "exact", m, n, tExact, 12);
+            print(report, "contributions", m, n, tContributions, 16);
+            cout << endl;
+            // a ten times larger front takes at least ten times longer
+            slicing = slicing && tSlicing < maxSeconds * 100;
+            exact = exact && tExact < maxSeconds * 100;
+            contributions = contributions && tContributions < maxSeconds * 100;
+        }
+    }
+
+    return 0;
+}
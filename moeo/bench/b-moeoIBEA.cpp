@@ -0,0 +1,136 @@
+/*
+ * Time of the environmental replacement of IBEA (fitness assignment of the
+ * merged population, then removal of the worst individuals one by one) with
+ * the additive epsilon indicator, from 250 to 8000 parents (and as many
+ * offspring), on random points near the front of DTLZ2:
+ * - pairwise: the indicator is called for every pair, and again for every
+ *   deletion (moeoEnvironmentalReplacement);
+ * - matrix: the indicator matrix is computed by the kernel of the metric and
+ *   reused for the deletions (moeoIndicatorBasedReplacement);
+ * - parallel: the same, with the rows of the matrix computed in parallel
+ *   (same as matrix without OpenMP).
+ * An algorithm is not run anymore on larger populations once it has taken more
+ * than a given time.
+ *
+ * Usage: b-moeoIBEA [maxSize] [maxSeconds]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <moeo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef moeoRealObjectiveVector < moeoObjectiveVectorTraits > ObjectiveVector;
+typedef MOEO < ObjectiveVector, double, double > Solution;
+
+/** The epsilon indicator without its matrix kernel: every value is computed by a call of operator() */
+class PairwiseEpsilon : public moeoAdditiveEpsilonBinaryMetric < ObjectiveVector >
+{
+public:
+    void matrix(const vector < ObjectiveVector > & _objectives, vector < double > & _values, bool _parallel = false)
+    {
+        moeoNormalizedSolutionVsSolutionBinaryMetric < ObjectiveVector, double >::matrix(_objectives, _values, _parallel);
+    }
+};
+
+/** Random points near the DTLZ2 Pareto front */
+void dtlz2(unsigned n, unsigned m, eoPop < Solution > & pop)
+{
+    pop.resize(n);
+    for(unsigned i = 0; i < n; i++)
+    {
+        ObjectiveVector objVec;
+        double norm = 0;
+        for(unsigned j = 0; j < m; j++)
+        {
+            objVec[j] = fabs(rng.normal());
+            norm += objVec[j] * objVec[j];
+        }
+        double radius = 1 + rng.uniform(0.1);
+        for(unsigned j = 0; j < m; j++)
+            objVec[j] *= radius / sqrt(norm);
+        pop[i].objectiveVector(objVec);
+    }
+}
+
+/** Time of a replacement, in milliseconds */
+double time(eoReplacement < Solution > & replace, const eoPop < Solution > & parents, const eoPop < Solution > & offspring)
+{
+    eoPop < Solution > pop = parents, off = offspring;
+    auto start = chrono::steady_clock::now();
+    replace(pop, off);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/** Print and record a time, or '-' if the algorithm was skipped */
+void print(eoBenchReport & report, const string & name, unsigned m, unsigned n, double time, int width)
+{
+    if(time < 0)
+        cout << setw(width) << "-";
+    else
+    {
+        cout << setw(width) << time;
+        report.record(name).param("M", m).param("size", n).value("time", time, "ms");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxSize = argc > 1 ? atoi(argv[1]) : 8000;
+    double maxSeconds = argc > 2 ? atof(argv[2]) : 2.0;
+    eoBenchReport report("b-moeoIBEA");
+
+    cout << "maxSize=" << maxSize << " maxSeconds=" << maxSeconds << endl;
+    cout << "time (ms), '-' when skipped" << endl;
+    cout << setw(4) << "M" << setw(8) << "size" << setw(12) << "pairwise" << setw(12) << "matrix" << setw(12) << "parallel" << endl;
+
+    unsigned objectives[] = {2, 3};
+    for(unsigned m : objectives)
+    {
+        vector < bool > bObjectives(m, true);
+        moeoObjectiveVectorTraits::setup(m, bObjectives);
+
+        PairwiseEpsilon pairwiseMetric;
+        moeoExpBinaryIndicatorBasedFitnessAssignment < Solution > pairwiseAssignment(pairwiseMetric);
+        moeoEnvironmentalReplacement < Solution > pairwise(pairwiseAssignment);
+
+        moeoAdditiveEpsilonBinaryMetric < ObjectiveVector > metric;
+        moeoExpBinaryIndicatorBasedFitnessAssignment < Solution > matrixAssignment(metric);
+        moeoIndicatorBasedReplacement < Solution > matrix(matrixAssignment);
+        moeoExpBinaryIndicatorBasedFitnessAssignment < Solution > parallelAssignment(metric, 0.05, true);
+        moeoIndicatorBasedReplacement < Solution > parallel(parallelAssignment);
+
+        bool runPairwise = true, runMatrix = true, runParallel = true;
+        for(unsigned n = 250; n <= maxSize; n *= 2)
+        {
+            eoPop < Solution > parents, offspring;
+            rng.reseed(42);
+            dtlz2(n, m, parents);
+            dtlz2(n, m, offspring);
+
+            cout << setw(4) << m << setw(8) << n;
+            double tPairwise = runPairwise ? time(pairwise, parents, offspring) : -1;
+            double tMatrix = runMatrix ? time(matrix, parents, offspring) : -1;
+            double tParallel = runParallel ? time(parallel, parents, offspring) : -1;
+            print(report, "pairwise", m, n, tPairwise, 12);
+            print(report, "matrix", m, n, tMatrix, 12);
+            print(report, "parallel", m, n, tParallel, 12);
+            cout << endl;
+            // a twice larger population takes at least four times longer
+            runPairwise = runPairwise && tPairwise < maxSeconds * 250;
+            runMatrix = runMatrix && tMatrix < maxSeconds * 250;
+            runParallel = runParallel && tParallel < maxSeconds * 250;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Compare the non-dominated sorting algorithms with the default implementation of
+ * moeoDominanceDepthFitnessAssignment, on random solutions of DTLZ1 and DTLZ2,
+ * then time the crowding distance (moeoFrontByFrontCrowdingDiversityAssignment,
+ * as in NSGA-II) of the sorted population.
+ *
+ * Usage: b-moeoNondominatedSorting [popSize] [repetitions]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <eo>
+#include <moeo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+
+typedef moeoRealObjectiveVector < moeoObjectiveVectorTraits > ObjectiveVector;
+typedef MOEO < ObjectiveVector, double, double > Solution;
+
+/** Objective vectors of random DTLZ1 (linear front) or DTLZ2 (spherical front) solutions */
+void dtlz(unsigned problem, unsigned nObjectives, eoPop < Solution > & pop)
+{
+    const unsigned k = problem == 1 ? 5 : 10;
+    vector < double > x(nObjectives - 1 + k);
+    for(unsigned s = 0; s < pop.size(); s++)
+    {
+        for(unsigned i = 0; i < x.size(); i++)
+            x[i] = rng.uniform();
+        double g = 0;
+        for(unsigned i = nObjectives - 1; i < x.size(); i++)
+        {
+            double d = x[i] - 0.5;
+            g += problem == 1 ? d * d - cos(20 * M_PI * d) : d * d;
+        }
+        if(problem == 1)
+            g = 100 * (k + g);
+
+        ObjectiveVector objVec;
+        for(unsigned j = 0; j < nObjectives; j++)
+        {
+            double f = problem == 1 ? 0.5 * (1 + g) : 1 + g;
+            for(unsigned i = 0; i < nObjectives - 1 - j; i++)
+                f *= problem == 1 ? x[i] : cos(x[i] * M_PI / 2);
+            if(j > 0)
+                f *= problem == 1 ? 1 - x[nObjectives - 1 - j] : sin(x[nObjectives - 1 - j] * M_PI / 2);
+            objVec[j] = f;
+        }
+        pop[s].objectiveVector(objVec);
+    }
+}
+
+/** Time per fitness assignment, in milliseconds */
+double timeIt(moeoDominanceDepthFitnessAssignment < Solution > & fitnessAssignment, eoPop < Solution > & pop, unsigned repetitions)
+{
+    auto start = chrono::steady_clock::now();
+    for(unsigned r = 0; r < repetitions; r++)
+        fitnessAssignment(pop);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / repetitions;
+}
+
+/** Time per diversity assignment, in milliseconds */
+double timeIt(moeoDiversityAssignment < Solution > & diversityAssignment, eoPop < Solution > & pop, unsigned repetitions)
+{
+    auto start = chrono::steady_clock::now();
+    for(unsigned r = 0; r < repetitions; r++)
+        diversityAssignment(pop);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count() / repetitions;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned popSize = argc > 1 ? atoi(argv[1]) : 1000;
+    unsigned repetitions = argc > 2 ? atoi(argv[2]) : 3;
+    eoBenchReport report("b-moeoNondominatedSorting");
+
+    moeoFastNondominatedSorting fast;
+    moeoFastNondominatedSorting parallelFast(true);
+    moeoENSNondominatedSorting ens;
+    moeoDivideAndConquerNondominatedSorting divideAndConquer;
+    moeoDominanceDepthFitnessAssignment < Solution > defaultAssignment;
+    moeoDominanceDepthFitnessAssignment < Solution > fastAssignment(&fast);
+    moeoDominanceDepthFitnessAssignment < Solution > parallelAssignment(&parallelFast);
+    moeoDominanceDepthFitnessAssignment < Solution > ensAssignment(&ens);
+    moeoDominanceDepthFitnessAssignment < Solution > dcAssignment(&divideAndConquer);
+    moeoFrontByFrontCrowdingDiversityAssignment < Solution > crowding;
+
+    cout << "popSize=" << popSize << " repetitions=" << repetitions << endl;
+    cout << "time per fitness assignment (ms)" << endl;
+    cout << setw(8) << "problem" << setw(6) << "M" << setw(8) << "fronts"
+         << setw(12) << "default" << setw(12) << "fast" << setw(12) << "fast-omp"
+         << setw(12) << "ens-bs" << setw(12) << "dc" << setw(12) << "crowding" << endl;
+
+    unsigned problems[] = {1, 2};
+    unsigned objectives[] = {3, 5, 8};
+    for(unsigned problem : problems)
+    {
+        for(unsigned m : objectives)
+        {
+            vector < bool > bObjectives(m, true);
+            moeoObjectiveVectorTraits::setup(m, bObjectives);
+            eoPop < Solution > pop;
+            pop.resize(popSize);
+            rng.reseed(42);
+            dtlz(problem, m, pop);
+
+            const char* names[] = {"default", "fast", "fast-omp", "ens-bs", "dc"};
+            moeoDominanceDepthFitnessAssignment < Solution >* assignments[] =
+                {&defaultAssignment, &fastAssignment, &parallelAssignment, &ensAssignment, &dcAssignment};
+            double times[6];
+            for(unsigned a = 0; a < 5; a++)
+                times[a] = timeIt(*assignments[a], pop, repetitions);
+            double fronts = pop.best_element().fitness() + 1;
+            times[5] = timeIt(crowding, pop, repetitions);
+
+            string name = "DTLZ" + to_string(problem);
+            cout << setw(8) << name << setw(6) << m << setw(8) << fronts;
+            for(unsigned a = 0; a < 6; a++)
+            {
+                cout << setw(12) << times[a];
+                report.record(a < 5 ? names[a] : "crowding").param("problem", name).param("M", m).param("size", popSize)
+                    .value("time", times[a], "ms");
+            }
+            cout << endl;
+        }
+    }
+
+    return 0;
+}
@@ -45,6 +45,7 @@
 #include <eoPopEvalFunc.h>
 #include <eoSelect.h>
 #include <eoTransform.h>
+#include <utils/eoProfiler.h>
 #include <algo/moeoEA.h>
 #include <diversity/moeoDiversityAssignment.h>
 #include <diversity/moeoDummyDiversityAssignment.h>
@@ -128,8 +129,13 @@ public:
     virtual void operator()(eoPop < MOEOT > & _pop)
     {
         eoPop < MOEOT > offspring, empty_pop;
-        popEval(empty_pop, _pop); // A first eval of pop.
+        {
+            EO_PROFILE_SCOPE("evaluate");
+            EO_PROFILE_COUNT("evaluations", eoProfileInvalid(_pop));
+            popEval(empty_pop, _pop); // A first eval of pop.
+        }
         bool firstTime = true;
+        bool cont;
         do
         {
             // try
@@ -140,14 +146,30 @@ public:
                 if (evalFitAndDivBeforeSelection || firstTime)
                 {
                     firstTime = false;
-                    //std::cout << "fitness eval" << std::endl;
-                    fitnessEval(_pop);
-                    //std::cout << "diversity eval" << std::endl;
-                    diversityEval(_pop);
+                    {
+                        EO_PROFILE_SCOPE("fitness assignment");
+                        //std::cout << "fitness eval" << std::endl;
+                        fitnessEval(_pop);
+                    }
+                    {
+                        EO_PROFILE_SCOPE("diversity assignment");
+                        //std::cout << "diversity eval" << std::endl;
+                        diversityEval(_pop);
+                    }
+                }
+                {
+                    EO_PROFILE_SCOPE("breed");
+                    breed(_pop, offspring);
+                }
+                {
+                    EO_PROFILE_SCOPE("evaluate");
+                    EO_PROFILE_COUNT("evaluations", eoProfileInvalid(offspring));
+                    popEval(_pop, offspring); // eval of parents + offspring if necessary
+                }
+                {
+                    EO_PROFILE_SCOPE("replace");
+                    replace(_pop, offspring); // after replace, the new pop. is in _pop
                 }
-                breed(_pop, offspring);
-                popEval(_pop, offspring); // eval of parents + offspring if necessary
-                replace(_pop, offspring); // after replace, the new pop. is in _pop
                 if (pSize > _pop.size())
                 {
                     throw eoPopSizeChangeException(_pop.size(), pSize,"Population shrinking!");
@@ -163,8 +185,11 @@ public:
             //     s.append( " in moeoEasyEA");
             //     throw std::runtime_error( s );
             // }
+
+            EO_PROFILE_SCOPE("checkpoint");
+            cont = continuator(_pop);
         }
-        while (continuator(_pop));
+        while (cont);
     }
 
 
@@ -38,6 +38,7 @@
 #ifndef MOEOARCHIVE_H_
 #define MOEOARCHIVE_H_
 
+#include <utility>
 #include <eoPop.h>
 #include <comparator/moeoObjectiveVectorComparator.h>
 #include <comparator/moeoParetoObjectiveVectorComparator.h>
@@ -86,7 +87,7 @@ public:
      * Returns true if the current archive dominates _objectiveVector according to the moeoObjectiveVectorComparator given in the constructor
      * @param _objectiveVector the objective vector to compare with the current archive
      */
-    bool dominates (const ObjectiveVector & _objectiveVector) const
+    virtual bool dominates (const ObjectiveVector & _objectiveVector) const
     {
         for (unsigned int i = 0; i<size(); i++)
         {
@@ -104,7 +105,7 @@ public:
      * Returns true if the current archive already contains a solution with the same objective values than _objectiveVector
      * @param _objectiveVector the objective vector to compare with the current archive
      */
-    bool contains (const ObjectiveVector & _objectiveVector) const
+    virtual bool contains (const ObjectiveVector & _objectiveVector) const
     {
         for (unsigned int i = 0; i<size(); i++)
         {
@@ -171,12 +172,12 @@ protected:
             // if the jth solution contained in the archive is dominated by _moeo
             if ( comparator(operator[](j).objectiveVector(), _moeo.objectiveVector()) )
             {
-                operator[](j) = back();
+                operator[](j) = std::move(back());
                 pop_back();
             }
             else if (replace && (_moeo.objectiveVector() == operator[](j).objectiveVector()))
             {
-                operator[](j) = back();
+                operator[](j) = std::move(back());
                 pop_back();
             }
             else
@@ -0,0 +1,280 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+// moeoNDTreeArchive.h
+//-----------------------------------------------------------------------------
+
+#ifndef MOEONDTREEARCHIVE_H_
+#define MOEONDTREEARCHIVE_H_
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <eoPop.h>
+#include <archive/moeoArchive.h>
+#include <utils/moeoBiObjectiveTree.h>
+#include <utils/moeoNDTree.h>
+
+/**
+ * An unbounded archive of the solutions which are non-dominated in the Pareto sense, indexed for the dominance queries.
+ * The objective vectors of the solutions are kept in a compact moeoDominanceIndex, apart from the solutions:
+ * a moeoBiObjectiveTree for two objectives, a moeoNDTree otherwise. A candidate is then compared with the
+ * solutions of a few leaves only, instead of all the solutions of the archive, which is what matters
+ * for the archives of the Pareto local searches (moeoPLS1, moeoPLS2, moeoUnifiedDominanceBasedLS, moeoDMLSMonOp).
+ *
+ * The archive is updated exactly as a moeoUnboundedArchive based on Pareto dominance, and its solutions stay
+ * in the same order. It must be modified through operator() only: if its size is changed otherwise, the
+ * index is rebuilt by the next update, which drops the dominated solutions.
+ */
+template < class MOEOT >
+class moeoNDTreeArchive : public moeoArchive < MOEOT >
+{
+public:
+
+    using moeoArchive < MOEOT > :: size;
+    using moeoArchive < MOEOT > :: operator[];
+    using moeoArchive < MOEOT > :: back;
+    using moeoArchive < MOEOT > :: pop_back;
+    using moeoArchive < MOEOT > :: replace;
+
+
+    /**
+     * The type of an objective vector for a solution
+     */
+    typedef typename MOEOT::ObjectiveVector ObjectiveVector;
+
+
+    /**
+     * Ctor
+     * @param _replace boolean which determine if a solution with the same objectiveVector than another one, can replace it or not
+     * @param _maxLeafSize the maximum number of solutions of a leaf of the ND-tree
+     */
+    moeoNDTreeArchive(bool _replace=true, unsigned int _maxLeafSize=20) :
+            moeoArchive < MOEOT >(_replace),
+            ndTree(ObjectiveVector::Traits::tolerance(), _maxLeafSize),
+            biObjectiveTree(ObjectiveVector::Traits::tolerance())
+    {}
+
+
+    /**
+     * Returns true if the current archive dominates _objectiveVector
+     * @param _objectiveVector the objective vector to compare with the current archive
+     */
+    bool dominates (const ObjectiveVector & _objectiveVector) const
+    {
+        if (!indexed())
+        {
+            return moeoArchive < MOEOT >::dominates(_objectiveVector);
+        }
+        convert(_objectiveVector);
+        return index().dominates(&row[0], true);
+    }
+
+
+    /**
+     * Returns true if the current archive already contains a solution with the same objective values than _objectiveVector
+     * @param _objectiveVector the objective vector to compare with the current archive
+     */
+    bool contains (const ObjectiveVector & _objectiveVector) const
+    {
+        if (!indexed())
+        {
+            return moeoArchive < MOEOT >::contains(_objectiveVector);
+        }
+        convert(_objectiveVector);
+        found.clear();
+        index().dominated(&row[0], false, found);
+        for (unsigned int i=0; i<found.size(); i++)
+        {
+            if (index().equal(index()[found[i]], &row[0]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+    /**
+     * Updates the archive with a given individual _moeo
+     * @param _moeo the given individual
+     * @return true if _moeo is added to the archive
+     */
+    bool operator()(const MOEOT & _moeo)
+    {
+        if (!indexed())
+        {
+            reindex();
+        }
+        return update(_moeo);
+    }
+
+
+    /**
+     * Updates the archive with a given population _pop
+     * @param _pop the given population
+     * @return true if a _pop[i] is added to the archive
+     */
+    bool operator()(const eoPop < MOEOT > & _pop)
+    {
+        if (!indexed())
+        {
+            reindex();
+        }
+        bool res = false;
+        for (unsigned int i=0; i<_pop.size(); i++)
+        {
+            res = update(_pop[i]) || res;
+        }
+        return res;
+    }
+
+
+protected:
+
+    /**
+     * Updates the archive with a given individual _moeo, the index being up to date
+     * @param _moeo the given individual
+     * @return true if _moeo is added to the archive
+     */
+    bool update(const MOEOT & _moeo)
+    {
+        convert(_moeo.objectiveVector());
+        // first step: removing the solutions dominated by _moeo (and the equal ones if they are replaced)
+        found.clear();
+        index().dominated(&row[0], !replace, found);
+        std::sort(found.begin(), found.end());
+        erase(found);
+        // second step: is _moeo dominated (or is an equal solution kept)?
+        bool dom = index().dominates(&row[0], false);
+        if (!dom)
+        {
+            this->push_back(_moeo);
+            index().push_back(&row[0]);
+        }
+        return !dom;
+    }
+
+
+    /**
+     * Removes the solutions of the given indexes, in the order of moeoArchive::update:
+     * the archive is scanned once, every removed solution being replaced by the last one
+     * @param _sorted the indexes of the solutions to remove, in increasing order
+     */
+    void erase(const std::vector < unsigned int > & _sorted)
+    {
+        unsigned int lo = 0;
+        unsigned int hi = _sorted.size();
+        while (lo < hi)
+        {
+            unsigned int last = size() - 1;
+            if (_sorted[hi - 1] == last)
+            {
+                // the last solution would be moved then removed
+                index().erase(last);
+                pop_back();
+                hi--;
+            }
+            else
+            {
+                unsigned int j = _sorted[lo];
+                index().erase(j);
+                operator[](j) = std::move(back());
+                pop_back();
+                lo++;
+            }
+        }
+    }
+
+
+    /**
+     * Rebuilds the index from the solutions of the archive
+     */
+    void reindex()
+    {
+        eoPop < MOEOT > solutions;
+        solutions.swap(*this);
+        index().clear(ObjectiveVector::nObjectives());
+        for (unsigned int i=0; i<solutions.size(); i++)
+        {
+            update(solutions[i]);
+        }
+    }
+
+
+    /**
+     * Returns true if the index holds the objective vectors of the archive
+     */
+    bool indexed() const
+    {
+        return index().nObjectives() == ObjectiveVector::nObjectives() && index().size() == size();
+    }
+
+
+    /**
+     * Returns the index used for the current number of objectives
+     */
+    moeoDominanceIndex & index()
+    {
+        if (ObjectiveVector::nObjectives() == 2)
+        {
+            return biObjectiveTree;
+        }
+        return ndTree;
+    }
+
+
+    /**
+     * Returns the index used for the current number of objectives
+     */
+    const moeoDominanceIndex & index() const
+    {
+        if (ObjectiveVector::nObjectives() == 2)
+        {
+            return biObjectiveTree;
+        }
+        return ndTree;
+    }
+
+
+    /**
+     * Copies the values of _objectiveVector in row, every objective being minimized
+     * @param _objectiveVector the objective vector
+     */
+    void convert(const ObjectiveVector & _objectiveVector) const
+    {
+        unsigned int m = ObjectiveVector::nObjectives();
+        row.resize(m);
+        for (unsigned int j=0; j<m; j++)
+        {
+            row[j] = ObjectiveVector::minimizing(j) ? _objectiveVector[j] : - _objectiveVector[j];
+        }
+    }
+
+
+    /** the index for more than two objectives */
+    moeoNDTree ndTree;
+    /** the index for two objectives */
+    moeoBiObjectiveTree biObjectiveTree;
+    /** the values of the objective vector being compared */
+    mutable std::vector < double > row;
+    /** the indexes found by the queries */
+    mutable std::vector < unsigned int > found;
+
+};
+
+#endif /*MOEONDTREEARCHIVE_H_*/
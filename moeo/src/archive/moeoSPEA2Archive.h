@@ -50,6 +50,7 @@
 #include <comparator/moeoObjectiveVectorComparator.h>
 #include <distance/moeoDistance.h>
 #include <distance/moeoEuclideanDistance.h>
+#include <utils/moeoNearestNeighborTruncation.h>
 
 /**
  * This class represents a bounded archive as defined in the SPEA2 algorithm.
@@ -81,7 +82,7 @@ public:
      * Default ctor.
      * @param _maxSize the size of archive (must be smaller or equal to the population size)
      */
-    moeoSPEA2Archive(unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(true), maxSize(_maxSize), borne(0), indiComparator(defaultComparator), distance(defaultDistance)
+    moeoSPEA2Archive(unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(true), maxSize(_maxSize), borne(0), indiComparator(defaultComparator), distance(defaultDistance), truncation(distance)
     {}
 
 
@@ -90,7 +91,7 @@ public:
      * @param _dist the distance used
      * @param _maxSize the size of archive (must be smaller or egal to the population size)
      */
-    moeoSPEA2Archive(moeoDistance <MOEOT, double>& _dist, unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(true), maxSize(_maxSize), borne(0), indiComparator(defaultComparator), distance(_dist)
+    moeoSPEA2Archive(moeoDistance <MOEOT, double>& _dist, unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(true), maxSize(_maxSize), borne(0), indiComparator(defaultComparator), distance(_dist), truncation(distance)
     {}
 
 
@@ -99,7 +100,7 @@ public:
      * @param _comparator the functor used to compare objective vectors
      * @param _maxSize the size of archive (must be smaller or egal to the population size)
      */
-    moeoSPEA2Archive(moeoObjectiveVectorComparator < ObjectiveVector > & _comparator, unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(_comparator, true), maxSize(_maxSize), borne(0), indiComparator(defaultComparator), distance(defaultDistance)
+    moeoSPEA2Archive(moeoObjectiveVectorComparator < ObjectiveVector > & _comparator, unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(_comparator, true), maxSize(_maxSize), borne(0), indiComparator(defaultComparator), distance(defaultDistance), truncation(distance)
     {}
 
 
@@ -108,7 +109,7 @@ public:
      * @param _indiComparator the functor used to compare MOEOT
      * @param _maxSize the size of archive (must be smaller or egal to the population size)
      */
-    moeoSPEA2Archive(moeoComparator <MOEOT>& _indiComparator, unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(true), maxSize(_maxSize), borne(0), indiComparator(_indiComparator), distance(defaultDistance)
+    moeoSPEA2Archive(moeoComparator <MOEOT>& _indiComparator, unsigned int _maxSize=100): moeoFixedSizeArchive < MOEOT >(true), maxSize(_maxSize), borne(0), indiComparator(_indiComparator), distance(defaultDistance), truncation(distance)
     {}
 
 
@@ -119,7 +120,7 @@ public:
      * @param _comparator the functor used to compare objective vectors
      * @param _maxSize the size of archive (must be smaller or egal to the population size)
      */
-    moeoSPEA2Archive(moeoComparator <MOEOT>& _indiComparator, moeoDistance <MOEOT, double>& _dist, moeoObjectiveVectorComparator < ObjectiveVector > & _comparator, unsigned int _maxSize=100) : moeoFixedSizeArchive < MOEOT >(_comparator, true), maxSize(_maxSize), borne(0), indiComparator(_indiComparator), distance(_dist)
+    moeoSPEA2Archive(moeoComparator <MOEOT>& _indiComparator, moeoDistance <MOEOT, double>& _dist, moeoObjectiveVectorComparator < ObjectiveVector > & _comparator, unsigned int _maxSize=100) : moeoFixedSizeArchive < MOEOT >(_comparator, true), maxSize(_maxSize), borne(0), indiComparator(_indiComparator), distance(_dist), truncation(distance)
     {}
 
 
@@ -188,14 +189,11 @@ public:
             }
 
             //If their are others goods elements in pop (fitness=0) , keep only archive's size elements between the archive's elements and the good element in the pop (k ieme smallest distance is used)
-            if (copy_pop[j].fitness > -1)
+            if ( (j < copy_pop.size()) && (copy_pop[j].fitness > -1) )
             {
                 unsigned int inf=j;
                 unsigned int p;
                 unsigned int k=0;
-                unsigned int l=0;
-                double tmp=0;
-                unsigned int tmp2=0;
 
                 //search bounds of copy_pop where are the goods elements
                 while ((j < copy_pop.size()) && (copy_pop[j].fitness > -1.0))
@@ -203,78 +201,39 @@ public:
 
                 p=j-inf;
 
-                std::vector< std::vector< std::pair<int,double> > > matrice(borne+p);
-
-                //Build the distance matrice(vector of vector) between each keeped elements
-                if (borne+p>0)
-                {
-                    for (k=0; k<borne+p-1; k++)
-                    {
-                        for (l=k+1; l<borne+p; l++)
-                        {
-                            if ( (k<borne) && (l<borne) )
-                                tmp=distance(operator[](k), operator[](l));
-                            else if ( (k<borne) && (l>=borne) )
-                                tmp=distance(operator[](k), _pop[copy_pop[l-borne+inf].index]);
-                            else
-                                tmp=distance(_pop[copy_pop[k-borne+inf].index], _pop[copy_pop[l-borne+inf].index]);
-
-                            matrice[k].push_back(std::pair<int,double>(l,tmp));
-                            matrice[l].push_back(std::pair<int,double>(k,tmp));
-                        }
-                    }
-                }
-
-                for (k=0; k<borne+p; k++)
-                {
-                    //sort each line of the matrice
-                    std::sort(matrice[k].begin(),matrice[k].end(), CmpPair());
-
-                    //insert an indice at the end of each line after they were be sorted
-                    matrice[k].push_back(std::pair<int,double>(-1,k));
-                }
+                //the archive's elements, then the goods elements of the pop
+                std::vector< const MOEOT * > points(borne+p);
+                for (k=0; k<borne; k++)
+                    points[k] = &operator[](k);
+                for (k=0; k<p; k++)
+                    points[borne+k] = &_pop[copy_pop[inf+k].index];
 
-                //sort the lines of the matrice between us (by shortest distance)
-                std::sort(matrice.begin(),matrice.end(), CmpVector());
+                //search the p elements to delete
+                std::vector<unsigned int> removed;
+                truncation(points, p, removed);
 
-                //vectors and iterators used to replace some archive element by some pop element
+                //vectors used to replace some archive element by some pop element
                 std::vector<unsigned int> notkeeped;
                 std::vector<unsigned int> keeped;
-                std::vector< std::vector< std::pair<int,double> > >::iterator matrice_it=matrice.begin();
-                std::vector< std::pair<int,double> >::iterator it;
-
-                //search elements of the archive to delete
-                for (k=0; k<p; k++)
+                std::vector<bool> alive(borne+p, true);
+                for (k=0; k<removed.size(); k++)
                 {
-                    tmp2=(unsigned int)matrice[0].back().second;
-                    if (tmp2<borne)
-                        notkeeped.push_back(tmp2);
-                    matrice.erase(matrice_it);
-                    for (l=0; l<matrice.size(); l++)
-                    {
-                        it=matrice[l].begin();
-                        while ((unsigned int)(*it).first != tmp2)
-                            it++;
-                        matrice[l].erase(it);
-                    }
-                    if (k != (p-1))
-                        std::sort(matrice.begin(),matrice.end(), CmpVector());
+                    alive[removed[k]] = false;
+                    if (removed[k] < borne)
+                        notkeeped.push_back(removed[k]);
                 }
 
                 //search elements of pop to put in archive
-                for (k=0; k<borne; k++)
+                for (k=borne; k<borne+p; k++)
                 {
-                    tmp2=(unsigned int)matrice[k].back().second;
-                    if (tmp2 >= borne)
-                        keeped.push_back(tmp2);
+                    if (alive[k])
+                        keeped.push_back(k);
                 }
 
                 //replace some archive element by some pop element
                 for (k=0; k<keeped.size(); k++)
                 {
-                    push_back( _pop[ copy_pop[keeped[k]-borne+inf].index ] );
-                    operator[](notkeeped[k]) = back();
-                    pop_back();
+                    operator[](notkeeped[k]) = _pop[ copy_pop[keeped[k]-borne+inf].index ];
                 }
             }
         }
@@ -320,6 +279,8 @@ private:
     moeoDistance <MOEOT, double>& distance;
     /** default distance */
     moeoEuclideanDistance < MOEOT > defaultDistance;
+    /** truncation procedure */
+    moeoNearestNeighborTruncation < MOEOT > truncation;
 
 
     /**
@@ -345,42 +306,6 @@ private:
     };
 
 
-    /**
-     * Comparator of two vector of pair
-     * Compare the second pair's value of the first element vector, if equals compare the next element vector...
-     */
-    struct CmpVector
-    {
-        bool operator()( const std::vector< std::pair<int,double> >& _a, const std::vector< std::pair<int,double> >& _b)
-        {
-            std::vector< std::pair<int,double> >::const_iterator it1= _a.begin();
-            std::vector< std::pair<int,double> >::const_iterator it2= _b.begin();
-            while ( (it1 != _a.end()) && (it2 != _b.end()))
-            {
-                if ((*it1).second < (*it2).second)
-                    return true;
-                else if ((*it1).second > (*it2).second)
-                    return false;
-                it1++;
-                it2++;
-            }
-            return false;
-        }
-    };
-
-
-    /**
-       * Comparator of two pair : compare the second pair's value
-       */
-    struct CmpPair
-    {
-        bool operator()(const std::pair<int,double>& _a, const std::pair<int,double>& _b)
-        {
-            return _a.second < _b.second;
-        }
-    };
-
-
 };
 
 #endif /*MOEOSPEA2ARCHIVE_H_*/
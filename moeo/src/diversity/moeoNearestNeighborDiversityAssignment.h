@@ -40,7 +40,8 @@
 #ifndef MOEONEARESTNEIGHBORDIVERSITYASSIGNMENT_H_
 #define MOEONEARESTNEIGHBORDIVERSITYASSIGNMENT_H_
 
-#include <list>
+#include <algorithm>
+#include <vector>
 #include <diversity/moeoDiversityAssignment.h>
 #include <archive/moeoUnboundedArchive.h>
 #include <archive/moeoArchive.h>
@@ -109,7 +110,13 @@ public:
         unsigned int i = _pop.size();
         unsigned int j = archive.size();
         double tmp=0;
-        std::vector< std::list<double> > matrice(i+j);
+        // the index smallest distances of every element, in a max-heap
+        std::vector< std::vector<double> > nearest(i+j);
+        for (unsigned int k=0; k<i+j; k++)
+        {
+            nearest[k].clear();
+            nearest[k].reserve(index);
+        }
         if (i+j>0)
         {
             for (unsigned k=0; k<i+j-1; k++)
@@ -122,17 +129,15 @@ public:
                         tmp=distance(_pop[k], archive[l-i]);
                     else
                         tmp=distance(archive[k-i], archive[l-i]);
-                    matrice[k].push_back(tmp);
-                    matrice[l].push_back(tmp);
+                    push(nearest[k], tmp);
+                    push(nearest[l], tmp);
                 }
             }
         }
-        for (unsigned int k=0; k<i+j; k++)
-            matrice[k].sort();
         for (unsigned int k=0; k<i; k++)
-            _pop[k].diversity(-1 * 1/(2+getElement(matrice[k])));
+            _pop[k].diversity(-1 * 1/(2+getElement(nearest[k])));
         for (unsigned int k=i; k<i+j; k++)
-            archive[k-i].diversity(-1 * 1/(2+getElement(matrice[k])));
+            archive[k-i].diversity(-1 * 1/(2+getElement(nearest[k])));
     }
 
 
@@ -164,15 +169,33 @@ private:
 
 
     /**
-     * Return the index-th element of the list _myList
-     * @param _myList the list which contains distances
+     * Inserts _dist in the max-heap _heap if it contains less than index distances or a greater one
+     * @param _heap the heap
+     * @param _dist the distance
+     */
+    void push(std::vector<double> & _heap, double _dist)
+    {
+        if (_heap.size() < std::max(index, 1u))
+        {
+            _heap.push_back(_dist);
+            std::push_heap(_heap.begin(), _heap.end());
+        }
+        else if (_dist < _heap.front())
+        {
+            std::pop_heap(_heap.begin(), _heap.end());
+            _heap.back() = _dist;
+            std::push_heap(_heap.begin(), _heap.end());
+        }
+    }
+
+
+    /**
+     * Return the index-th smallest distance (or the greatest one if there are less than index distances)
+     * @param _heap the max-heap of the index smallest distances
      */
-    double getElement(std::list<double> _myList)
+    double getElement(const std::vector<double> & _heap)
     {
-        std::list<double>::iterator it= _myList.begin();
-        for (unsigned int i=1; i< std::min((unsigned int)_myList.size(),index); i++)
-            it++;
-        return *it;
+        return _heap.empty() ? 0 : _heap.front();
     }
 
 };
@@ -45,6 +45,8 @@
 #include <comparator/moeoParetoObjectiveVectorComparator.h>
 #include <fitness/moeoDominanceBasedFitnessAssignment.h>
 #include <comparator/moeoPtrComparator.h>
+#include <utils/moeoNondominatedSorting.h>
+#include <utils/moeoObjectiveMatrix.h>
 
 /**
  * Fitness assignment sheme based on Pareto-dominance count proposed in:
@@ -52,6 +54,7 @@
  * and in:
  * K. Deb, A. Pratap, S. Agarwal, T. Meyarivan, "A Fast and Elitist Multi-Objective Genetic Algorithm: NSGA-II", IEEE Transactions on Evolutionary Computation, vol. 6, no. 2 (2002).
  * This strategy is, for instance, used in NSGA and NSGA-II.
+ * With more than two objectives, the fronts are computed in O(n²) by default, or by any moeoNondominatedSorting algorithm given at construction.
  */
 template < class MOEOT >
 class moeoDominanceDepthFitnessAssignment : public moeoDominanceBasedFitnessAssignment < MOEOT >
@@ -65,7 +68,17 @@ public:
     /**
      * Default ctor
      */
-    moeoDominanceDepthFitnessAssignment(bool _rm_equiv_flag_in_2D = false) : comparator(paretoComparator), rm_equiv_flag_in_2D(_rm_equiv_flag_in_2D)
+    moeoDominanceDepthFitnessAssignment(bool _rm_equiv_flag_in_2D = false) : comparator(paretoComparator), rm_equiv_flag_in_2D(_rm_equiv_flag_in_2D), sorting(NULL)
+    {}
+    
+    
+    /**
+     * Ctor where you can choose the algorithm sorting the solutions into fronts when there are more than two objectives
+     * The Pareto dominance relation is used, the objective values being compared exactly.
+     * @param _sorting the non-dominated sorting algorithm (NULL for the default one)
+     * @param _rm_equiv_flag_in_2D flag to remove equivalent solutions in the bi-objective case
+     */
+    moeoDominanceDepthFitnessAssignment(moeoNondominatedSorting * _sorting, bool _rm_equiv_flag_in_2D = false) : comparator(paretoComparator), rm_equiv_flag_in_2D(_rm_equiv_flag_in_2D), sorting(_sorting)
     {}
     
     
@@ -73,7 +86,7 @@ public:
      * Ctor where you can choose your own way to compare objective vectors
      * @param _comparator the functor used to compare objective vectors
      */
-    moeoDominanceDepthFitnessAssignment(moeoObjectiveVectorComparator < ObjectiveVector > & _comparator, bool _rm_equiv_flag_in_2D = true) : comparator(_comparator), rm_equiv_flag_in_2D(_rm_equiv_flag_in_2D)
+    moeoDominanceDepthFitnessAssignment(moeoObjectiveVectorComparator < ObjectiveVector > & _comparator, bool _rm_equiv_flag_in_2D = true) : comparator(_comparator), rm_equiv_flag_in_2D(_rm_equiv_flag_in_2D), sorting(NULL)
     {}
     
     
@@ -95,6 +108,11 @@ public:
             // two objectives
             twoObjectives(_pop);
         }
+        else if ((nObjectives > 2) && sorting)
+        {
+            // more than two objectives, with the given sorting algorithm
+            sortedObjectives(_pop);
+        }
         else if (nObjectives > 2)
         {
             // more than two objectives
@@ -144,6 +162,12 @@ private:
     moeoParetoObjectiveVectorComparator < ObjectiveVector > paretoComparator;
     /** flag to remove equivament solutions */
     bool rm_equiv_flag_in_2D;
+    /** the non-dominated sorting algorithm used with more than two objectives (NULL for mObjectives) */
+    moeoNondominatedSorting * sorting;
+    /** the objective vectors given to the sorting algorithm */
+    moeoObjectiveMatrix objectives;
+    /** the fronts computed by the sorting algorithm */
+    std::vector < unsigned int > ranks;
     /** Functor allowing to compare two solutions according to their first objective value, then their second, and so on. */
     class ObjectiveComparator : public moeoComparator < MOEOT >
     {
@@ -276,6 +300,21 @@ private:
     }
     
     
+    /**
+     * Sets the fitness values by using the non-dominated sorting algorithm
+     * @param _pop the population
+     */
+    void sortedObjectives (eoPop < MOEOT > & _pop)
+    {
+        objectives.fill(_pop);
+        (*sorting)(objectives, ranks);
+        for (unsigned int i=0; i<_pop.size(); i++)
+        {
+            _pop[i].fitness(ranks[i] + 1);
+        }
+    }
+    
+    
     /**
      * Sets the fitness values for problems with more than two objectives with a complexity of O(n² log n), where n stands for the population size
      * @param _pop the population
@@ -40,8 +40,6 @@ public:
     typedef typename ObjectiveVector::Type Type;
     typedef typename MOEOT::Fitness Fitness;
 
-    using moeoExpBinaryIndicatorBasedFitnessAssignment<MOEOT>::values;
-
     moeoExpBinaryIndicatorBasedDualFitnessAssignment(
             moeoNormalizedSolutionVsSolutionBinaryMetric<ObjectiveVector,double> & metric,
             const double kappa = 0.05
@@ -87,6 +85,9 @@ protected:
     using moeoExpBinaryIndicatorBasedFitnessAssignment<MOEOT>::kappa;
     using moeoExpBinaryIndicatorBasedFitnessAssignment<MOEOT>::metric;
 
+    /** the computed indicator values, with the feasibility of the individuals */
+    std::vector < std::vector<Type> > values;
+
 
     /**
      * Sets the bounds for every objective using the min and the max value for every objective vector of _pop
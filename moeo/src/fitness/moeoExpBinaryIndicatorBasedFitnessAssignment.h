@@ -44,6 +44,7 @@
 #define MOEOEXPBINARYINDICATORBASEDFITNESSASSIGNMENT_H_
 
 #include <math.h>
+#include <algorithm>
 #include <vector>
 #include <eoPop.h>
 #include <fitness/moeoBinaryIndicatorBasedFitnessAssignment.h>
@@ -70,19 +71,9 @@ public:
      * Ctor.
      * @param _metric the quality indicator
      * @param _kappa the scaling factor
+     * @param _parallel true to compute the indicator values in parallel (requires OpenMP)
      */
-    moeoExpBinaryIndicatorBasedFitnessAssignment(moeoNormalizedSolutionVsSolutionBinaryMetric < ObjectiveVector, double > & _metric, const double _kappa = 0.05) : metric(_metric), kappa(_kappa), values(0) {}
-    
-    
-    /**
-     * Dtor.
-     */
-    ~moeoExpBinaryIndicatorBasedFitnessAssignment()
-    {
-        // clear "values"
-        for (unsigned int i=0; i<values.size(); i++) values[i].clear();
-        values.clear();
-    }
+    moeoExpBinaryIndicatorBasedFitnessAssignment(moeoNormalizedSolutionVsSolutionBinaryMetric < ObjectiveVector, double > & _metric, const double _kappa = 0.05, bool _parallel = false) : metric(_metric), kappa(_kappa), parallel(_parallel), size(0) {}
     
     
     /**
@@ -153,6 +144,58 @@ public:
         v.clear();
         return result;
     }
+
+
+    /**
+     * Removes the worst individuals of _pop one by one until it contains _size individuals, updating the fitness values
+     * after each deletion, as the moeoEnvironmentalReplacement does with updateByDeleting. The indicator values are
+     * read from the matrix computed by the last call of operator(), which must have been applied to _pop, so that
+     * they are not computed again for every deletion. As every remaining fitness value changes with each deletion,
+     * the worst individual is found by a scan fused with the update, a priority queue would not save anything.
+     * @param _pop the population
+     * @param _size the number of individuals to keep
+     */
+    void reduce(eoPop < MOEOT > & _pop, unsigned int _size)
+    {
+        // index[i] = row of the matrix of the individual _pop[i]
+        std::vector < unsigned int > index(_pop.size());
+        std::vector < Fitness > fit(_pop.size());
+        unsigned int worst = 0;
+        for (unsigned int i=0; i<_pop.size(); i++)
+        {
+            index[i] = i;
+            fit[i] = _pop[i].fitness();
+            if (fit[i] < fit[worst])
+            {
+                worst = i;
+            }
+        }
+        while (_pop.size() > _size)
+        {
+            const double * row = &values[(size_t) index[worst] * size];
+            // remove the worst individual
+            _pop[worst] = _pop.back();
+            _pop.pop_back();
+            index[worst] = index.back();
+            index.pop_back();
+            fit[worst] = fit.back();
+            fit.pop_back();
+            // update of the fitness values, and search of the next worst individual
+            worst = 0;
+            for (unsigned int i=0; i<_pop.size(); i++)
+            {
+                fit[i] = fit[i] + row[index[i]];
+                if (fit[i] < fit[worst])
+                {
+                    worst = i;
+                }
+            }
+        }
+        for (unsigned int i=0; i<_pop.size(); i++)
+        {
+            _pop[i].fitness(fit[i]);
+        }
+    }
     
     
 protected:
@@ -161,8 +204,16 @@ protected:
     moeoNormalizedSolutionVsSolutionBinaryMetric < ObjectiveVector, double > & metric;
     /** the scaling factor */
     double kappa;
-    /** the computed indicator values */
-    std::vector < std::vector<Type> > values;
+    /** true to compute the indicator values in parallel */
+    bool parallel;
+    /** number of columns summed by a thread at once */
+    static const int BLOCK = 256;
+    /** the computed indicator values, row by row (values[i*size+j] = I(_pop[i], _pop[j])), replaced by exp(-I/kappa) once the fitnesses are set */
+    std::vector < double > values;
+    /** the size of the population of the matrix */
+    unsigned int size;
+    /** the objective vectors of the population */
+    std::vector < ObjectiveVector > objectives;
     
     
     /**
@@ -188,44 +239,65 @@ protected:
     
     
     /**
-     * Compute every indicator value in values (values[i] = I(_v[i], _o))
+     * Compute every indicator value in values (values[i*size+j] = I(_pop[i], _pop[j]))
      * @param _pop the population
      */
     virtual void computeValues(const eoPop < MOEOT > & _pop)
     {
-        // initialize the values structure (if it is used for the first time with such a population size)
-        if (values.size() < _pop.size())
-        {
-            values.resize(_pop.size());
-            for (unsigned int i=0; i<values.size(); i++)
-            {
-                values[i].resize(_pop.size());
-            }
-        }
-        // go
-        for (unsigned int i=0; i<_pop.size(); i++)
+        size = _pop.size();
+        objectives.resize(size);
+        for (unsigned int i=0; i<size; i++)
         {
-            // the metric may not be symetric, thus neither is the matrix
-            for (unsigned int j=0; j<_pop.size(); j++)
-            {
-                if (i != j)
-                {
-                    values[i][j] = Type( metric(_pop[i].objectiveVector(), _pop[j].objectiveVector()) );
-                }
-            }
+            objectives[i] = _pop[i].objectiveVector();
         }
+        // the metric may not be symetric, thus neither is the matrix
+        metric.matrix(objectives, values, parallel);
     }
     
     
     /**
-     * Sets the fitness value of the whole population
+     * Sets the fitness value of the whole population. The indicator values are replaced by the contributions
+     * exp(-I/kappa), which are reused by reduce, and the fitness values are accumulated row after row, in the same
+     * order as computeFitness does.
      * @param _pop the population
      */
     virtual void setFitnesses(eoPop < MOEOT > & _pop)
     {
-        for (unsigned int i=0; i<_pop.size(); i++)
+        const int n = size;
+#ifdef _OPENMP
+        #pragma omp parallel for if(parallel) schedule(static)
+#endif
+        for (int i=0; i<n; i++)
+        {
+            double * row = &values[(size_t) i * n];
+            for (int j=0; j<n; j++)
+            {
+                row[j] = (i != j) ? exp(-row[j]/kappa) : 0.0;
+            }
+        }
+        // every column is summed by a single thread
+        std::vector < Fitness > fit(n, Fitness(0.0));
+#ifdef _OPENMP
+        #pragma omp parallel for if(parallel) schedule(static)
+#endif
+        for (int begin=0; begin<n; begin+=BLOCK)
+        {
+            const int end = std::min(begin + BLOCK, n);
+            for (int i=0; i<n; i++)
+            {
+                const double * row = &values[(size_t) i * n];
+                for (int j=begin; j<end; j++)
+                {
+                    if (i != j)
+                    {
+                        fit[j] -= row[j];
+                    }
+                }
+            }
+        }
+        for (int i=0; i<n; i++)
         {
-            _pop[i].fitness(computeFitness(_pop, i));
+            _pop[i].fitness(fit[i]);
         }
     }
     
@@ -242,7 +314,7 @@ protected:
         {
             if (i != _idx)
             {
-                result -= exp(-values[i][_idx]/kappa);
+                result -= values[(size_t) i * size + _idx];
             }
         }
         return result;
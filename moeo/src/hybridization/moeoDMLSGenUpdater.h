@@ -42,7 +42,7 @@
 #include <eoGenContinue.h>
 #include <eoEvalFunc.h>
 #include <archive/moeoArchive.h>
-#include <archive/moeoUnboundedArchive.h>
+#include <archive/moeoNDTreeArchive.h>
 #include <explorer/moeoPopNeighborhoodExplorer.h>
 #include <selection/moeoUnvisitedSelect.h>
 #include <algo/moeoUnifiedDominanceBasedLS.h>
@@ -135,7 +135,7 @@ private:
 	/** dmls archive */
 	moeoArchive < MOEOT > & dmlsArchive;
 	/** default archive used for the dmls */
-	moeoUnboundedArchive < MOEOT > defaultArchive;
+	moeoNDTreeArchive < MOEOT > defaultArchive;
 	/** the dmls */
 	moeoUnifiedDominanceBasedLS <Neighbor> dmls;
 	/** the global archive */
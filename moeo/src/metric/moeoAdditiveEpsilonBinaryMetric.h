@@ -38,6 +38,8 @@
 #ifndef MOEOADDITIVEEPSILONBINARYMETRIC_H_
 #define MOEOADDITIVEEPSILONBINARYMETRIC_H_
 
+#include <algorithm>
+#include <vector>
 #include <metric/moeoNormalizedSolutionVsSolutionBinaryMetric.h>
 
 /**
@@ -73,10 +75,76 @@ class moeoAdditiveEpsilonBinaryMetric : public moeoNormalizedSolutionVsSolutionB
     }
 
 
+    /**
+     * Computes the indicator values of every pair of objective vectors: _values[i*n+j] = I(_objectives[i], _objectives[j]).
+     * The normalized values are stored objective by objective, so that the rows are computed block by block
+     * with contiguous loops which can be vectorized.
+     * @warning don't forget to set the bounds for every objective before the call of this function
+     * @param _objectives the objective vectors
+     * @param _values the indicator values, row by row
+     * @param _parallel true to compute the rows in parallel (requires OpenMP)
+     */
+    void matrix(const std::vector < ObjectiveVector > & _objectives, std::vector < double > & _values, bool _parallel = false)
+    {
+      const int n = _objectives.size();
+      const unsigned int m = ObjectiveVector::Traits::nObjectives();
+      _values.resize((size_t) n * n);
+      // normalized values, negated for the objectives to maximize: epsilon(i, j, obj) = z[obj][i] - z[obj][j]
+      normalized.resize((size_t) m * n);
+      for (unsigned int obj=0; obj<m; obj++)
+        {
+          double * z = &normalized[(size_t) obj * n];
+          for (int j=0; j<n; j++)
+            {
+              z[j] = (_objectives[j][obj] - bounds[obj].minimum()) / bounds[obj].range();
+              if (! ObjectiveVector::Traits::minimizing(obj))
+                {
+                  z[j] = - z[j];
+                }
+            }
+        }
+      // the rows are independent, so that they can be computed in parallel
+#ifdef _OPENMP
+      #pragma omp parallel for if(_parallel) schedule(static)
+#else
+      (void) _parallel;
+#endif
+      for (int i=0; i<n; i++)
+        {
+          double * row = &_values[(size_t) i * n];
+          // a block of the row stays in cache while every objective is considered
+          for (int begin=0; begin<n; begin+=BLOCK)
+            {
+              const int end = std::min(begin + BLOCK, n);
+              const double * z = &normalized[0];
+              double zi = z[i];
+              for (int j=begin; j<end; j++)
+                {
+                  row[j] = zi - z[j];
+                }
+              for (unsigned int obj=1; obj<m; obj++)
+                {
+                  z = &normalized[(size_t) obj * n];
+                  zi = z[i];
+                  for (int j=begin; j<end; j++)
+                    {
+                      double tmp = zi - z[j];
+                      row[j] = (row[j] < tmp) ? tmp : row[j];
+                    }
+                }
+            }
+        }
+    }
+
+
   private:
 
     /** the bounds for every objective */
     using moeoNormalizedSolutionVsSolutionBinaryMetric < ObjectiveVector, double > :: bounds;
+    /** number of objective vectors of a block of a row of the matrix */
+    static const int BLOCK = 1024;
+    /** the normalized values, objective by objective (used by matrix) */
+    std::vector < double > normalized;
 
 
     /**
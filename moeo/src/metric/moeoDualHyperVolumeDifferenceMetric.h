@@ -38,19 +38,20 @@ protected:
     using moeoHyperVolumeDifferenceMetric<ObjectiveVector>::normalize;
     using moeoHyperVolumeDifferenceMetric<ObjectiveVector>::ref_point;
     using moeoHyperVolumeDifferenceMetric<ObjectiveVector>::bounds;
+    using moeoHyperVolumeDifferenceMetric<ObjectiveVector>::hypervolumeAlgorithm;
 
 public:
 
     typedef typename ObjectiveVector::Type Type;
 
-    moeoDualHyperVolumeDifferenceMetric( bool _normalize=true, double _rho=1.1)
-        : moeoHyperVolumeDifferenceMetric<ObjectiveVector>(_normalize, _rho)
+    moeoDualHyperVolumeDifferenceMetric( bool _normalize=true, double _rho=1.1, moeoHypervolumeAlgorithm * _algorithm=NULL)
+        : moeoHyperVolumeDifferenceMetric<ObjectiveVector>(_normalize, _rho, _algorithm)
     {
 
     }
 
-    moeoDualHyperVolumeDifferenceMetric( bool _normalize/*=true*/, ObjectiveVector& _ref_point/*=NULL*/ )
-        : moeoHyperVolumeDifferenceMetric<ObjectiveVector>( _normalize, _ref_point )
+    moeoDualHyperVolumeDifferenceMetric( bool _normalize/*=true*/, ObjectiveVector& _ref_point/*=NULL*/, moeoHypervolumeAlgorithm * _algorithm=NULL )
+        : moeoHyperVolumeDifferenceMetric<ObjectiveVector>( _normalize, _ref_point, _algorithm )
     {
 
     }
@@ -161,7 +162,7 @@ public:
         else if(normalize)
             setup(_set1, _set2);
 
-        moeoHyperVolumeMetric <ObjectiveVector> unaryMetric(ref_point, bounds);
+        moeoHyperVolumeMetric <ObjectiveVector> unaryMetric(ref_point, bounds, hypervolumeAlgorithm());
         hypervolume_set1 = unaryMetric(_set1);
         hypervolume_set2 = unaryMetric(_set2);
 
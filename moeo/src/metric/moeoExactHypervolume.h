@@ -0,0 +1,380 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOEXACTHYPERVOLUME_H_
+#define MOEOEXACTHYPERVOLUME_H_
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <vector>
+#include <metric/moeoHypervolumeAlgorithm.h>
+
+/**
+ * Exact computation of the hypervolume, the algorithm depending on the number of objectives M:
+ * - for M = 2, a sweep over the vectors sorted on the first objective, in O(n log n);
+ * - for M = 3, the sweep of N. Beume, C. M. Fonseca, M. Lopez-Ibanez, L. Paquete, J. Vahrenhold, "On the Complexity of Computing the Hypervolume Indicator", IEEE Transactions on Evolutionary Computation, vol. 13, no. 5 (2009),
+ *   which maintains the two-dimensional front of the vectors already swept, in O(n log n);
+ * - for M >= 4, the WFG algorithm of L. While, L. Bradstreet, L. Barone, "A Fast Way of Calculating Exact Hypervolumes", IEEE Transactions on Evolutionary Computation, vol. 16, no. 1 (2012):
+ *   the hypervolume is the sum of the exclusive contributions of the vectors sorted on their last objective, each one being computed from the non-dominated vectors of its limit set with one objective less.
+ */
+class moeoExactHypervolume : public moeoHypervolumeAlgorithm
+{
+public:
+
+    /**
+     * Returns the hypervolume of _set
+     * @param _set the objective vectors
+     * @param _reference the reference point
+     */
+    double operator()(const moeoObjectiveMatrix & _set, const std::vector < double > & _reference)
+    {
+        const unsigned int m = _reference.size();
+        if (m == 0)
+        {
+            return 0.0;
+        }
+        // one buffer per recursion level of WFG
+        if (points.size() < m)
+        {
+            points.resize(m);
+            orders.resize(m);
+        }
+        // only the vectors dominating the reference point matter
+        std::vector < double > & first = points[0];
+        first.clear();
+        unsigned int n = 0;
+        for (unsigned int i=0; i<_set.size(); i++)
+        {
+            const double * row = _set[i];
+            unsigned int j = 0;
+            while ((j < m) && (row[j] < _reference[j]))
+            {
+                j++;
+            }
+            if (j == m)
+            {
+                first.insert(first.end(), row, row + m);
+                n++;
+            }
+        }
+        return volume(0, n, m, &_reference[0]);
+    }
+
+
+private:
+
+    /** the vectors of each recursion level, row by row */
+    std::vector < std::vector < double > > points;
+    /** the order in which the vectors of each recursion level are swept */
+    std::vector < std::vector < unsigned int > > orders;
+    /** the two-dimensional front of the three-dimensional sweep: first objective -> second objective, the second decreasing with the first */
+    std::map < double, double > stairs;
+
+
+    /** Functor sorting the indexes of the vectors on one objective */
+    class Comparator
+    {
+    public:
+        /**
+         * Ctor
+         * @param _points the vectors, row by row
+         * @param _m the number of objectives
+         * @param _objective the objective to sort on
+         * @param _ascending true for the ascending order
+         */
+        Comparator(const std::vector < double > & _points, unsigned int _m, unsigned int _objective, bool _ascending) : values(&_points[_objective]), m(_m), ascending(_ascending)
+        {}
+        /**
+         * Comparison of the _i-th and _j-th vectors
+         * @param _i the first index
+         * @param _j the second index
+         */
+        bool operator()(unsigned int _i, unsigned int _j) const
+        {
+            return ascending ? (values[_i * m] < values[_j * m]) : (values[_i * m] > values[_j * m]);
+        }
+    private:
+        /** the values of the objective to sort on */
+        const double * values;
+        /** the number of objectives */
+        unsigned int m;
+        /** true for the ascending order */
+        bool ascending;
+    };
+
+
+    /**
+     * Sorts the indexes of the _n vectors of the _level-th recursion level on the objective _objective
+     * @param _level the recursion level
+     * @param _n the number of vectors
+     * @param _m the number of objectives
+     * @param _objective the objective to sort on
+     * @param _ascending true for the ascending order
+     */
+    std::vector < unsigned int > & sort(unsigned int _level, unsigned int _n, unsigned int _m, unsigned int _objective, bool _ascending)
+    {
+        std::vector < unsigned int > & order = orders[_level];
+        order.resize(_n);
+        for (unsigned int i=0; i<_n; i++)
+        {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), Comparator(points[_level], _m, _objective, _ascending));
+        return order;
+    }
+
+
+    /**
+     * Returns the hypervolume of the _n vectors of the _level-th recursion level, all of them dominating the reference point
+     * @param _level the recursion level
+     * @param _n the number of vectors
+     * @param _m the number of objectives
+     * @param _reference the reference point
+     */
+    double volume(unsigned int _level, unsigned int _n, unsigned int _m, const double * _reference)
+    {
+        if (_n == 0)
+        {
+            return 0.0;
+        }
+        const std::vector < double > & set = points[_level];
+        if (_n == 1)
+        {
+            double box = 1.0;
+            for (unsigned int j=0; j<_m; j++)
+            {
+                box *= _reference[j] - set[j];
+            }
+            return box;
+        }
+        if (_m == 1)
+        {
+            return _reference[0] - *std::min_element(set.begin(), set.begin() + _n);
+        }
+        if (_m == 2)
+        {
+            return volume2D(_level, _n, _reference);
+        }
+        if (_m == 3)
+        {
+            return volume3D(_level, _n, _reference);
+        }
+        return wfg(_level, _n, _m, _reference);
+    }
+
+
+    /**
+     * Two-dimensional sweep
+     * @param _level the recursion level
+     * @param _n the number of vectors
+     * @param _reference the reference point
+     */
+    double volume2D(unsigned int _level, unsigned int _n, const double * _reference)
+    {
+        const std::vector < double > & set = points[_level];
+        const std::vector < unsigned int > & order = sort(_level, _n, 2, 0, true);
+        double result = 0.0;
+        double height = _reference[1];
+        for (unsigned int i=0; i<_n; i++)
+        {
+            const double * row = &set[order[i] * 2];
+            if (row[1] < height)
+            {
+                result += (_reference[0] - row[0]) * (height - row[1]);
+                height = row[1];
+            }
+        }
+        return result;
+    }
+
+
+    /**
+     * Three-dimensional sweep on the last objective, the area dominated in the first two objectives being updated at each insertion
+     * @param _level the recursion level
+     * @param _n the number of vectors
+     * @param _reference the reference point
+     */
+    double volume3D(unsigned int _level, unsigned int _n, const double * _reference)
+    {
+        const std::vector < double > & set = points[_level];
+        const std::vector < unsigned int > & order = sort(_level, _n, 3, 2, true);
+        stairs.clear();
+        double result = 0.0;
+        double area = 0.0;
+        for (unsigned int i=0; i<_n; i++)
+        {
+            const double * row = &set[order[i] * 3];
+            area += insert(row[0], row[1], _reference);
+            double next = (i+1 < _n) ? set[order[i+1] * 3 + 2] : _reference[2];
+            result += area * (next - row[2]);
+        }
+        return result;
+    }
+
+
+    /**
+     * Inserts a vector into the two-dimensional front and returns the area it adds
+     * @param _x the value of the first objective
+     * @param _y the value of the second objective
+     * @param _reference the reference point
+     */
+    double insert(double _x, double _y, const double * _reference)
+    {
+        std::map < double, double >::iterator it = stairs.upper_bound(_x);
+        // height of the front at _x
+        double level = _reference[1];
+        if (it != stairs.begin())
+        {
+            std::map < double, double >::iterator previous = std::prev(it);
+            if (previous->second <= _y)
+            {
+                // dominated
+                return 0.0;
+            }
+            level = previous->second;
+            if (previous->first == _x)
+            {
+                stairs.erase(previous);
+            }
+        }
+        // remove the vectors it dominates, adding the area of each step
+        double x = _x;
+        double gain = 0.0;
+        while ((it != stairs.end()) && (it->second >= _y))
+        {
+            gain += (it->first - x) * (level - _y);
+            x = it->first;
+            level = it->second;
+            stairs.erase(it++);
+        }
+        double end = (it != stairs.end()) ? it->first : _reference[0];
+        gain += (end - x) * (level - _y);
+        stairs.insert(it, std::make_pair(_x, _y));
+        return gain;
+    }
+
+
+    /**
+     * WFG algorithm, sweeping the vectors from the worst to the best on the last objective
+     * @param _level the recursion level
+     * @param _n the number of vectors
+     * @param _m the number of objectives
+     * @param _reference the reference point
+     */
+    double wfg(unsigned int _level, unsigned int _n, unsigned int _m, const double * _reference)
+    {
+        const std::vector < double > & set = points[_level];
+        const std::vector < unsigned int > & order = sort(_level, _n, _m, _m-1, false);
+        std::vector < double > & limit = points[_level+1];
+        const unsigned int k = _m - 1;
+        double result = 0.0;
+        for (unsigned int i=0; i<_n; i++)
+        {
+            const double * row = &set[order[i] * _m];
+            double box = 1.0;
+            for (unsigned int j=0; j<k; j++)
+            {
+                box *= _reference[j] - row[j];
+            }
+            // the vectors swept afterwards are better on the last objective,
+            // so that the exclusive contribution is a slice of a (m-1)-dimensional one
+            limit.clear();
+            unsigned int size = 0;
+            for (unsigned int l=i+1; l<_n; l++)
+            {
+                const double * other = &set[order[l] * _m];
+                for (unsigned int j=0; j<k; j++)
+                {
+                    limit.push_back(std::max(row[j], other[j]));
+                }
+                size++;
+            }
+            size = nondominated(limit, size, k);
+            result += (_reference[k] - row[k]) * (box - volume(_level+1, size, k, _reference));
+        }
+        return result;
+    }
+
+
+    /**
+     * Keeps the non-dominated vectors of _set only, at its beginning, and returns their number
+     * (a vector equal to a previous one is removed)
+     * @param _set the vectors, row by row
+     * @param _n the number of vectors
+     * @param _m the number of objectives
+     */
+    unsigned int nondominated(std::vector < double > & _set, unsigned int _n, unsigned int _m)
+    {
+        unsigned int kept = 0;
+        for (unsigned int i=0; i<_n; i++)
+        {
+            const double * row = &_set[i * _m];
+            bool dominated = false;
+            for (unsigned int j=0; (j<kept) && (! dominated); j++)
+            {
+                dominated = weaklyDominates(&_set[j * _m], row, _m);
+            }
+            if (dominated)
+            {
+                continue;
+            }
+            // remove the kept vectors it dominates
+            unsigned int last = 0;
+            for (unsigned int j=0; j<kept; j++)
+            {
+                if (! weaklyDominates(row, &_set[j * _m], _m))
+                {
+                    if (last != j)
+                    {
+                        std::copy(&_set[j * _m], &_set[j * _m] + _m, &_set[last * _m]);
+                    }
+                    last++;
+                }
+            }
+            if (last != i)
+            {
+                std::copy(row, row + _m, &_set[last * _m]);
+            }
+            kept = last + 1;
+        }
+        return kept;
+    }
+
+
+    /**
+     * Returns true if _a is lower than or equal to _b on every objective
+     * @param _a the first vector
+     * @param _b the second vector
+     * @param _m the number of objectives
+     */
+    static bool weaklyDominates(const double * _a, const double * _b, unsigned int _m)
+    {
+        for (unsigned int j=0; j<_m; j++)
+        {
+            if (_a[j] > _b[j])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+};
+
+#endif /*MOEOEXACTHYPERVOLUME_H_*/
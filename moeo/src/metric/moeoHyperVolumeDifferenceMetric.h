@@ -55,8 +55,9 @@ class moeoHyperVolumeDifferenceMetric : public moeoVectorVsVectorBinaryMetric <
      * Constructor with a coefficient (rho)
      * @param _normalize allow to normalize data (default true)
      * @param _rho coefficient to determine the reference point.
+     * @param _algorithm the hypervolume algorithm (NULL for moeoExactHypervolume)
      */
-    moeoHyperVolumeDifferenceMetric(bool _normalize=true, double _rho=1.1): normalize(_normalize), rho(_rho), ref_point(/*NULL*/){
+    moeoHyperVolumeDifferenceMetric(bool _normalize=true, double _rho=1.1, moeoHypervolumeAlgorithm * _algorithm=NULL): normalize(_normalize), rho(_rho), ref_point(/*NULL*/), algorithm(_algorithm){
         bounds.resize(ObjectiveVector::Traits::nObjectives());
         // initialize bounds in case someone does not want to use them
         for (unsigned int i=0; i<ObjectiveVector::Traits::nObjectives(); i++)
@@ -69,8 +70,9 @@ class moeoHyperVolumeDifferenceMetric : public moeoVectorVsVectorBinaryMetric <
      * Constructor with a reference point
      * @param _normalize allow to normalize data (default true)
      * @param _ref_point the reference point
+     * @param _algorithm the hypervolume algorithm (NULL for moeoExactHypervolume)
      */
-    moeoHyperVolumeDifferenceMetric(bool _normalize/*=true*/, ObjectiveVector& _ref_point/*=NULL*/): normalize(_normalize), rho(0.0), ref_point(_ref_point){
+    moeoHyperVolumeDifferenceMetric(bool _normalize/*=true*/, ObjectiveVector& _ref_point/*=NULL*/, moeoHypervolumeAlgorithm * _algorithm=NULL): normalize(_normalize), rho(0.0), ref_point(_ref_point), algorithm(_algorithm){
         bounds.resize(ObjectiveVector::Traits::nObjectives());
         // initialize bounds in case someone does not want to use them
         for (unsigned int i=0; i<ObjectiveVector::Traits::nObjectives(); i++)
@@ -117,7 +119,7 @@ class moeoHyperVolumeDifferenceMetric : public moeoVectorVsVectorBinaryMetric <
         else if(normalize)
             setup(_set1, _set2);
 
-        moeoHyperVolumeMetric <ObjectiveVector> unaryMetric(ref_point, bounds);
+        moeoHyperVolumeMetric <ObjectiveVector> unaryMetric(ref_point, bounds, hypervolumeAlgorithm());
         hypervolume_set1 = unaryMetric(_set1);
         hypervolume_set2 = unaryMetric(_set2);
 
@@ -195,6 +197,19 @@ class moeoHyperVolumeDifferenceMetric : public moeoVectorVsVectorBinaryMetric <
 
     ObjectiveVector ref_point;
 
+    /*the hypervolume algorithm, NULL for the default one*/
+    moeoHypervolumeAlgorithm * algorithm;
+
+    moeoExactHypervolume defaultAlgorithm;
+
+    /**
+     * Returns the hypervolume algorithm to give to the unary metric
+     */
+    moeoHypervolumeAlgorithm * hypervolumeAlgorithm()
+    {
+        return algorithm ? algorithm : &defaultAlgorithm;
+    }
+
   };
 
 #endif /*MOEOHYPERVOLUMEMETRIC_H_*/
@@ -40,10 +40,14 @@
 #define MOEOHYPERVOLUMEMETRIC_H_
 
 #include <metric/moeoMetric.h>
+#include <metric/moeoExactHypervolume.h>
+#include <metric/moeoHypervolumeAlgorithm.h>
+#include <utils/moeoObjectiveMatrix.h>
 
 /**
  * The hypervolume metric evaluates the multi-dimensional area (hypervolume) enclosed by set of objective vectors and a reference point
  * (E. Zitzler and L. Thiele. Multiobjective evolutionary algorithms: A comparative case study and the strength pareto approach. IEEE Transactions on Evolutionary Computation, 3(4):257–271, 1999)
+ * The hypervolume of the normalized vectors is computed by a moeoHypervolumeAlgorithm, moeoExactHypervolume by default.
  */
 template < class ObjectiveVector >
 class moeoHyperVolumeMetric : public moeoVectorUnaryMetric < ObjectiveVector , double >
@@ -54,8 +58,9 @@ class moeoHyperVolumeMetric : public moeoVectorUnaryMetric < ObjectiveVector , d
      * Constructor with a coefficient (rho)
      * @param _normalize allow to normalize data (default true)
      * @param _rho coefficient to determine the reference point.
+     * @param _algorithm the hypervolume algorithm (NULL for moeoExactHypervolume)
      */
-    moeoHyperVolumeMetric(bool _normalize=true, double _rho=1.1): normalize(_normalize), rho(_rho), ref_point(NULL){
+    moeoHyperVolumeMetric(bool _normalize=true, double _rho=1.1, moeoHypervolumeAlgorithm * _algorithm=NULL): normalize(_normalize), rho(_rho), ref_point(NULL), algorithm(_algorithm){
         bounds.resize(ObjectiveVector::Traits::nObjectives());
         // initialize bounds in case someone does not want to use them
         for (unsigned int i=0; i<ObjectiveVector::Traits::nObjectives(); i++)
@@ -68,8 +73,9 @@ class moeoHyperVolumeMetric : public moeoVectorUnaryMetric < ObjectiveVector , d
      * Constructor with a reference point
      * @param _normalize allow to normalize data (default true)
      * @param _ref_point the reference point
+     * @param _algorithm the hypervolume algorithm (NULL for moeoExactHypervolume)
      */
-    moeoHyperVolumeMetric(bool _normalize=true, ObjectiveVector& _ref_point=NULL): normalize(_normalize), rho(0.0), ref_point(_ref_point){
+    moeoHyperVolumeMetric(bool _normalize=true, ObjectiveVector& _ref_point=NULL, moeoHypervolumeAlgorithm * _algorithm=NULL): normalize(_normalize), rho(0.0), ref_point(_ref_point), algorithm(_algorithm){
 	    bounds.resize(ObjectiveVector::Traits::nObjectives());
 	    // initialize bounds in case someone does not want to use them
 	    for (unsigned int i=0; i<ObjectiveVector::Traits::nObjectives(); i++)
@@ -82,8 +88,9 @@ class moeoHyperVolumeMetric : public moeoVectorUnaryMetric < ObjectiveVector , d
      * Constructor with a reference point
      * @param _ref_point the reference point
      * @param _bounds bounds value
+     * @param _algorithm the hypervolume algorithm (NULL for moeoExactHypervolume)
      */
-    moeoHyperVolumeMetric(ObjectiveVector& _ref_point, std::vector < eoRealInterval >& _bounds): normalize(false), rho(0.0), ref_point(_ref_point), bounds(_bounds){}
+    moeoHyperVolumeMetric(ObjectiveVector& _ref_point, std::vector < eoRealInterval >& _bounds, moeoHypervolumeAlgorithm * _algorithm=NULL): normalize(false), rho(0.0), ref_point(_ref_point), bounds(_bounds), algorithm(_algorithm){}
 
     /**
      * calculates and returns the HyperVolume value of a pareto front
@@ -91,8 +98,6 @@ class moeoHyperVolumeMetric : public moeoVectorUnaryMetric < ObjectiveVector , d
      */
     double operator()(const std::vector < ObjectiveVector > & _set)
     {
-    	std::vector < std::vector<double> > front;
-
     	//determine the reference point if a coefficient is passed in paremeter
     	if(rho >= 1.0){
     		//determine bounds
@@ -120,20 +125,22 @@ class moeoHyperVolumeMetric : public moeoVectorUnaryMetric < ObjectiveVector , d
     	}
     	else if(normalize)
     		setup(_set);
-    	front.resize(_set.size());
+    	//distances to the reference point, as vectors to be minimized towards the origin
+    	unsigned int nbObj=ObjectiveVector::Traits::nObjectives();
+    	front.resize(_set.size(), nbObj);
     	for(unsigned int i=0; i < _set.size(); i++){
-    		front[i].resize(ObjectiveVector::Traits::nObjectives());
-	    	for (unsigned int j=0; j<ObjectiveVector::Traits::nObjectives(); j++){
+	    	for (unsigned int j=0; j<nbObj; j++){
 	    		if (ObjectiveVector::Traits::minimizing(j)){
-	    			front[i][j]=ref_point[j] - ((_set[i][j] - bounds[j].minimum()) /bounds[j].range());
+	    			front[i][j]=((_set[i][j] - bounds[j].minimum()) /bounds[j].range()) - ref_point[j];
 	    		}
 	    		else{
-	    			front[i][j]=((_set[i][j] - bounds[j].minimum()) /bounds[j].range()) - ref_point[j];
+	    			front[i][j]=ref_point[j] - ((_set[i][j] - bounds[j].minimum()) /bounds[j].range());
 	    		}
 	    	}
     	}
+    	origin.assign(nbObj, 0.0);
 
-    	return calc_hypervolume(front, front.size(),ObjectiveVector::Traits::nObjectives());
+    	return algorithm ? (*algorithm)(front, origin) : defaultAlgorithm(front, origin);
     }
 
     /**
@@ -352,6 +359,16 @@ class moeoHyperVolumeMetric : public moeoVectorUnaryMetric < ObjectiveVector , d
 	    /*vectors contains bounds for normalization*/
 	    std::vector < eoRealInterval > bounds;
 
+	    /*the hypervolume algorithm, NULL for the default one*/
+	    moeoHypervolumeAlgorithm * algorithm;
+
+	    moeoExactHypervolume defaultAlgorithm;
+
+	    /*the normalized vectors and the reference point given to the algorithm*/
+	    moeoObjectiveMatrix front;
+
+	    std::vector < double > origin;
+
 
 
   };
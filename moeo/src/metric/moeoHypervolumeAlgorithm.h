@@ -0,0 +1,123 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOHYPERVOLUMEALGORITHM_H_
+#define MOEOHYPERVOLUMEALGORITHM_H_
+
+#include <algorithm>
+#include <vector>
+#include <eoFunctor.h>
+#include <utils/moeoObjectiveMatrix.h>
+
+/**
+ * Abstract class for the algorithms computing the hypervolume of a set of objective vectors, i.e. the volume of the region they dominate and that dominates a reference point.
+ * The objective vectors are the rows of a moeoObjectiveMatrix (every objective is to be minimized), the ones that do not strictly dominate the reference point being ignored.
+ * The exclusive contributions, i.e. the volumes dominated by one vector only, are derived from the hypervolume of the limit sets of While et al.
+ */
+class moeoHypervolumeAlgorithm : public eoBF < const moeoObjectiveMatrix &, const std::vector < double > &, double >
+{
+public:
+
+    /**
+     * Returns the exclusive contribution of _point to the hypervolume of _set, i.e. the volume that would be gained by adding _point into _set
+     * @param _point the objective vector
+     * @param _set the objective vectors
+     * @param _reference the reference point
+     */
+    double contribution(const double * _point, const moeoObjectiveMatrix & _set, const std::vector < double > & _reference)
+    {
+        return exclusiveVolume(_point, _set, _set.size(), _reference);
+    }
+
+
+    /**
+     * Returns the exclusive contribution of the _i-th vector of _set to its hypervolume
+     * @param _set the objective vectors
+     * @param _i the index of the objective vector
+     * @param _reference the reference point
+     */
+    double contribution(const moeoObjectiveMatrix & _set, unsigned int _i, const std::vector < double > & _reference)
+    {
+        return exclusiveVolume(_set[_i], _set, _i, _reference);
+    }
+
+
+    /**
+     * Computes the exclusive contribution of every vector of _set to its hypervolume
+     * @param _set the objective vectors
+     * @param _reference the reference point
+     * @param _contributions the contributions
+     */
+    void contributions(const moeoObjectiveMatrix & _set, const std::vector < double > & _reference, std::vector < double > & _contributions)
+    {
+        _contributions.resize(_set.size());
+        for (unsigned int i=0; i<_set.size(); i++)
+        {
+            _contributions[i] = contribution(_set, i, _reference);
+        }
+    }
+
+
+private:
+
+    /** the limit set of the vector whose contribution is computed */
+    moeoObjectiveMatrix limit;
+    /** a vector of the limit set */
+    std::vector < double > row;
+
+
+    /**
+     * Returns the volume dominated by _point and by no vector of _set, but the _skip-th one
+     * @param _point the objective vector
+     * @param _set the objective vectors
+     * @param _skip the index of the vector to skip (_set.size() for none)
+     * @param _reference the reference point
+     */
+    double exclusiveVolume(const double * _point, const moeoObjectiveMatrix & _set, unsigned int _skip, const std::vector < double > & _reference)
+    {
+        const unsigned int m = _reference.size();
+        double box = 1.0;
+        for (unsigned int j=0; j<m; j++)
+        {
+            if (_point[j] >= _reference[j])
+            {
+                return 0.0;
+            }
+            box *= _reference[j] - _point[j];
+        }
+        // the part of the box dominated by the other vectors is the hypervolume of their limit set
+        limit.resize(0, m);
+        row.resize(m);
+        for (unsigned int i=0; i<_set.size(); i++)
+        {
+            if (i != _skip)
+            {
+                const double * other = _set[i];
+                for (unsigned int j=0; j<m; j++)
+                {
+                    row[j] = std::max(_point[j], other[j]);
+                }
+                limit.push_back(&row[0]);
+            }
+        }
+        return box - (*this)(limit, _reference);
+    }
+
+};
+
+#endif /*MOEOHYPERVOLUMEALGORITHM_H_*/
@@ -40,6 +40,7 @@
 #define MOEOHYPERVOLUMEBINARYMETRIC_H_
 
 #include <stdexcept>
+#include <vector>
 #include <comparator/moeoParetoObjectiveVectorComparator.h>
 #include <metric/moeoNormalizedSolutionVsSolutionBinaryMetric.h>
 
@@ -83,28 +84,52 @@ public:
      */
     double operator()(const ObjectiveVector & _o1, const ObjectiveVector & _o2)
     {
-        double result;
-        // transform maximizing objectives into minimizing objectives
-        ObjectiveVector o1 = _o1;
-        ObjectiveVector o2 = _o2;
-        for (unsigned int i=0; i<ObjectiveVector::Traits::nObjectives(); i++)
-        {
-            if (ObjectiveVector::Traits::maximizing(i))
-            {
-                o1[i] = bounds[i].maximum() - o1[i] + bounds[i].minimum();
-                o2[i] = bounds[i].maximum() - o2[i] + bounds[i].minimum();
-            }
-        }
-        // if _o2 is dominated by _o1
-        if ( paretoComparator(_o2,_o1) )
+        const unsigned int m = ObjectiveVector::Traits::nObjectives();
+        std::vector < double > o1(m), o2(m);
+        transform(_o1, &o1[0]);
+        transform(_o2, &o2[0]);
+        return value(_o1, _o2, &o1[0], &o2[0]);
+    }
+
+
+    /**
+     * Computes the indicator values of every pair of objective vectors: _values[i*n+j] = I(_objectives[i], _objectives[j]).
+     * The objective vectors are transformed once, instead of once per pair, and the rows are independent.
+     * @warning don't forget to set the bounds for every objective before the call of this function
+     * @param _objectives the objective vectors
+     * @param _values the indicator values, row by row
+     * @param _parallel true to compute the rows in parallel (requires OpenMP)
+     */
+    void matrix(const std::vector < ObjectiveVector > & _objectives, std::vector < double > & _values, bool _parallel = false)
+    {
+        const int n = _objectives.size();
+        const unsigned int m = ObjectiveVector::Traits::nObjectives();
+        _values.resize((size_t) n * n);
+        transformed.resize((size_t) n * m);
+        for (int i=0; i<n; i++)
         {
-            result = - hypervolume(o1, o2, ObjectiveVector::Traits::nObjectives()-1);
+            transform(_objectives[i], &transformed[(size_t) i * m]);
         }
-        else
+#ifdef _OPENMP
+        #pragma omp parallel for if(_parallel) schedule(dynamic, 16)
+#else
+        (void) _parallel;
+#endif
+        for (int i=0; i<n; i++)
         {
-            result = hypervolume(o2, o1, ObjectiveVector::Traits::nObjectives()-1);
+            double * row = &_values[(size_t) i * n];
+            for (int j=0; j<n; j++)
+            {
+                if (i != j)
+                {
+                    row[j] = value(_objectives[i], _objectives[j], &transformed[(size_t) i * m], &transformed[(size_t) j * m]);
+                }
+                else
+                {
+                    row[j] = 0;
+                }
+            }
         }
-        return result;
     }
     
     
@@ -116,16 +141,57 @@ private:
     using moeoNormalizedSolutionVsSolutionBinaryMetric < ObjectiveVector, double > :: bounds;
     /** Functor to compare two objective vectors according to Pareto dominance relation */
     moeoParetoObjectiveVectorComparator < ObjectiveVector > paretoComparator;
+    /** the transformed objective vectors, vector by vector (used by matrix) */
+    std::vector < double > transformed;
+
+
+    /**
+     * Copies _o in _out, transforming the maximizing objectives into minimizing objectives.
+     * @param _o the objective vector
+     * @param _out the transformed values
+     */
+    void transform(const ObjectiveVector & _o, double * _out)
+    {
+        for (unsigned int i=0; i<ObjectiveVector::Traits::nObjectives(); i++)
+        {
+            _out[i] = static_cast < double > (_o[i]);
+            if (ObjectiveVector::Traits::maximizing(i))
+            {
+                _out[i] = bounds[i].maximum() - _out[i] + bounds[i].minimum();
+            }
+        }
+    }
+
+
+    /**
+     * Returns the indicator value of the pair (_o1, _o2), given their transformed values _t1 and _t2.
+     * @param _o1 the first objective vector
+     * @param _o2 the second objective vector
+     * @param _t1 the transformed values of _o1
+     * @param _t2 the transformed values of _o2
+     */
+    double value(const ObjectiveVector & _o1, const ObjectiveVector & _o2, const double * _t1, const double * _t2)
+    {
+        // if _o2 is dominated by _o1
+        if ( paretoComparator(_o2,_o1) )
+        {
+            return - hypervolume(_t1, _t2, ObjectiveVector::Traits::nObjectives()-1);
+        }
+        else
+        {
+            return hypervolume(_t2, _t1, ObjectiveVector::Traits::nObjectives()-1);
+        }
+    }
     
     
     /**
      * Returns the volume of the space that is dominated by _o2 but not by _o1 with respect to a reference point computed using rho for the objective _obj.
-     * @param _o1 the first objective vector
-     * @param _o2 the second objective vector
+     * @param _o1 the (transformed) values of the first objective vector
+     * @param _o2 the (transformed) values of the second objective vector
      * @param _obj the objective index
      * @param _flag used for iteration, if _flag=true _o2 is not talen into account (default : false)
      */
-    double hypervolume(const ObjectiveVector & _o1, const ObjectiveVector & _o2, const unsigned int _obj, const bool _flag = false)
+    double hypervolume(const double * _o1, const double * _o2, const unsigned int _obj, const bool _flag = false)
     {
         double result;
         double range = rho * bounds[_obj].range();
@@ -0,0 +1,148 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOINCREMENTALHYPERVOLUME_H_
+#define MOEOINCREMENTALHYPERVOLUME_H_
+
+#include <vector>
+#include <metric/moeoExactHypervolume.h>
+#include <metric/moeoHypervolumeAlgorithm.h>
+#include <utils/moeoObjectiveMatrix.h>
+
+/**
+ * Set of objective vectors (to be minimized) whose hypervolume is kept up to date as vectors are added and removed.
+ * Each update only costs the computation of one exclusive contribution, i.e. the hypervolume of a limit set, instead of the one of the whole set.
+ * This fits the archives and selection schemes removing or inserting one vector at a time.
+ */
+class moeoIncrementalHypervolume
+{
+public:
+
+    /**
+     * Ctor
+     * @param _reference the reference point
+     * @param _algorithm the algorithm computing the exclusive contributions (NULL for moeoExactHypervolume)
+     */
+    moeoIncrementalHypervolume(const std::vector < double > & _reference, moeoHypervolumeAlgorithm * _algorithm = NULL) :
+            reference(_reference), algorithm(_algorithm ? *_algorithm : defaultAlgorithm), set(0, _reference.size()), hypervolume(0.0)
+    {}
+
+
+    /**
+     * Returns the hypervolume of the set
+     */
+    double value() const
+    {
+        return hypervolume;
+    }
+
+
+    /**
+     * Returns the objective vectors of the set
+     */
+    const moeoObjectiveMatrix & points() const
+    {
+        return set;
+    }
+
+
+    /**
+     * Returns the number of objective vectors of the set
+     */
+    unsigned int size() const
+    {
+        return set.size();
+    }
+
+
+    /**
+     * Returns the hypervolume that would be gained by adding _point into the set
+     * @param _point the objective vector
+     */
+    double gain(const double * _point)
+    {
+        return algorithm.contribution(_point, set, reference);
+    }
+
+
+    /**
+     * Returns the exclusive contribution of the _i-th objective vector, i.e. the hypervolume that would be lost by removing it
+     * @param _i the index of the objective vector
+     */
+    double contribution(unsigned int _i)
+    {
+        return algorithm.contribution(set, _i, reference);
+    }
+
+
+    /**
+     * Adds _point into the set and returns the hypervolume gained
+     * @param _point the objective vector
+     */
+    double add(const double * _point)
+    {
+        double result = gain(_point);
+        set.push_back(_point);
+        hypervolume += result;
+        return result;
+    }
+
+
+    /**
+     * Removes the _i-th objective vector, the last one taking its place, and returns the hypervolume lost
+     * @param _i the index of the objective vector
+     */
+    double remove(unsigned int _i)
+    {
+        double result = contribution(_i);
+        set.erase(_i);
+        hypervolume -= result;
+        return result;
+    }
+
+
+    /**
+     * Removes every objective vector
+     */
+    void clear()
+    {
+        set.resize(0, reference.size());
+        hypervolume = 0.0;
+    }
+
+
+private:
+
+    /** the reference point */
+    std::vector < double > reference;
+    /** the default algorithm */
+    moeoExactHypervolume defaultAlgorithm;
+    /** the algorithm computing the exclusive contributions */
+    moeoHypervolumeAlgorithm & algorithm;
+    /** the objective vectors */
+    moeoObjectiveMatrix set;
+    /** the hypervolume of the set */
+    double hypervolume;
+
+    /** no copy, because of the reference to the default algorithm */
+    moeoIncrementalHypervolume(const moeoIncrementalHypervolume &);
+    moeoIncrementalHypervolume & operator=(const moeoIncrementalHypervolume &);
+
+};
+
+#endif /*MOEOINCREMENTALHYPERVOLUME_H_*/
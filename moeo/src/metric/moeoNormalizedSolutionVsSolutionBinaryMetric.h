@@ -96,6 +96,32 @@ class moeoNormalizedSolutionVsSolutionBinaryMetric : public moeoSolutionVsSoluti
     }
 
 
+    /**
+     * Computes the indicator values of every pair of objective vectors: _values[i*n+j] = I(_objectives[i], _objectives[j]),
+     * where n is the number of objective vectors (the diagonal is left unspecified).
+     * The default implementation calls the operator() for every pair, the metrics can provide a faster kernel.
+     * @warning don't forget to set the bounds for every objective before the call of this function
+     * @param _objectives the objective vectors
+     * @param _values the indicator values, row by row
+     * @param _parallel true to compute the rows in parallel (requires OpenMP, unused by the default implementation)
+     */
+    virtual void matrix(const std::vector < ObjectiveVector > & _objectives, std::vector < R > & _values, bool /*_parallel*/ = false)
+    {
+      unsigned int n = _objectives.size();
+      _values.resize(n * n);
+      for (unsigned int i=0; i<n; i++)
+        {
+          for (unsigned int j=0; j<n; j++)
+            {
+              if (i != j)
+                {
+                  _values[i * n + j] = (*this)(_objectives[i], _objectives[j]);
+                }
+            }
+        }
+    }
+
+
     /**
      * Returns a very small value that can be used to avoid extreme cases (where the min bound == the max bound)
      */
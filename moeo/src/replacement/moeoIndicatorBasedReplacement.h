@@ -0,0 +1,93 @@
+/*
+* <moeoIndicatorBasedReplacement.h>
+* Copyright (C) DOLPHIN Project-Team, INRIA Futurs, 2006-2007
+* (C) OPAC Team, LIFL, 2002-2007
+*
+* This software is governed by the CeCILL license under French law and
+* abiding by the rules of distribution of free software.  You can  use,
+* modify and/ or redistribute the software under the terms of the CeCILL
+* license as circulated by CEA, CNRS and INRIA at the following URL
+* "http://www.cecill.info".
+*
+* As a counterpart to the access to the source code and  rights to copy,
+* modify and redistribute granted by the license, users are provided only
+* with a limited warranty  and the software's author,  the holder of the
+* economic rights,  and the successive licensors  have only  limited liability.
+*
+* In this respect, the user's attention is drawn to the risks associated
+* with loading,  using,  modifying and/or developing or reproducing the
+* software by the user in light of its specific status of free software,
+* that may mean  that it is complicated to manipulate,  and  that  also
+* therefore means  that it is reserved for developers  and  experienced
+* professionals having in-depth computer knowledge. Users are therefore
+* encouraged to load and test the software's suitability as regards their
+* requirements in conditions enabling the security of their systems and/or
+* data to be ensured and,  more generally, to use and operate it in the
+* same conditions as regards security.
+* The fact that you are presently reading this means that you have had
+* knowledge of the CeCILL license and that you accept its terms.
+*
+* ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+* Contact: paradiseo-help@lists.gforge.inria.fr
+*
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOINDICATORBASEDREPLACEMENT_H_
+#define MOEOINDICATORBASEDREPLACEMENT_H_
+
+#include <diversity/moeoDummyDiversityAssignment.h>
+#include <fitness/moeoExpBinaryIndicatorBasedFitnessAssignment.h>
+#include <replacement/moeoReplacement.h>
+
+/**
+ * Environmental replacement strategy of IBEA: the N best individuals are kept by deleting the worst individuals 1 by 1
+ * and by updating the fitness values after each deletion.
+ * It gives the same population as a moeoEnvironmentalReplacement using a moeoExpBinaryIndicatorBasedFitnessAssignment
+ * and a dummy diversity (which is also assigned here), but the indicator values computed by the fitness assignment are reused for the updates,
+ * instead of being computed again after each deletion.
+ */
+template < class MOEOT > class moeoIndicatorBasedReplacement : public moeoReplacement < MOEOT >
+  {
+  public:
+
+    /**
+     * Ctor.
+     * @param _fitnessAssignment the fitness assignment strategy
+     */
+    moeoIndicatorBasedReplacement (moeoExpBinaryIndicatorBasedFitnessAssignment < MOEOT > & _fitnessAssignment) :
+        fitnessAssignment (_fitnessAssignment)
+    {}
+
+
+    /**
+     * Replaces the first population by adding the individuals of the second one and by removing the worst individuals.
+     * @param _parents the population composed of the parents (the population you want to replace)
+     * @param _offspring the offspring population
+     */
+    void operator () (eoPop < MOEOT > &_parents, eoPop < MOEOT > &_offspring)
+    {
+      unsigned int sz = _parents.size();
+      // merges offspring and parents into a global population
+      _parents.reserve (_parents.size() + _offspring.size());
+      std::copy (_offspring.begin(), _offspring.end(), back_inserter(_parents));
+      // evaluates the fitness of this global population
+      fitnessAssignment (_parents);
+      // remove individuals 1 by 1 and update the fitness values
+      fitnessAssignment.reduce (_parents, sz);
+      diversityAssignment (_parents);
+      // clear the offspring population
+      _offspring.clear ();
+    }
+
+
+  protected:
+
+    /** the fitness assignment strategy */
+    moeoExpBinaryIndicatorBasedFitnessAssignment < MOEOT > & fitnessAssignment;
+    /** the dummy diversity assignment */
+    moeoDummyDiversityAssignment < MOEOT > diversityAssignment;
+
+  };
+
+#endif /*MOEOINDICATORBASEDREPLACEMENT_H_ */
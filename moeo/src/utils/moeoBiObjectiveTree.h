@@ -0,0 +1,153 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOBIOBJECTIVETREE_H_
+#define MOEOBIOBJECTIVETREE_H_
+
+#include <map>
+#include <utils/moeoDominanceIndex.h>
+
+/**
+ * Dominance index of a set of mutually non-dominated bi-objective vectors, in a balanced search tree sorted on the first objective.
+ * Since the second objective decreases when the first one increases, the vectors dominated by a given vector are consecutive
+ * from the first one which is not better on the first objective, and the vector dominating it, if any, is among the last ones
+ * which are not worse on the first objective: both queries are done in O(log n + k), k being the number of vectors reported.
+ * The vectors must remain mutually non-dominated and different (as in a moeoNDTreeArchive).
+ */
+class moeoBiObjectiveTree : public moeoDominanceIndex
+{
+public:
+
+    /**
+     * Ctor
+     * @param _tolerance the tolerance used to compare the values
+     */
+    moeoBiObjectiveTree(double _tolerance = 0.0) : moeoDominanceIndex(_tolerance)
+    {}
+
+
+    /**
+     * Adds to _result the indexes of the vectors weakly dominated by _objectiveVector, in the order of the first objective
+     * @param _objectiveVector the values of an objective vector
+     * @param _strict if true, the vectors equal to _objectiveVector are left aside
+     * @param _result the indexes
+     */
+    void dominated(const double * _objectiveVector, bool _strict, std::vector < unsigned int > & _result) const
+    {
+        for (Tree::const_iterator it = tree.lower_bound(_objectiveVector[0] - tolerance); it != tree.end(); ++it)
+        {
+            const double * vec = objectives[it->second];
+            if (vec[1] < _objectiveVector[1] - tolerance)
+            {
+                break;
+            }
+            if (!_strict || !equal(vec, _objectiveVector))
+            {
+                _result.push_back(it->second);
+            }
+        }
+    }
+
+
+    /**
+     * Returns true if a vector weakly dominates _objectiveVector
+     * @param _objectiveVector the values of an objective vector
+     * @param _strict if true, the vectors equal to _objectiveVector are left aside
+     */
+    bool dominates(const double * _objectiveVector, bool _strict) const
+    {
+        Tree::const_iterator it = tree.upper_bound(_objectiveVector[0] + tolerance);
+        while (it != tree.begin())
+        {
+            --it;
+            const double * vec = objectives[it->second];
+            if (vec[1] > _objectiveVector[1] + tolerance)
+            {
+                break;
+            }
+            if (!_strict || !equal(vec, _objectiveVector))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+protected:
+
+    /** index of the vectors by their first objective */
+    typedef std::multimap < double, unsigned int > Tree;
+
+    /**
+     * Indexes the _i-th vector, just appended to the objective matrix
+     * @param _i the index of the vector
+     */
+    void insert(unsigned int _i)
+    {
+        tree.insert(Tree::value_type(objectives[_i][0], _i));
+    }
+
+    /**
+     * Removes the _i-th vector from the index
+     * @param _i the index of the vector
+     */
+    void remove(unsigned int _i)
+    {
+        tree.erase(find(_i));
+    }
+
+    /**
+     * Records that the _from-th vector is moved at the place _to
+     * @param _from the former index of the vector
+     * @param _to its new index
+     */
+    void move(unsigned int _from, unsigned int _to)
+    {
+        find(_from)->second = _to;
+    }
+
+    /**
+     * Removes all the vectors from the index
+     */
+    void clearIndex()
+    {
+        tree.clear();
+    }
+
+    /**
+     * Returns the node of the _i-th vector
+     * @param _i the index of the vector
+     */
+    Tree::iterator find(unsigned int _i)
+    {
+        std::pair < Tree::iterator, Tree::iterator > range = tree.equal_range(objectives[_i][0]);
+        Tree::iterator it = range.first;
+        while (it->second != _i)
+        {
+            ++it;
+        }
+        return it;
+    }
+
+    /** the index of the vectors */
+    Tree tree;
+
+};
+
+#endif /*MOEOBIOBJECTIVETREE_H_*/
@@ -0,0 +1,399 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEODIVIDEANDCONQUERNONDOMINATEDSORTING_H_
+#define MOEODIVIDEANDCONQUERNONDOMINATEDSORTING_H_
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <vector>
+#include <utils/moeoNondominatedSorting.h>
+
+/**
+ * Divide-and-conquer non-dominated sorting, from the algorithm of:
+ * M. T. Jensen, "Reducing the Run-Time Complexity of Multiobjective EAs: The NSGA-II and Other Algorithms", IEEE Transactions on Evolutionary Computation, vol. 7, no. 5 (2003),
+ * as generalized to equal objective values in:
+ * M. Buzdalov, A. Shalyto, "A Provably Asymptotically Fast Version of the Generalized Jensen Algorithm for Non-dominated Sorting", PPSN XIII (2014).
+ * The vectors are recursively split on their median value objective by objective, the two-objective subproblems being solved by sweeping.
+ * Its complexity is O(N log^(M-1) N), where N stands for the number of vectors and M for the number of objectives, which makes it the method of choice for large populations with a few objectives.
+ */
+class moeoDivideAndConquerNondominatedSorting : public moeoNondominatedSorting
+{
+public:
+
+    /**
+     * Computes the front of every row of _objectives
+     * @param _objectives the objective vectors
+     * @param _ranks the fronts, 0 for the non-dominated vectors
+     */
+    void operator()(const moeoObjectiveMatrix & _objectives, std::vector < unsigned int > & _ranks)
+    {
+        const unsigned int n = _objectives.size();
+        const unsigned int m = _objectives.nObjectives();
+        _ranks.assign(n, 0);
+        if (n == 0)
+        {
+            return;
+        }
+        objectives = &_objectives;
+        ranks = &_ranks;
+        std::vector < unsigned int > order(n);
+        for (unsigned int i=0; i<n; i++)
+        {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), LexicographicComparator(_objectives));
+        // equal vectors are merged, the first one representing the others
+        std::vector < unsigned int > representative(n);
+        std::vector < unsigned int > points;
+        points.reserve(n);
+        for (unsigned int i=0; i<n; i++)
+        {
+            if ((! points.empty()) && (! lexicographicallyLess(_objectives[points.back()], _objectives[order[i]], m)))
+            {
+                representative[order[i]] = points.back();
+            }
+            else
+            {
+                representative[order[i]] = order[i];
+                points.push_back(order[i]);
+            }
+        }
+        if (m == 1)
+        {
+            // distinct values in the ascending order
+            for (unsigned int i=0; i<points.size(); i++)
+            {
+                _ranks[points[i]] = i;
+            }
+        }
+        else
+        {
+            helperA(points, m-1);
+        }
+        for (unsigned int i=0; i<n; i++)
+        {
+            _ranks[i] = _ranks[representative[i]];
+        }
+    }
+
+
+private:
+
+    /** the objective vectors being sorted */
+    const moeoObjectiveMatrix * objectives;
+    /** the fronts being computed */
+    std::vector < unsigned int > * ranks;
+    /** staircase of the sweeps: value of the second objective -> front, the fronts increasing with the values */
+    typedef std::map < double, unsigned int > Staircase;
+
+
+    /**
+     * Returns the _k-th objective value of the _i-th vector
+     * @param _i the index of the vector
+     * @param _k the objective
+     */
+    double value(unsigned int _i, unsigned int _k) const
+    {
+        return (*objectives)[_i][_k];
+    }
+
+
+    /**
+     * Raises the front of the _i-th vector to _rank if it is lower
+     * @param _i the index of the vector
+     * @param _rank the front
+     */
+    void raise(unsigned int _i, unsigned int _rank)
+    {
+        if ((*ranks)[_i] < _rank)
+        {
+            (*ranks)[_i] = _rank;
+        }
+    }
+
+
+    /**
+     * Returns true if the _a-th vector is lower than or equal to the _b-th one on the objectives 0.._k
+     * @param _a the index of the first vector
+     * @param _b the index of the second vector
+     * @param _k the last objective to consider
+     */
+    bool weaklyDominates(unsigned int _a, unsigned int _b, unsigned int _k) const
+    {
+        const double * a = (*objectives)[_a];
+        const double * b = (*objectives)[_b];
+        for (unsigned int j=0; j<=_k; j++)
+        {
+            if (a[j] > b[j])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    /**
+     * Returns the median of the _k-th objective values of the vectors of _set1 and _set2
+     * @param _set1 the first set of indexes
+     * @param _set2 the second set of indexes
+     * @param _k the objective
+     */
+    double median(const std::vector < unsigned int > & _set1, const std::vector < unsigned int > & _set2, unsigned int _k) const
+    {
+        std::vector < double > values;
+        values.reserve(_set1.size() + _set2.size());
+        for (unsigned int i=0; i<_set1.size(); i++)
+        {
+            values.push_back(value(_set1[i], _k));
+        }
+        for (unsigned int i=0; i<_set2.size(); i++)
+        {
+            values.push_back(value(_set2[i], _k));
+        }
+        std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+        return values[values.size() / 2];
+    }
+
+
+    /**
+     * Splits _set into the vectors whose _k-th objective value is lower than _median and the other ones, the order being preserved
+     * @param _set the indexes of the vectors
+     * @param _k the objective
+     * @param _median the value
+     * @param _equalToLow true if the vectors whose value is equal to _median go to the lower part
+     * @param _low the lower part
+     * @param _high the higher part
+     */
+    void split(const std::vector < unsigned int > & _set, unsigned int _k, double _median, bool _equalToLow, std::vector < unsigned int > & _low, std::vector < unsigned int > & _high) const
+    {
+        for (unsigned int i=0; i<_set.size(); i++)
+        {
+            double v = value(_set[i], _k);
+            if ((v < _median) || (_equalToLow && (v == _median)))
+            {
+                _low.push_back(_set[i]);
+            }
+            else
+            {
+                _high.push_back(_set[i]);
+            }
+        }
+    }
+
+
+    /**
+     * Returns the highest front of the staircase among the vectors whose second objective value is lower than or equal to _value, plus one (0 if there is none)
+     * @param _stairs the staircase
+     * @param _value the value of the second objective
+     */
+    unsigned int query(const Staircase & _stairs, double _value) const
+    {
+        Staircase::const_iterator it = _stairs.upper_bound(_value);
+        if (it == _stairs.begin())
+        {
+            return 0;
+        }
+        return (--it)->second + 1;
+    }
+
+
+    /**
+     * Inserts a vector into the staircase, removing the ones it makes useless
+     * @param _stairs the staircase
+     * @param _value the value of the second objective of the vector
+     * @param _rank the front of the vector
+     */
+    void insert(Staircase & _stairs, double _value, unsigned int _rank) const
+    {
+        Staircase::iterator it = _stairs.upper_bound(_value);
+        if ((it != _stairs.begin()) && (std::prev(it)->second >= _rank))
+        {
+            return;
+        }
+        it = _stairs.lower_bound(_value);
+        while ((it != _stairs.end()) && (it->second <= _rank))
+        {
+            _stairs.erase(it++);
+        }
+        _stairs[_value] = _rank;
+    }
+
+
+    /**
+     * Computes the fronts of the vectors of _set, by considering the objectives 0.._k only (the other ones are equal)
+     * @param _set the indexes of the vectors, in the lexicographic order
+     * @param _k the last objective to consider
+     */
+    void helperA(const std::vector < unsigned int > & _set, unsigned int _k)
+    {
+        if (_set.size() < 2)
+        {
+            return;
+        }
+        if (_set.size() == 2)
+        {
+            if (weaklyDominates(_set[0], _set[1], _k))
+            {
+                raise(_set[1], (*ranks)[_set[0]] + 1);
+            }
+            return;
+        }
+        if (_k == 1)
+        {
+            sweepA(_set);
+            return;
+        }
+        double min = value(_set[0], _k);
+        double max = min;
+        for (unsigned int i=1; i<_set.size(); i++)
+        {
+            min = std::min(min, value(_set[i], _k));
+            max = std::max(max, value(_set[i], _k));
+        }
+        if (min == max)
+        {
+            helperA(_set, _k-1);
+            return;
+        }
+        std::vector < unsigned int > none;
+        double med = median(_set, none, _k);
+        // the vectors equal to the median go to the smaller part
+        unsigned int nLower = 0;
+        unsigned int nHigher = 0;
+        for (unsigned int i=0; i<_set.size(); i++)
+        {
+            double v = value(_set[i], _k);
+            nLower += (v < med);
+            nHigher += (v > med);
+        }
+        std::vector < unsigned int > low, high;
+        split(_set, _k, med, nLower < nHigher, low, high);
+        helperA(low, _k);
+        helperB(low, high, _k-1);
+        helperA(high, _k);
+    }
+
+
+    /**
+     * Updates the fronts of the vectors of _high with respect to the vectors of _low, whose fronts are known, by considering the objectives 0.._k only
+     * (every vector of _low is lower than or equal to every vector of _high on the other objectives)
+     * @param _low the indexes of the dominating candidates, in the lexicographic order
+     * @param _high the indexes of the vectors to update, in the lexicographic order
+     * @param _k the last objective to consider
+     */
+    void helperB(const std::vector < unsigned int > & _low, const std::vector < unsigned int > & _high, unsigned int _k)
+    {
+        if (_low.empty() || _high.empty())
+        {
+            return;
+        }
+        if ((_low.size() == 1) || (_high.size() == 1))
+        {
+            for (unsigned int i=0; i<_high.size(); i++)
+            {
+                for (unsigned int j=0; j<_low.size(); j++)
+                {
+                    if (weaklyDominates(_low[j], _high[i], _k))
+                    {
+                        raise(_high[i], (*ranks)[_low[j]] + 1);
+                    }
+                }
+            }
+            return;
+        }
+        if (_k == 1)
+        {
+            sweepB(_low, _high);
+            return;
+        }
+        double maxLow = value(_low[0], _k);
+        double minLow = maxLow;
+        for (unsigned int i=1; i<_low.size(); i++)
+        {
+            maxLow = std::max(maxLow, value(_low[i], _k));
+            minLow = std::min(minLow, value(_low[i], _k));
+        }
+        double maxHigh = value(_high[0], _k);
+        double minHigh = maxHigh;
+        for (unsigned int i=1; i<_high.size(); i++)
+        {
+            maxHigh = std::max(maxHigh, value(_high[i], _k));
+            minHigh = std::min(minHigh, value(_high[i], _k));
+        }
+        if (maxLow <= minHigh)
+        {
+            helperB(_low, _high, _k-1);
+        }
+        else if (minLow <= maxHigh)
+        {
+            double med = median(_low, _high, _k);
+            // the vectors equal to the median go to the lower parts, unless the higher ones would be empty
+            bool equalToLow = (std::max(maxLow, maxHigh) > med);
+            std::vector < unsigned int > low1, low2, high1, high2;
+            split(_low, _k, med, equalToLow, low1, low2);
+            split(_high, _k, med, equalToLow, high1, high2);
+            helperB(low1, high1, _k);
+            helperB(low1, high2, _k-1);
+            helperB(low2, high2, _k);
+        }
+    }
+
+
+    /**
+     * Computes the fronts of the vectors of _set by considering the first two objectives only
+     * @param _set the indexes of the vectors, in the lexicographic order
+     */
+    void sweepA(const std::vector < unsigned int > & _set)
+    {
+        Staircase stairs;
+        for (unsigned int i=0; i<_set.size(); i++)
+        {
+            double v = value(_set[i], 1);
+            raise(_set[i], query(stairs, v));
+            insert(stairs, v, (*ranks)[_set[i]]);
+        }
+    }
+
+
+    /**
+     * Updates the fronts of the vectors of _high with respect to the vectors of _low by considering the first two objectives only
+     * @param _low the indexes of the dominating candidates, in the lexicographic order
+     * @param _high the indexes of the vectors to update, in the lexicographic order
+     */
+    void sweepB(const std::vector < unsigned int > & _low, const std::vector < unsigned int > & _high)
+    {
+        Staircase stairs;
+        unsigned int j = 0;
+        for (unsigned int i=0; i<_high.size(); i++)
+        {
+            double v = value(_high[i], 0);
+            while ((j < _low.size()) && (value(_low[j], 0) <= v))
+            {
+                insert(stairs, value(_low[j], 1), (*ranks)[_low[j]]);
+                j++;
+            }
+            raise(_high[i], query(stairs, value(_high[i], 1)));
+        }
+    }
+
+};
+
+#endif /*MOEODIVIDEANDCONQUERNONDOMINATEDSORTING_H_*/
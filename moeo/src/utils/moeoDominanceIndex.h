@@ -0,0 +1,204 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEODOMINANCEINDEX_H_
+#define MOEODOMINANCEINDEX_H_
+
+#include <vector>
+#include <utils/moeoObjectiveMatrix.h>
+
+/**
+ * Abstract class for the structures answering dominance queries on a set of objective vectors.
+ * The objective vectors are stored in a moeoObjectiveMatrix (every objective is to be minimized),
+ * in the order of the solutions they belong to: the removal of the i-th vector moves the last one at its place,
+ * as eoPop does when its last solution is moved on a removed one (see moeoNDTreeArchive).
+ * Values are compared with a tolerance, as moeoParetoObjectiveVectorComparator does: two values are equal
+ * if they do not differ by more than the tolerance.
+ */
+class moeoDominanceIndex
+{
+public:
+
+    /**
+     * Ctor
+     * @param _tolerance the tolerance used to compare the values
+     */
+    moeoDominanceIndex(double _tolerance = 0.0) : tolerance(_tolerance)
+    {}
+
+
+    /**
+     * Dtor
+     */
+    virtual ~moeoDominanceIndex()
+    {}
+
+
+    /**
+     * Removes all the objective vectors
+     * @param _nObjectives the number of objectives of the vectors to come
+     */
+    void clear(unsigned int _nObjectives)
+    {
+        objectives.resize(0, _nObjectives);
+        clearIndex();
+    }
+
+
+    /**
+     * Appends an objective vector
+     * @param _objectiveVector the values of the objective vector
+     */
+    void push_back(const double * _objectiveVector)
+    {
+        objectives.push_back(_objectiveVector);
+        insert(objectives.size() - 1);
+    }
+
+
+    /**
+     * Removes the _i-th objective vector, the last one taking its place
+     * @param _i the index of the objective vector
+     */
+    void erase(unsigned int _i)
+    {
+        unsigned int last = objectives.size() - 1;
+        remove(_i);
+        if (_i != last)
+        {
+            move(last, _i);
+        }
+        objectives.erase(_i);
+    }
+
+
+    /**
+     * Returns the number of objective vectors
+     */
+    unsigned int size() const
+    {
+        return objectives.size();
+    }
+
+
+    /**
+     * Returns the number of objectives
+     */
+    unsigned int nObjectives() const
+    {
+        return objectives.nObjectives();
+    }
+
+
+    /**
+     * Returns the values of the _i-th objective vector
+     * @param _i the index of the objective vector
+     */
+    const double * operator[](unsigned int _i) const
+    {
+        return objectives[_i];
+    }
+
+
+    /**
+     * Adds to _result the indexes of the vectors weakly dominated by _objectiveVector, in no particular order
+     * @param _objectiveVector the values of an objective vector
+     * @param _strict if true, the vectors equal to _objectiveVector are left aside
+     * @param _result the indexes
+     */
+    virtual void dominated(const double * _objectiveVector, bool _strict, std::vector < unsigned int > & _result) const = 0;
+
+
+    /**
+     * Returns true if a vector weakly dominates _objectiveVector
+     * @param _objectiveVector the values of an objective vector
+     * @param _strict if true, the vectors equal to _objectiveVector are left aside
+     */
+    virtual bool dominates(const double * _objectiveVector, bool _strict) const = 0;
+
+
+    /**
+     * Returns true if _a weakly dominates _b: no value of _a is greater than the one of _b
+     * @param _a the first objective vector
+     * @param _b the second objective vector
+     */
+    bool weaklyDominates(const double * _a, const double * _b) const
+    {
+        for (unsigned int j=0; j<nObjectives(); j++)
+        {
+            if (_a[j] > _b[j] + tolerance)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    /**
+     * Returns true if _a and _b are equal
+     * @param _a the first objective vector
+     * @param _b the second objective vector
+     */
+    bool equal(const double * _a, const double * _b) const
+    {
+        for (unsigned int j=0; j<nObjectives(); j++)
+        {
+            if (_a[j] > _b[j] + tolerance || _b[j] > _a[j] + tolerance)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+protected:
+
+    /**
+     * Indexes the _i-th vector, just appended to the objective matrix
+     * @param _i the index of the vector
+     */
+    virtual void insert(unsigned int _i) = 0;
+
+    /**
+     * Removes the _i-th vector from the index, before it is removed from the objective matrix
+     * @param _i the index of the vector
+     */
+    virtual void remove(unsigned int _i) = 0;
+
+    /**
+     * Records that the _from-th vector is moved at the place _to, before it is moved in the objective matrix
+     * @param _from the former index of the vector
+     * @param _to its new index
+     */
+    virtual void move(unsigned int _from, unsigned int _to) = 0;
+
+    /**
+     * Removes all the vectors from the index
+     */
+    virtual void clearIndex() = 0;
+
+    /** the objective vectors */
+    moeoObjectiveMatrix objectives;
+    /** the tolerance used to compare the values */
+    double tolerance;
+
+};
+
+#endif /*MOEODOMINANCEINDEX_H_*/
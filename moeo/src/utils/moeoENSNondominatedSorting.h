@@ -0,0 +1,143 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOENSNONDOMINATEDSORTING_H_
+#define MOEOENSNONDOMINATEDSORTING_H_
+
+#include <algorithm>
+#include <vector>
+#include <utils/moeoNondominatedSorting.h>
+
+/**
+ * Efficient non-dominated sort (ENS) proposed in:
+ * X. Zhang, Y. Tian, R. Cheng, Y. Jin, "An Efficient Approach to Nondominated Sorting for Evolutionary Multiobjective Optimization", IEEE Transactions on Evolutionary Computation, vol. 19, no. 2 (2015).
+ * The vectors are sorted in the lexicographic order, so that a vector can only be dominated by the ones preceding it.
+ * Then, each vector is inserted into the first front holding no vector dominating it, that front being found either by a binary search (ENS-BS) or by a sequential one (ENS-SS).
+ * Its worst-case complexity is O(M N²), but it usually performs far fewer comparisons than moeoFastNondominatedSorting, ENS-SS being better when there are few fronts.
+ */
+class moeoENSNondominatedSorting : public moeoNondominatedSorting
+{
+public:
+
+    /**
+     * Ctor
+     * @param _binarySearch true for ENS-BS, false for ENS-SS
+     */
+    moeoENSNondominatedSorting(bool _binarySearch = true) : binarySearch(_binarySearch)
+    {}
+
+
+    /**
+     * Computes the front of every row of _objectives
+     * @param _objectives the objective vectors
+     * @param _ranks the fronts, 0 for the non-dominated vectors
+     */
+    void operator()(const moeoObjectiveMatrix & _objectives, std::vector < unsigned int > & _ranks)
+    {
+        const unsigned int n = _objectives.size();
+        _ranks.assign(n, 0);
+        order.resize(n);
+        for (unsigned int i=0; i<n; i++)
+        {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), LexicographicComparator(_objectives));
+        // fronts[k] = indexes of the vectors of the k-th front, in the order of insertion
+        for (unsigned int k=0; k<fronts.size(); k++)
+        {
+            fronts[k].clear();
+        }
+        unsigned int nFronts = 0;
+        for (unsigned int i=0; i<n; i++)
+        {
+            unsigned int current = order[i];
+            unsigned int k;
+            if (binarySearch)
+            {
+                unsigned int low = 0;
+                unsigned int high = nFronts;
+                while (low < high)
+                {
+                    unsigned int middle = (low + high) / 2;
+                    if (isDominated(_objectives, fronts[middle], current))
+                    {
+                        low = middle + 1;
+                    }
+                    else
+                    {
+                        high = middle;
+                    }
+                }
+                k = low;
+            }
+            else
+            {
+                k = 0;
+                while ((k < nFronts) && isDominated(_objectives, fronts[k], current))
+                {
+                    k++;
+                }
+            }
+            if (k == nFronts)
+            {
+                nFronts++;
+                if (fronts.size() < nFronts)
+                {
+                    fronts.resize(nFronts);
+                }
+            }
+            fronts[k].push_back(current);
+            _ranks[current] = k;
+        }
+    }
+
+
+private:
+
+    /** true for ENS-BS, false for ENS-SS */
+    bool binarySearch;
+    /** indexes of the vectors in the lexicographic order */
+    std::vector < unsigned int > order;
+    /** indexes of the vectors of each front */
+    std::vector < std::vector < unsigned int > > fronts;
+
+
+    /**
+     * Returns true if the _current-th vector is dominated by a vector of _front
+     * The last inserted vectors are the most likely to dominate it, so that they are checked first.
+     * @param _objectives the objective vectors
+     * @param _front the front
+     * @param _current the index of the vector
+     */
+    bool isDominated(const moeoObjectiveMatrix & _objectives, const std::vector < unsigned int > & _front, unsigned int _current) const
+    {
+        const unsigned int m = _objectives.nObjectives();
+        const double * row = _objectives[_current];
+        for (unsigned int i=_front.size(); i>0; i--)
+        {
+            if (dominates(_objectives[_front[i-1]], row, m))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+};
+
+#endif /*MOEOENSNONDOMINATEDSORTING_H_*/
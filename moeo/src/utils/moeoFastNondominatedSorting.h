@@ -0,0 +1,124 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOFASTNONDOMINATEDSORTING_H_
+#define MOEOFASTNONDOMINATEDSORTING_H_
+
+#include <vector>
+#include <utils/moeoNondominatedSorting.h>
+
+/**
+ * Fast non-dominated sorting proposed in:
+ * K. Deb, A. Pratap, S. Agarwal, T. Meyarivan, "A Fast and Elitist Multi-Objective Genetic Algorithm: NSGA-II", IEEE Transactions on Evolutionary Computation, vol. 6, no. 2 (2002).
+ * Every pair of objective vectors is compared, hence a complexity of O(M N²), where N stands for the number of vectors and M for the number of objectives.
+ * When compiled with OpenMP, the comparisons can be shared among threads.
+ */
+class moeoFastNondominatedSorting : public moeoNondominatedSorting
+{
+public:
+
+    /**
+     * Ctor
+     * @param _parallel true to compare the objective vectors in parallel (requires OpenMP)
+     */
+    moeoFastNondominatedSorting(bool _parallel = false) : parallel(_parallel)
+    {}
+
+
+    /**
+     * Computes the front of every row of _objectives
+     * @param _objectives the objective vectors
+     * @param _ranks the fronts, 0 for the non-dominated vectors
+     */
+    void operator()(const moeoObjectiveMatrix & _objectives, std::vector < unsigned int > & _ranks)
+    {
+        const int n = _objectives.size();
+        const unsigned int m = _objectives.nObjectives();
+        _ranks.assign(n, 0);
+        // S[p] = indexes of the vectors dominated by p
+        S.resize(n);
+        // count[p] = number of vectors dominating p
+        count.assign(n, 0);
+        // the rows are independent, so that they can be computed in parallel
+#ifdef _OPENMP
+        #pragma omp parallel for if(parallel) schedule(dynamic, 16)
+#endif
+        for (int p=0; p<n; p++)
+        {
+            S[p].clear();
+            const double * rowP = _objectives[p];
+            for (int q=0; q<n; q++)
+            {
+                if (dominates(rowP, _objectives[q], m))
+                {
+                    S[p].push_back(q);
+                }
+                else if (dominates(_objectives[q], rowP, m))
+                {
+                    count[p]++;
+                }
+            }
+        }
+        // peel the fronts off one after the other
+        front.clear();
+        for (int p=0; p<n; p++)
+        {
+            if (count[p] == 0)
+            {
+                front.push_back(p);
+            }
+        }
+        unsigned int rank = 0;
+        while (! front.empty())
+        {
+            next.clear();
+            for (unsigned int i=0; i<front.size(); i++)
+            {
+                const std::vector < unsigned int > & dominated = S[front[i]];
+                for (unsigned int j=0; j<dominated.size(); j++)
+                {
+                    unsigned int q = dominated[j];
+                    if (--count[q] == 0)
+                    {
+                        _ranks[q] = rank + 1;
+                        next.push_back(q);
+                    }
+                }
+            }
+            front.swap(next);
+            rank++;
+        }
+    }
+
+
+private:
+
+    /** true to compare the objective vectors in parallel */
+    bool parallel;
+    /** indexes of the vectors dominated by each vector */
+    std::vector < std::vector < unsigned int > > S;
+    /** number of vectors dominating each vector */
+    std::vector < unsigned int > count;
+    /** the current front */
+    std::vector < unsigned int > front;
+    /** the next front */
+    std::vector < unsigned int > next;
+
+};
+
+#endif /*MOEOFASTNONDOMINATEDSORTING_H_*/
@@ -0,0 +1,472 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEONDTREE_H_
+#define MOEONDTREE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utils/moeoDominanceIndex.h>
+
+/**
+ * ND-tree: dominance index of a set of objective vectors, for any number of objectives.
+ * Every node holds an approximation of the ideal and nadir points of the vectors of its subtree,
+ * so that the subtrees which cannot contain a vector dominating (or dominated by) a given vector are skipped,
+ * and the ones whose nadir point dominates it answer without being visited.
+ * A vector is inserted in the leaf reached by following the children whose middle is the closest to it,
+ * and a leaf with too many vectors is split into nObjectives+1 leaves, seeded with its most distant vectors.
+ * The bounds are not tightened when vectors are removed: they remain valid, but looser.
+ *
+ * Jaszkiewicz A, Lust T (2018) ND-Tree-based update: a fast algorithm for the dynamic nondominance problem.
+ * IEEE Transactions on Evolutionary Computation 22(5):778-791
+ */
+class moeoNDTree : public moeoDominanceIndex
+{
+public:
+
+    /**
+     * Ctor
+     * @param _tolerance the tolerance used to compare the values
+     * @param _maxLeafSize the maximum number of vectors of a leaf
+     */
+    moeoNDTree(double _tolerance = 0.0, unsigned int _maxLeafSize = 20) : moeoDominanceIndex(_tolerance), maxLeafSize(_maxLeafSize), root(-1)
+    {}
+
+
+    /**
+     * Adds to _result the indexes of the vectors weakly dominated by _objectiveVector, in no particular order
+     * @param _objectiveVector the values of an objective vector
+     * @param _strict if true, the vectors equal to _objectiveVector are left aside
+     * @param _result the indexes
+     */
+    void dominated(const double * _objectiveVector, bool _strict, std::vector < unsigned int > & _result) const
+    {
+        stack.clear();
+        if (root >= 0)
+        {
+            stack.push_back(root);
+        }
+        while (!stack.empty())
+        {
+            int n = stack.back();
+            stack.pop_back();
+            // the vectors of the subtree are not worse than its nadir point
+            if (!weaklyDominates(_objectiveVector, nadir(n)))
+            {
+                continue;
+            }
+            if (nodes[n].children.empty())
+            {
+                const std::vector < unsigned int > & points = nodes[n].points;
+                for (unsigned int i=0; i<points.size(); i++)
+                {
+                    const double * vec = objectives[points[i]];
+                    if (weaklyDominates(_objectiveVector, vec) && (!_strict || !equal(vec, _objectiveVector)))
+                    {
+                        _result.push_back(points[i]);
+                    }
+                }
+            }
+            else
+            {
+                stack.insert(stack.end(), nodes[n].children.begin(), nodes[n].children.end());
+            }
+        }
+    }
+
+
+    /**
+     * Returns true if a vector weakly dominates _objectiveVector
+     * @param _objectiveVector the values of an objective vector
+     * @param _strict if true, the vectors equal to _objectiveVector are left aside
+     */
+    bool dominates(const double * _objectiveVector, bool _strict) const
+    {
+        stack.clear();
+        if (root >= 0)
+        {
+            stack.push_back(root);
+        }
+        while (!stack.empty())
+        {
+            int n = stack.back();
+            stack.pop_back();
+            // the vectors of the subtree are not better than its ideal point
+            if (!weaklyDominates(ideal(n), _objectiveVector))
+            {
+                continue;
+            }
+            // ... and not worse than its nadir point
+            if (weaklyDominates(nadir(n), _objectiveVector) && (!_strict || !equal(nadir(n), _objectiveVector)))
+            {
+                return true;
+            }
+            if (nodes[n].children.empty())
+            {
+                const std::vector < unsigned int > & points = nodes[n].points;
+                for (unsigned int i=0; i<points.size(); i++)
+                {
+                    const double * vec = objectives[points[i]];
+                    if (weaklyDominates(vec, _objectiveVector) && (!_strict || !equal(vec, _objectiveVector)))
+                    {
+                        return true;
+                    }
+                }
+            }
+            else
+            {
+                stack.insert(stack.end(), nodes[n].children.begin(), nodes[n].children.end());
+            }
+        }
+        return false;
+    }
+
+
+protected:
+
+    /** A node: an inner node has children, a leaf has vectors */
+    struct Node
+    {
+        /** the parent node, -1 for the root */
+        int parent;
+        /** the children */
+        std::vector < int > children;
+        /** the indexes of the vectors */
+        std::vector < unsigned int > points;
+    };
+
+    /**
+     * Indexes the _i-th vector, just appended to the objective matrix
+     * @param _i the index of the vector
+     */
+    void insert(unsigned int _i)
+    {
+        const double * vec = objectives[_i];
+        if (leaf.size() <= _i)
+        {
+            leaf.resize(_i + 1);
+        }
+        if (root < 0)
+        {
+            root = newNode(-1, vec);
+        }
+        int n = root;
+        while (true)
+        {
+            extend(n, vec);
+            if (nodes[n].children.empty())
+            {
+                nodes[n].points.push_back(_i);
+                leaf[_i] = n;
+                if (nodes[n].points.size() > maxLeafSize)
+                {
+                    split(n);
+                }
+                return;
+            }
+            n = closestChild(n, vec);
+        }
+    }
+
+    /**
+     * Removes the _i-th vector from the index
+     * @param _i the index of the vector
+     */
+    void remove(unsigned int _i)
+    {
+        int n = leaf[_i];
+        std::vector < unsigned int > & points = nodes[n].points;
+        *std::find(points.begin(), points.end(), _i) = points.back();
+        points.pop_back();
+        if (points.empty())
+        {
+            prune(n);
+        }
+    }
+
+    /**
+     * Records that the _from-th vector is moved at the place _to
+     * @param _from the former index of the vector
+     * @param _to its new index
+     */
+    void move(unsigned int _from, unsigned int _to)
+    {
+        int n = leaf[_from];
+        std::vector < unsigned int > & points = nodes[n].points;
+        *std::find(points.begin(), points.end(), _from) = _to;
+        leaf[_to] = n;
+    }
+
+    /**
+     * Removes all the vectors from the index
+     */
+    void clearIndex()
+    {
+        nodes.clear();
+        bounds.clear();
+        freeNodes.clear();
+        leaf.clear();
+        root = -1;
+    }
+
+    /**
+     * Returns the approximation of the ideal point of the node _n
+     * @param _n the node
+     */
+    const double * ideal(int _n) const
+    {
+        return &bounds[2 * _n * nObjectives()];
+    }
+
+    /**
+     * Returns the approximation of the nadir point of the node _n
+     * @param _n the node
+     */
+    const double * nadir(int _n) const
+    {
+        return &bounds[(2 * _n + 1) * nObjectives()];
+    }
+
+    /**
+     * Creates a leaf whose bounds are the vector _vec
+     * @param _parent the parent of the leaf
+     * @param _vec an objective vector
+     */
+    int newNode(int _parent, const double * _vec)
+    {
+        unsigned int m = nObjectives();
+        int n;
+        if (freeNodes.empty())
+        {
+            n = nodes.size();
+            nodes.push_back(Node());
+            bounds.resize(bounds.size() + 2 * m);
+        }
+        else
+        {
+            n = freeNodes.back();
+            freeNodes.pop_back();
+        }
+        nodes[n].parent = _parent;
+        std::copy(_vec, _vec + m, bounds.begin() + 2 * n * m);
+        std::copy(_vec, _vec + m, bounds.begin() + (2 * n + 1) * m);
+        return n;
+    }
+
+    /**
+     * Extends the bounds of the node _n with the vector _vec
+     * @param _n the node
+     * @param _vec an objective vector
+     */
+    void extend(int _n, const double * _vec)
+    {
+        unsigned int m = nObjectives();
+        double * low = &bounds[2 * _n * m];
+        double * high = low + m;
+        for (unsigned int j=0; j<m; j++)
+        {
+            low[j] = std::min(low[j], _vec[j]);
+            high[j] = std::max(high[j], _vec[j]);
+        }
+    }
+
+    /**
+     * Returns the squared distance between the vector _vec and the middle of the bounds of the node _n
+     * @param _n the node
+     * @param _vec an objective vector
+     */
+    double distance(int _n, const double * _vec) const
+    {
+        const double * low = ideal(_n);
+        const double * high = nadir(_n);
+        double d = 0.0;
+        for (unsigned int j=0; j<nObjectives(); j++)
+        {
+            double delta = (low[j] + high[j]) / 2 - _vec[j];
+            d += delta * delta;
+        }
+        return d;
+    }
+
+    /**
+     * Returns the squared distance between two vectors
+     * @param _a the first objective vector
+     * @param _b the second objective vector
+     */
+    double distance(const double * _a, const double * _b) const
+    {
+        double d = 0.0;
+        for (unsigned int j=0; j<nObjectives(); j++)
+        {
+            d += (_a[j] - _b[j]) * (_a[j] - _b[j]);
+        }
+        return d;
+    }
+
+    /**
+     * Returns the child of the inner node _n whose middle is the closest to the vector _vec
+     * @param _n the node
+     * @param _vec an objective vector
+     */
+    int closestChild(int _n, const double * _vec) const
+    {
+        const std::vector < int > & children = nodes[_n].children;
+        int best = children[0];
+        double bestDistance = distance(best, _vec);
+        for (unsigned int c=1; c<children.size(); c++)
+        {
+            double d = distance(children[c], _vec);
+            if (d < bestDistance)
+            {
+                best = children[c];
+                bestDistance = d;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Splits the leaf _n into nObjectives+1 leaves
+     * @param _n the leaf
+     */
+    void split(int _n)
+    {
+        std::vector < unsigned int > points;
+        points.swap(nodes[_n].points);
+        unsigned int size = points.size();
+        unsigned int nChildren = std::min(size, nObjectives() + 1);
+
+        // the first seed is the vector the most distant from the others on average,
+        // the next ones are the most distant from the seeds already chosen
+        std::vector < double > distances(size, 0.0);
+        for (unsigned int i=0; i<size; i++)
+        {
+            for (unsigned int k=0; k<size; k++)
+            {
+                distances[i] += std::sqrt(distance(objectives[points[i]], objectives[points[k]]));
+            }
+        }
+        unsigned int seed = std::max_element(distances.begin(), distances.end()) - distances.begin();
+        std::fill(distances.begin(), distances.end(), std::numeric_limits < double >::infinity());
+        std::vector < bool > seeded(size, false);
+        for (unsigned int c=0; c<nChildren; c++)
+        {
+            seeded[seed] = true;
+            int child = newNode(_n, objectives[points[seed]]);
+            nodes[child].points.push_back(points[seed]);
+            leaf[points[seed]] = child;
+            nodes[_n].children.push_back(child);
+            unsigned int next = seed;
+            double farthest = -1.0;
+            for (unsigned int i=0; i<size; i++)
+            {
+                if (!seeded[i])
+                {
+                    distances[i] = std::min(distances[i], distance(objectives[points[i]], objectives[points[seed]]));
+                    if (distances[i] > farthest)
+                    {
+                        next = i;
+                        farthest = distances[i];
+                    }
+                }
+            }
+            seed = next;
+        }
+
+        // the other vectors go to the closest leaf
+        for (unsigned int i=0; i<size; i++)
+        {
+            if (!seeded[i])
+            {
+                const double * vec = objectives[points[i]];
+                int child = closestChild(_n, vec);
+                extend(child, vec);
+                nodes[child].points.push_back(points[i]);
+                leaf[points[i]] = child;
+            }
+        }
+    }
+
+    /**
+     * Removes the empty leaf _n, and the inner nodes left with a single child
+     * @param _n the leaf
+     */
+    void prune(int _n)
+    {
+        int parent = nodes[_n].parent;
+        freeNode(_n);
+        if (parent < 0)
+        {
+            root = -1;
+            return;
+        }
+        std::vector < int > & children = nodes[parent].children;
+        children.erase(std::find(children.begin(), children.end(), _n));
+        if (children.empty())
+        {
+            prune(parent);
+        }
+        else if (children.size() == 1)
+        {
+            // the only child takes the place of its parent
+            int child = children[0];
+            int grandParent = nodes[parent].parent;
+            nodes[child].parent = grandParent;
+            if (grandParent < 0)
+            {
+                root = child;
+            }
+            else
+            {
+                std::vector < int > & siblings = nodes[grandParent].children;
+                *std::find(siblings.begin(), siblings.end(), parent) = child;
+            }
+            freeNode(parent);
+        }
+    }
+
+    /**
+     * Gives back the node _n
+     * @param _n the node
+     */
+    void freeNode(int _n)
+    {
+        nodes[_n].children.clear();
+        nodes[_n].points.clear();
+        freeNodes.push_back(_n);
+    }
+
+    /** the maximum number of vectors of a leaf */
+    unsigned int maxLeafSize;
+    /** the root, -1 if there is no vector */
+    int root;
+    /** the nodes, the free ones included */
+    std::vector < Node > nodes;
+    /** the ideal then the nadir point of every node */
+    std::vector < double > bounds;
+    /** the free nodes */
+    std::vector < int > freeNodes;
+    /** the leaf of every vector */
+    std::vector < int > leaf;
+    /** the nodes to visit */
+    mutable std::vector < int > stack;
+
+};
+
+#endif /*MOEONDTREE_H_*/
@@ -0,0 +1,251 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEONEARESTNEIGHBORTRUNCATION_H_
+#define MOEONEARESTNEIGHBORTRUNCATION_H_
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <distance/moeoDistance.h>
+
+/**
+ * Truncation procedure of SPEA2: the points are removed one by one, the removed point being the one whose sorted
+ * distances to the remaining points are the lexicographically smallest (the point of smallest index in case of equality).
+ * E. Zitzler, M. Laumanns, and L. Thiele. SPEA2: Improving the Strength Pareto Evolutionary Algorithm. Technical Report 103,
+ * Computer Engineering and Networks Laboratory (TIK), ETH Zurich, Zurich, Switzerland, 2001.
+ *
+ * Instead of the whole sorted distance matrix, only the nearest neighbors of every point are kept, in a sorted list.
+ * The removed points are deleted from the lists, and a list is only computed again, with more neighbors, when a
+ * comparison needs more neighbors than it contains, which seldom happens since the comparisons are mostly decided by
+ * the nearest neighbors. The memory is then linear in the number of points, and every pair of points is measured once.
+ * The distance is supposed to be symmetric.
+ */
+template < class MOEOT >
+class moeoNearestNeighborTruncation
+{
+public:
+
+    /**
+     * Ctor
+     * @param _distance the distance used
+     * @param _nNeighbors the number of neighbors initially kept for every point
+     */
+    moeoNearestNeighborTruncation(moeoDistance < MOEOT, double > & _distance, unsigned int _nNeighbors = 8) : distance(_distance), nNeighbors(std::max(_nNeighbors, 1u))
+    {}
+
+
+    /**
+     * Removes _nb points one by one, and returns the indexes of the removed points, in the order of their removal, in _removed.
+     * @param _points the points
+     * @param _nb the number of points to remove
+     * @param _removed the indexes of the removed points
+     */
+    void operator()(const std::vector < const MOEOT * > & _points, unsigned int _nb, std::vector < unsigned int > & _removed)
+    {
+        points = &_points;
+        unsigned int n = _points.size();
+        alive.assign(n, true);
+        nAlive = n;
+        init();
+        _removed.clear();
+        for (unsigned int r=0; (r<_nb) && (nAlive>0); r++)
+        {
+            // the point with the lexicographically smallest distances
+            unsigned int worst = 0;
+            while (!alive[worst])
+            {
+                worst++;
+            }
+            for (unsigned int i=worst+1; i<n; i++)
+            {
+                if (alive[i] && smaller(i, worst))
+                {
+                    worst = i;
+                }
+            }
+            _removed.push_back(worst);
+            alive[worst] = false;
+            nAlive--;
+            // deletion of the point from the lists which contain it
+            for (unsigned int i=0; i<n; i++)
+            {
+                if (alive[i])
+                {
+                    for (unsigned int k=0; k<neighbors[i].size(); k++)
+                    {
+                        if (neighbors[i][k].second == worst)
+                        {
+                            neighbors[i].erase(neighbors[i].begin() + k);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+
+private:
+
+    /** a neighbor: its distance and its index */
+    typedef std::pair < double, unsigned int > Neighbor;
+
+    /** the distance */
+    moeoDistance < MOEOT, double > & distance;
+    /** the number of neighbors initially kept for every point */
+    unsigned int nNeighbors;
+    /** the points */
+    const std::vector < const MOEOT * > * points;
+    /** alive[i] is false once the point i is removed */
+    std::vector < bool > alive;
+    /** the number of remaining points */
+    unsigned int nAlive;
+    /** the nearest remaining neighbors of every point, sorted by increasing distance */
+    std::vector < std::vector < Neighbor > > neighbors;
+    /** complete[i] is true if neighbors[i] contains all the remaining points */
+    std::vector < bool > complete;
+    /** a buffer for the computation of a list */
+    std::vector < Neighbor > buffer;
+
+
+    /**
+     * Computes the lists of nearest neighbors of every point: every distance is computed once, and given to both
+     * points, each of them keeping its nearest neighbors in a max-heap.
+     */
+    void init()
+    {
+        const std::vector < const MOEOT * > & p = *points;
+        unsigned int n = p.size();
+        neighbors.resize(n);
+        complete.assign(n, n <= nNeighbors + 1);
+        for (unsigned int i=0; i<n; i++)
+        {
+            neighbors[i].clear();
+            neighbors[i].reserve(nNeighbors);
+        }
+        for (unsigned int i=0; i<n; i++)
+        {
+            for (unsigned int j=i+1; j<n; j++)
+            {
+                double d = distance(*p[i], *p[j]);
+                push(neighbors[i], Neighbor(d, j));
+                push(neighbors[j], Neighbor(d, i));
+            }
+        }
+        for (unsigned int i=0; i<n; i++)
+        {
+            std::sort_heap(neighbors[i].begin(), neighbors[i].end());
+        }
+    }
+
+
+    /**
+     * Inserts _neighbor in the max-heap _heap if it contains less than nNeighbors neighbors or a farther one.
+     * @param _heap the heap
+     * @param _neighbor the neighbor
+     */
+    void push(std::vector < Neighbor > & _heap, const Neighbor & _neighbor)
+    {
+        if (_heap.size() < nNeighbors)
+        {
+            _heap.push_back(_neighbor);
+            std::push_heap(_heap.begin(), _heap.end());
+        }
+        else if (_neighbor < _heap.front())
+        {
+            std::pop_heap(_heap.begin(), _heap.end());
+            _heap.back() = _neighbor;
+            std::push_heap(_heap.begin(), _heap.end());
+        }
+    }
+
+
+    /**
+     * Computes again the list of the point _i, with at least _size neighbors.
+     * @param _i the index of the point
+     * @param _size the number of neighbors
+     */
+    void fill(unsigned int _i, unsigned int _size)
+    {
+        const std::vector < const MOEOT * > & p = *points;
+        buffer.clear();
+        for (unsigned int j=0; j<p.size(); j++)
+        {
+            if (alive[j] && (j != _i))
+            {
+                buffer.push_back(Neighbor(distance(*p[_i], *p[j]), j));
+            }
+        }
+        if (buffer.size() > _size)
+        {
+            std::nth_element(buffer.begin(), buffer.begin() + _size, buffer.end());
+            buffer.resize(_size);
+            complete[_i] = false;
+        }
+        else
+        {
+            complete[_i] = true;
+        }
+        std::sort(buffer.begin(), buffer.end());
+        neighbors[_i] = buffer;
+    }
+
+
+    /**
+     * Returns the distance between the point _i and its _k-th nearest remaining neighbor (starting from 0).
+     * @param _i the index of the point
+     * @param _k the rank of the neighbor
+     */
+    double at(unsigned int _i, unsigned int _k)
+    {
+        if ((_k >= neighbors[_i].size()) && !complete[_i])
+        {
+            fill(_i, std::max(2 * _k + 2, nNeighbors));
+        }
+        return neighbors[_i][_k].first;
+    }
+
+
+    /**
+     * Returns true if the sorted distances of the point _i to the remaining points are lexicographically smaller than
+     * those of the point _j (or equal, with _i < _j).
+     * @param _i the index of the first point
+     * @param _j the index of the second point
+     */
+    bool smaller(unsigned int _i, unsigned int _j)
+    {
+        for (unsigned int k=0; k+1<nAlive; k++)
+        {
+            double di = at(_i, k);
+            double dj = at(_j, k);
+            if (di < dj)
+            {
+                return true;
+            }
+            else if (di > dj)
+            {
+                return false;
+            }
+        }
+        return _i < _j;
+    }
+
+};
+
+#endif /*MOEONEARESTNEIGHBORTRUNCATION_H_*/
@@ -0,0 +1,107 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEONONDOMINATEDSORTING_H_
+#define MOEONONDOMINATEDSORTING_H_
+
+#include <vector>
+#include <eoFunctor.h>
+#include <utils/moeoObjectiveMatrix.h>
+
+/**
+ * Abstract class for the algorithms sorting a set of objective vectors into fronts of mutually non-dominated vectors.
+ * The front of every vector is computed from the rows of a moeoObjectiveMatrix, 0 standing for the non-dominated vectors.
+ * Values are compared exactly (the tolerance of the objective vector traits is not used), and equal vectors belong to the same front.
+ * The sorting algorithms can be plugged into moeoDominanceDepthFitnessAssignment, and hence into moeoNSGAII.
+ */
+class moeoNondominatedSorting : public eoBF < const moeoObjectiveMatrix &, std::vector < unsigned int > &, void >
+{
+public:
+
+    /**
+     * Returns true if _a dominates _b in the Pareto sense (minimization)
+     * @param _a the first objective vector
+     * @param _b the second objective vector
+     * @param _nObjectives the number of objectives
+     */
+    static bool dominates(const double * _a, const double * _b, unsigned int _nObjectives)
+    {
+        bool better = false;
+        for (unsigned int j=0; j<_nObjectives; j++)
+        {
+            if (_a[j] > _b[j])
+            {
+                return false;
+            }
+            if (_a[j] < _b[j])
+            {
+                better = true;
+            }
+        }
+        return better;
+    }
+
+
+    /**
+     * Returns true if _a is lexicographically smaller than _b
+     * @param _a the first objective vector
+     * @param _b the second objective vector
+     * @param _nObjectives the number of objectives
+     */
+    static bool lexicographicallyLess(const double * _a, const double * _b, unsigned int _nObjectives)
+    {
+        for (unsigned int j=0; j<_nObjectives; j++)
+        {
+            if (_a[j] != _b[j])
+            {
+                return _a[j] < _b[j];
+            }
+        }
+        return false;
+    }
+
+
+protected:
+
+    /** Functor sorting the indexes of the rows of a moeoObjectiveMatrix in the lexicographic order */
+    class LexicographicComparator
+    {
+    public:
+        /**
+         * Ctor
+         * @param _objectives the objective matrix
+         */
+        LexicographicComparator(const moeoObjectiveMatrix & _objectives) : objectives(_objectives)
+        {}
+        /**
+         * Returns true if the _i-th row is lexicographically smaller than the _j-th one
+         * @param _i the first index
+         * @param _j the second index
+         */
+        bool operator()(unsigned int _i, unsigned int _j) const
+        {
+            return lexicographicallyLess(objectives[_i], objectives[_j], objectives.nObjectives());
+        }
+    private:
+        /** the objective matrix */
+        const moeoObjectiveMatrix & objectives;
+    };
+
+};
+
+#endif /*MOEONONDOMINATEDSORTING_H_*/
@@ -0,0 +1,158 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MOEOOBJECTIVEMATRIX_H_
+#define MOEOOBJECTIVEMATRIX_H_
+
+#include <algorithm>
+#include <vector>
+#include <eoPop.h>
+
+/**
+ * Objective vectors of a population stored in a contiguous, row-major matrix of doubles.
+ * Every objective is to be minimized: the values of the maximized objectives are negated when the matrix is filled.
+ * This is the input of the non-dominated sorting algorithms (see moeoNondominatedSorting).
+ */
+class moeoObjectiveMatrix
+{
+public:
+
+    /**
+     * Ctor
+     * @param _nRows the number of objective vectors
+     * @param _nObjectives the number of objectives
+     */
+    moeoObjectiveMatrix(unsigned int _nRows = 0, unsigned int _nObjectives = 0) : nRows(_nRows), nObj(_nObjectives), values(_nRows * _nObjectives)
+    {}
+
+
+    /**
+     * Resizes the matrix, the values are left unspecified
+     * @param _nRows the number of objective vectors
+     * @param _nObjectives the number of objectives
+     */
+    void resize(unsigned int _nRows, unsigned int _nObjectives)
+    {
+        nRows = _nRows;
+        nObj = _nObjectives;
+        values.resize(nRows * nObj);
+    }
+
+
+    /**
+     * Appends an objective vector at the end of the matrix
+     * @param _row the values of the objective vector (not taken from the matrix itself)
+     */
+    void push_back(const double * _row)
+    {
+        values.insert(values.end(), _row, _row + nObj);
+        nRows++;
+    }
+
+
+    /**
+     * Removes the _i-th objective vector, the last one taking its place
+     * @param _i the index of the objective vector
+     */
+    void erase(unsigned int _i)
+    {
+        nRows--;
+        if (_i != nRows)
+        {
+            std::copy(values.begin() + nRows * nObj, values.end(), values.begin() + _i * nObj);
+        }
+        values.resize(nRows * nObj);
+    }
+
+
+    /**
+     * Fills the matrix with the objective vectors of the population _pop
+     * @param _pop the population
+     */
+    template < class MOEOT >
+    void fill(const eoPop < MOEOT > & _pop)
+    {
+        unsigned int m = MOEOT::ObjectiveVector::nObjectives();
+        resize(_pop.size(), m);
+        std::vector < double > sign(m);
+        for (unsigned int j=0; j<m; j++)
+        {
+            sign[j] = MOEOT::ObjectiveVector::minimizing(j) ? 1.0 : -1.0;
+        }
+        for (unsigned int i=0; i<nRows; i++)
+        {
+            const typename MOEOT::ObjectiveVector & objVec = _pop[i].objectiveVector();
+            double * row = (*this)[i];
+            for (unsigned int j=0; j<m; j++)
+            {
+                row[j] = sign[j] * objVec[j];
+            }
+        }
+    }
+
+
+    /**
+     * Returns the number of objective vectors
+     */
+    unsigned int size() const
+    {
+        return nRows;
+    }
+
+
+    /**
+     * Returns the number of objectives
+     */
+    unsigned int nObjectives() const
+    {
+        return nObj;
+    }
+
+
+    /**
+     * Returns a pointer to the values of the _i-th objective vector
+     * @param _i the index of the objective vector
+     */
+    double * operator[](unsigned int _i)
+    {
+        return &values[_i * nObj];
+    }
+
+
+    /**
+     * Returns a pointer to the values of the _i-th objective vector
+     * @param _i the index of the objective vector
+     */
+    const double * operator[](unsigned int _i) const
+    {
+        return &values[_i * nObj];
+    }
+
+
+private:
+
+    /** the number of objective vectors */
+    unsigned int nRows;
+    /** the number of objectives */
+    unsigned int nObj;
+    /** the values, objective vector by objective vector */
+    std::vector < double > values;
+
+};
+
+#endif /*MOEOOBJECTIVEMATRIX_H_*/
@@ -0,0 +1,187 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+// t-moeoExactHypervolume.cpp
+//-----------------------------------------------------------------------------
+
+#include <cmath>
+#include <eo>
+#include <moeo>
+
+//-----------------------------------------------------------------------------
+
+class ObjectiveVectorTraits : public moeoObjectiveVectorTraits
+{
+public:
+    static bool minimizing (int i)
+    {
+        return true;
+    }
+    static bool maximizing (int i)
+    {
+        return false;
+    }
+    static unsigned int nObjectives ()
+    {
+        return 3;
+    }
+};
+
+typedef moeoRealObjectiveVector < ObjectiveVectorTraits > ObjectiveVector;
+
+//-----------------------------------------------------------------------------
+
+/** hypervolume given by the slicing algorithm of moeoHyperVolumeMetric */
+double referenceVolume(const moeoObjectiveMatrix & _set, const std::vector < double > & _reference)
+{
+    moeoHyperVolumeMetric < ObjectiveVector > metric(false, 1.1);
+    std::vector < std::vector < double > > front;
+    for (unsigned int i=0; i<_set.size(); i++)
+    {
+        std::vector < double > point(_reference.size());
+        bool inside = true;
+        for (unsigned int j=0; j<_reference.size(); j++)
+        {
+            point[j] = _reference[j] - _set[i][j];
+            inside = inside && (point[j] > 0);
+        }
+        if (inside)
+        {
+            front.push_back(point);
+        }
+    }
+    if (front.empty())
+    {
+        return 0.0;
+    }
+    if (_reference.size() == 1)
+    {
+        // the slicing algorithm needs two objectives at least
+        double length = 0;
+        for (unsigned int i=0; i<front.size(); i++)
+        {
+            length = std::max(length, front[i][0]);
+        }
+        return length;
+    }
+    return metric.calc_hypervolume(front, front.size(), _reference.size());
+}
+
+bool equal(double _a, double _b)
+{
+    return std::fabs(_a - _b) <= 1e-9 * std::max(1.0, std::fabs(_b));
+}
+
+int main()
+{
+    std::cout << "[moeoExactHypervolume]\t=>\t";
+
+    moeoExactHypervolume hypervolume;
+
+    // a single point and a simple 2D staircase
+    std::vector < double > reference(2, 4.0);
+    moeoObjectiveMatrix set(0, 2);
+    double p0[] = {1.0, 3.0};
+    double p1[] = {2.0, 2.0};
+    double p2[] = {3.0, 1.0};
+    double p3[] = {3.0, 3.0};
+    set.push_back(p0);
+    if (hypervolume(set, reference) != 3.0)
+    {
+        std::cout << "ERROR (bad hypervolume of a single point)" << std::endl;
+        return EXIT_FAILURE;
+    }
+    set.push_back(p1);
+    set.push_back(p2);
+    set.push_back(p3);
+    if ((hypervolume(set, reference) != 6.0) || (hypervolume.contribution(set, 1, reference) != 1.0) || (hypervolume.contribution(set, 3, reference) != 0.0))
+    {
+        std::cout << "ERROR (bad hypervolume of the 2D staircase)" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // random sets, with many equal values, from 1 to 6 objectives
+    rng.reseed(42);
+    std::vector < double > contributions;
+    for (unsigned int m=1; m<=6; m++)
+    {
+        reference.assign(m, 1.0);
+        for (unsigned int trial=0; trial<10; trial++)
+        {
+            unsigned int n = 1 + rng.random(m < 5 ? 40 : 15);
+            set.resize(n, m);
+            for (unsigned int i=0; i<n; i++)
+            {
+                // vectors near the unit simplex, a few of them beyond the reference point
+                double sum = 0;
+                for (unsigned int j=0; j<m; j++)
+                {
+                    set[i][j] = rng.random(8) + 1;
+                    sum += set[i][j];
+                }
+                for (unsigned int j=0; j<m; j++)
+                {
+                    set[i][j] = set[i][j] / sum * (0.8 + rng.uniform(0.4));
+                }
+            }
+            double expected = referenceVolume(set, reference);
+            double value = hypervolume(set, reference);
+            if (! equal(value, expected))
+            {
+                std::cout << "ERROR (bad hypervolume with " << m << " objectives: " << value << " instead of " << expected << ")" << std::endl;
+                return EXIT_FAILURE;
+            }
+            // exclusive contributions
+            hypervolume.contributions(set, reference, contributions);
+            for (unsigned int i=0; i<n; i++)
+            {
+                moeoObjectiveMatrix others = set;
+                others.erase(i);
+                if (! equal(contributions[i], value - referenceVolume(others, reference)))
+                {
+                    std::cout << "ERROR (bad contribution with " << m << " objectives)" << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+            // incremental updates
+            moeoIncrementalHypervolume incremental(reference);
+            for (unsigned int i=0; i<n; i++)
+            {
+                incremental.add(set[i]);
+            }
+            if (! equal(incremental.value(), expected))
+            {
+                std::cout << "ERROR (bad incremental hypervolume with " << m << " objectives)" << std::endl;
+                return EXIT_FAILURE;
+            }
+            while (incremental.size() > n / 2)
+            {
+                incremental.remove(rng.random(incremental.size()));
+            }
+            if (! equal(incremental.value(), hypervolume(incremental.points(), reference)))
+            {
+                std::cout << "ERROR (bad incremental hypervolume after removals with " << m << " objectives)" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    std::cout << "OK" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,171 @@
+/*
+* <t-moeoIndicatorBasedReplacement.cpp>
+* Copyright (C) DOLPHIN Project-Team, INRIA Futurs, 2006-2007
+* (C) OPAC Team, LIFL, 2002-2007
+*
+* Arnaud Liefooghe
+*
+* This software is governed by the CeCILL license under French law and
+* abiding by the rules of distribution of free software.  You can  use,
+* modify and/ or redistribute the software under the terms of the CeCILL
+* license as circulated by CEA, CNRS and INRIA at the following URL
+* "http://www.cecill.info".
+*
+* As a counterpart to the access to the source code and  rights to copy,
+* modify and redistribute granted by the license, users are provided only
+* with a limited warranty  and the software's author,  the holder of the
+* economic rights,  and the successive licensors  have only  limited liability.
+*
+* In this respect, the user's attention is drawn to the risks associated
+* with loading,  using,  modifying and/or developing or reproducing the
+* software by the user in light of its specific status of free software,
+* that may mean  that it is complicated to manipulate,  and  that  also
+* therefore means  that it is reserved for developers  and  experienced
+* professionals having in-depth computer knowledge. Users are therefore
+* encouraged to load and test the software's suitability as regards their
+* requirements in conditions enabling the security of their systems and/or
+* data to be ensured and,  more generally, to use and operate it in the
+* same conditions as regards security.
+* The fact that you are presently reading this means that you have had
+* knowledge of the CeCILL license and that you accept its terms.
+*
+* ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+* Contact: paradiseo-help@lists.gforge.inria.fr
+*
+*/
+//-----------------------------------------------------------------------------
+// t-moeoIndicatorBasedReplacement.cpp
+//-----------------------------------------------------------------------------
+
+#include <eo>
+#include <moeo>
+
+//-----------------------------------------------------------------------------
+
+class ObjectiveVectorTraits : public moeoObjectiveVectorTraits
+{
+public:
+    static bool minimizing (int i)
+    {
+        return i != 1;
+    }
+    static bool maximizing (int i)
+    {
+        return i == 1;
+    }
+    static unsigned int nObjectives ()
+    {
+        return 3;
+    }
+};
+
+typedef moeoRealObjectiveVector < ObjectiveVectorTraits > ObjectiveVector;
+
+typedef MOEO < ObjectiveVector, double, double > Solution;
+
+//-----------------------------------------------------------------------------
+
+// a random population, with some duplicated objective vectors
+void init(eoPop < Solution > & _pop, unsigned int _size)
+{
+    _pop.resize(_size);
+    for (unsigned int i=0; i<_size; i++)
+    {
+        ObjectiveVector obj;
+        for (unsigned int k=0; k<ObjectiveVector::nObjectives(); k++)
+        {
+            obj[k] = (i % 7 == 6) ? _pop[i-1].objectiveVector()[k] : rng.uniform(10);
+        }
+        _pop[i].objectiveVector(obj);
+    }
+}
+
+// checks the matrix, the fitnesses and the replacement against the pairwise calls of the metric
+int check(moeoNormalizedSolutionVsSolutionBinaryMetric < ObjectiveVector, double > & _metric, bool _parallel, const std::string & _name)
+{
+    const double kappa = 0.05;
+    eoPop < Solution > parents, offspring;
+    init(parents, 50);
+    init(offspring, 50);
+
+    // matrix of the indicator values
+    eoPop < Solution > pop = parents;
+    std::copy(offspring.begin(), offspring.end(), back_inserter(pop));
+    moeoExpBinaryIndicatorBasedFitnessAssignment < Solution > fitnessAssignment(_metric, kappa, _parallel);
+    fitnessAssignment(pop);
+    std::vector < ObjectiveVector > objectives(pop.size());
+    for (unsigned int i=0; i<pop.size(); i++)
+    {
+        objectives[i] = pop[i].objectiveVector();
+    }
+    std::vector < double > values;
+    _metric.matrix(objectives, values, _parallel);
+    for (unsigned int i=0; i<pop.size(); i++)
+    {
+        double fitness = 0;
+        for (unsigned int j=0; j<pop.size(); j++)
+        {
+            if (i != j)
+            {
+                if (values[i * pop.size() + j] != _metric(objectives[i], objectives[j]))
+                {
+                    std::cout << "ERROR (" << _name << ": bad indicator value for " << i << "," << j << ")" << std::endl;
+                    return EXIT_FAILURE;
+                }
+                fitness -= exp(-_metric(objectives[j], objectives[i]) / kappa);
+            }
+        }
+        if (pop[i].fitness() != fitness)
+        {
+            std::cout << "ERROR (" << _name << ": bad fitness for pop[" << i << "])" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // the replacement keeps the same individuals, with the same fitnesses, as the environmental replacement
+    eoPop < Solution > expected = parents, offspringCopy = offspring;
+    moeoExpBinaryIndicatorBasedFitnessAssignment < Solution > referenceAssignment(_metric, kappa);
+    moeoEnvironmentalReplacement < Solution > reference(referenceAssignment);
+    reference(expected, offspringCopy);
+
+    moeoIndicatorBasedReplacement < Solution > replace(fitnessAssignment);
+    replace(parents, offspring);
+
+    if ((parents.size() != expected.size()) || (offspring.size() != 0))
+    {
+        std::cout << "ERROR (" << _name << ": bad population size)" << std::endl;
+        return EXIT_FAILURE;
+    }
+    for (unsigned int i=0; i<parents.size(); i++)
+    {
+        if ((parents[i].objectiveVector() != expected[i].objectiveVector()) || (parents[i].fitness() != expected[i].fitness()))
+        {
+            std::cout << "ERROR (" << _name << ": bad individual " << i << " after replacement)" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    std::cout << "[moeoIndicatorBasedReplacement]\t=>\t";
+    rng.reseed(1);
+
+    moeoAdditiveEpsilonBinaryMetric < ObjectiveVector > epsilon;
+    moeoHypervolumeBinaryMetric < ObjectiveVector > hypervolume;
+    if ( (check(epsilon, false, "epsilon") != EXIT_SUCCESS) ||
+         (check(epsilon, true, "parallel epsilon") != EXIT_SUCCESS) ||
+         (check(hypervolume, false, "hypervolume") != EXIT_SUCCESS) ||
+         (check(hypervolume, true, "parallel hypervolume") != EXIT_SUCCESS) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "OK" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
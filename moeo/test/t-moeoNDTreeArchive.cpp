@@ -0,0 +1,162 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+// t-moeoNDTreeArchive.cpp
+//-----------------------------------------------------------------------------
+
+#include <eo>
+#include <moeo>
+
+//-----------------------------------------------------------------------------
+
+typedef moeoRealObjectiveVector < moeoObjectiveVectorTraits > ObjectiveVector;
+
+/** a solution holds the number of its creation */
+class Solution : public moeoRealVector < ObjectiveVector >
+{
+public:
+    Solution() : moeoRealVector < ObjectiveVector > (1) {}
+};
+
+/** random solution close to a front, with many equal values */
+void randomSolution(unsigned int _id, Solution & _sol)
+{
+    unsigned int m = ObjectiveVector::nObjectives();
+    ObjectiveVector objVec;
+    double sum = 0.0;
+    for (unsigned int j=0; j<m; j++)
+    {
+        objVec[j] = 1 + rng.random(10);
+        sum += objVec[j];
+    }
+    double scale = rng.random(4);
+    for (unsigned int j=0; j<m; j++)
+    {
+        objVec[j] = (objVec[j] * 10 / sum) + scale;
+        if (ObjectiveVector::maximizing(j))
+        {
+            objVec[j] = - objVec[j];
+        }
+    }
+    _sol[0] = _id;
+    _sol.objectiveVector(objVec);
+}
+
+/** true if both archives hold the same solutions, in the same order */
+bool same(const moeoArchive < Solution > & _arch1, const moeoArchive < Solution > & _arch2)
+{
+    if (_arch1.size() != _arch2.size())
+    {
+        return false;
+    }
+    for (unsigned int i=0; i<_arch1.size(); i++)
+    {
+        if (_arch1[i][0] != _arch2[i][0])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    std::cout << "[moeoNDTreeArchive]\t=>\t";
+
+    rng.reseed(42);
+    for (unsigned int m=1; m<=5; m++)
+    {
+        // the even objectives are minimized, the odd ones maximized
+        std::vector < bool > bObjectives(m);
+        for (unsigned int j=0; j<m; j++)
+        {
+            bObjectives[j] = (j % 2 == 0);
+        }
+        moeoObjectiveVectorTraits::setup(m, bObjectives);
+        Solution sol;
+
+        for (unsigned int r=0; r<2; r++)
+        {
+            bool replace = (r == 0);
+            moeoUnboundedArchive < Solution > reference(replace);
+            // small leaves, to split and prune many nodes
+            moeoNDTreeArchive < Solution > arch(replace, 4);
+
+            // the archives are updated the same way, one solution at a time
+            for (unsigned int i=0; i<1000; i++)
+            {
+                randomSolution(i, sol);
+                if (arch(sol) != reference(sol) || (i % 10 == 0 && !same(arch, reference)))
+                {
+                    std::cout << "ERROR (bad update of a solution, " << m << " objectives, replace=" << replace << ")" << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+
+            // ... and a population at a time
+            eoPop < Solution > pop;
+            pop.resize(100);
+            for (unsigned int i=0; i<pop.size(); i++)
+            {
+                randomSolution(1000 + i, pop[i]);
+            }
+            if (arch(pop) != reference(pop) || !same(arch, reference))
+            {
+                std::cout << "ERROR (bad update of a population, " << m << " objectives, replace=" << replace << ")" << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            // the queries give the same answers as the linear scans
+            for (unsigned int i=0; i<1000; i++)
+            {
+                randomSolution(0, sol);
+                const ObjectiveVector & objVec = (i % 2 == 0) ? sol.objectiveVector() : arch[rng.random(arch.size())].objectiveVector();
+                if (arch.dominates(objVec) != arch.moeoArchive < Solution >::dominates(objVec)
+                    || arch.contains(objVec) != arch.moeoArchive < Solution >::contains(objVec))
+                {
+                    std::cout << "ERROR (bad query, " << m << " objectives)" << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+            if (!arch.equals(reference))
+            {
+                std::cout << "ERROR (archives not equal, " << m << " objectives)" << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            // the index is rebuilt when the archive is modified from outside
+            arch.pop_back();
+            reference.pop_back();
+            for (unsigned int i=0; i<100; i++)
+            {
+                randomSolution(2000 + i, sol);
+                if (arch(sol) != reference(sol) || !same(arch, reference))
+                {
+                    std::cout << "ERROR (bad update after a modification, " << m << " objectives)" << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    std::cout << "OK" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
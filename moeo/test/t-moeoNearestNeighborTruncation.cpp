@@ -0,0 +1,148 @@
+/*
+* <t-moeoNearestNeighborTruncation.cpp>
+* Copyright (C) DOLPHIN Project-Team, INRIA Lille-Nord Europe, 2006-2008
+* (C) OPAC Team, LIFL, 2002-2008
+*
+* This software is governed by the CeCILL license under French law and
+* abiding by the rules of distribution of free software.  You can  use,
+* modify and/ or redistribute the software under the terms of the CeCILL
+* license as circulated by CEA, CNRS and INRIA at the following URL
+* "http://www.cecill.info".
+*
+* As a counterpart to the access to the source code and  rights to copy,
+* modify and redistribute granted by the license, users are provided only
+* with a limited warranty  and the software's author,  the holder of the
+* economic rights,  and the successive licensors  have only  limited liability.
+*
+* In this respect, the user's attention is drawn to the risks associated
+* with loading,  using,  modifying and/or developing or reproducing the
+* software by the user in light of its specific status of free software,
+* that may mean  that it is complicated to manipulate,  and  that  also
+* therefore means  that it is reserved for developers  and  experienced
+* professionals having in-depth computer knowledge. Users are therefore
+* encouraged to load and test the software's suitability as regards their
+* requirements in conditions enabling the security of their systems and/or
+* data to be ensured and,  more generally, to use and operate it in the
+* same conditions as regards security.
+* The fact that you are presently reading this means that you have had
+* knowledge of the CeCILL license and that you accept its terms.
+*
+* ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+* Contact: paradiseo-help@lists.gforge.inria.fr
+*
+*/
+//-----------------------------------------------------------------------------
+// t-moeoNearestNeighborTruncation.cpp
+//-----------------------------------------------------------------------------
+
+#include <eo>
+#include <moeo>
+
+//-----------------------------------------------------------------------------
+
+class ObjectiveVectorTraits : public moeoObjectiveVectorTraits
+{
+public:
+    static bool minimizing (int i)
+    {
+        return true;
+    }
+    static bool maximizing (int i)
+    {
+        return false;
+    }
+    static unsigned int nObjectives ()
+    {
+        return 2;
+    }
+};
+
+typedef moeoRealObjectiveVector < ObjectiveVectorTraits > ObjectiveVector;
+
+typedef MOEO < ObjectiveVector, double, double > Solution;
+
+//-----------------------------------------------------------------------------
+
+// the truncation of SPEA2 with the whole sorted distance matrix
+void reference(const std::vector < const Solution * > & _points, unsigned int _nb, std::vector < unsigned int > & _removed, moeoDistance < Solution, double > & _distance)
+{
+    unsigned int n = _points.size();
+    std::vector < bool > alive(n, true);
+    _removed.clear();
+    for (unsigned int r=0; r<_nb; r++)
+    {
+        std::vector < double > best;
+        unsigned int worst = n;
+        for (unsigned int i=0; i<n; i++)
+        {
+            if (alive[i])
+            {
+                std::vector < double > row;
+                for (unsigned int j=0; j<n; j++)
+                {
+                    if (alive[j] && (j != i))
+                    {
+                        row.push_back(_distance(*_points[i], *_points[j]));
+                    }
+                }
+                std::sort(row.begin(), row.end());
+                if ((worst == n) || (row < best))
+                {
+                    best = row;
+                    worst = i;
+                }
+            }
+        }
+        alive[worst] = false;
+        _removed.push_back(worst);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    std::cout << "[moeoNearestNeighborTruncation]\t=>\t";
+    rng.reseed(1);
+
+    moeoEuclideanDistance < Solution > distance;
+    moeoNearestNeighborTruncation < Solution > truncation(distance, 2);
+
+    // random points on a grid, with many equal distances and some duplicated points
+    eoPop < Solution > pop;
+    pop.resize(120);
+    for (unsigned int i=0; i<pop.size(); i++)
+    {
+        ObjectiveVector objVec;
+        objVec[0] = rng.random(10) * 0.1;
+        objVec[1] = rng.random(10) * 0.1;
+        pop[i].objectiveVector(objVec);
+    }
+    std::vector < const Solution * > points(pop.size());
+    for (unsigned int i=0; i<pop.size(); i++)
+    {
+        points[i] = &pop[i];
+    }
+
+    std::vector < unsigned int > removed, expected;
+    truncation(points, 100, removed);
+    reference(points, 100, expected, distance);
+    if (removed != expected)
+    {
+        std::cout << "ERROR (bad removed points)" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // all the points can be removed
+    truncation(points, pop.size() + 1, removed);
+    if (removed.size() != pop.size())
+    {
+        std::cout << "ERROR (bad number of removed points)" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "OK" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
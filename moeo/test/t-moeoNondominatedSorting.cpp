@@ -0,0 +1,178 @@
+/*
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; version 2
+    of the License.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+//-----------------------------------------------------------------------------
+// t-moeoNondominatedSorting.cpp
+//-----------------------------------------------------------------------------
+
+#include <eo>
+#include <es/eoRealInitBounded.h>
+#include <es/eoRealOp.h>
+#include <moeo>
+
+//-----------------------------------------------------------------------------
+
+class ObjectiveVectorTraits : public moeoObjectiveVectorTraits
+{
+public:
+    static bool minimizing (int i)
+    {
+        return i != 1;
+    }
+    static bool maximizing (int i)
+    {
+        return i == 1;
+    }
+    static unsigned int nObjectives ()
+    {
+        return 3;
+    }
+};
+
+typedef moeoRealObjectiveVector < ObjectiveVectorTraits > ObjectiveVector;
+
+class Solution : public moeoRealVector < ObjectiveVector, double, double >
+{
+public:
+    Solution() : moeoRealVector < ObjectiveVector, double, double > (2) {}
+};
+
+class TestEval : public moeoEvalFunc < Solution >
+{
+public:
+    void operator () (Solution & _sol)
+    {
+        ObjectiveVector objVec;
+        objVec[0] = _sol[0];
+        objVec[1] = - _sol[1];
+        objVec[2] = 2.0 - _sol[0] - _sol[1];
+        _sol.objectiveVector(objVec);
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+/** reference fronts: a vector belongs to front k+1 if it is dominated by a vector of front k only */
+void referenceRanks(const moeoObjectiveMatrix & _objectives, std::vector < unsigned int > & _ranks)
+{
+    unsigned int n = _objectives.size();
+    _ranks.assign(n, 0);
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (unsigned int i=0; i<n; i++)
+        {
+            for (unsigned int j=0; j<n; j++)
+            {
+                if (moeoNondominatedSorting::dominates(_objectives[j], _objectives[i], _objectives.nObjectives()) && (_ranks[i] <= _ranks[j]))
+                {
+                    _ranks[i] = _ranks[j] + 1;
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    std::cout << "[moeoNondominatedSorting]\t=>\t";
+
+    moeoFastNondominatedSorting fast;
+    moeoFastNondominatedSorting parallelFast(true);
+    moeoENSNondominatedSorting ensBS;
+    moeoENSNondominatedSorting ensSS(false);
+    moeoDivideAndConquerNondominatedSorting divideAndConquer;
+    std::vector < moeoNondominatedSorting * > sortings;
+    sortings.push_back(&fast);
+    sortings.push_back(&parallelFast);
+    sortings.push_back(&ensBS);
+    sortings.push_back(&ensSS);
+    sortings.push_back(&divideAndConquer);
+
+    // random objective vectors, with many equal values, from 1 to 6 objectives
+    rng.reseed(42);
+    std::vector < unsigned int > expected, ranks;
+    for (unsigned int m=1; m<=6; m++)
+    {
+        for (unsigned int trial=0; trial<20; trial++)
+        {
+            unsigned int n = rng.random(150);
+            unsigned int nValues = 2 + rng.random(8);
+            moeoObjectiveMatrix objectives(n, m);
+            for (unsigned int i=0; i<n; i++)
+            {
+                for (unsigned int j=0; j<m; j++)
+                {
+                    objectives[i][j] = rng.random(nValues);
+                }
+            }
+            referenceRanks(objectives, expected);
+            for (unsigned int s=0; s<sortings.size(); s++)
+            {
+                (*sortings[s])(objectives, ranks);
+                if (ranks != expected)
+                {
+                    std::cout << "ERROR (bad fronts with algorithm " << s << ", " << m << " objectives, " << n << " vectors)" << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    // the fitness assignment gives the same fitness values whatever the sorting algorithm
+    TestEval eval;
+    eoRealVectorBounds bounds(2, 0.0, 1.0);
+    eoRealInitBounded < Solution > init(bounds);
+    eoPop < Solution > pop(100, init);
+    for (unsigned int i=0; i<pop.size(); i++)
+    {
+        eval(pop[i]);
+    }
+    pop.push_back(pop[0]);
+    moeoDominanceDepthFitnessAssignment < Solution > defaultFitnessAssignment;
+    defaultFitnessAssignment(pop);
+    std::vector < double > fitnesses;
+    for (unsigned int i=0; i<pop.size(); i++)
+    {
+        fitnesses.push_back(pop[i].fitness());
+    }
+    for (unsigned int s=0; s<sortings.size(); s++)
+    {
+        moeoDominanceDepthFitnessAssignment < Solution > fitnessAssignment(sortings[s]);
+        fitnessAssignment(pop);
+        for (unsigned int i=0; i<pop.size(); i++)
+        {
+            if (pop[i].fitness() != fitnesses[i])
+            {
+                std::cout << "ERROR (bad fitness for pop[" << i << "] with algorithm " << s << ")" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // NSGA-II with a given sorting algorithm
+    eoQuadCloneOp < Solution > xover;
+    eoUniformMutation < Solution > mutation(0.05);
+    moeoNSGAII < Solution > algo(10, eval, xover, 1.0, mutation, 1.0, &divideAndConquer);
+    algo(pop);
+
+    std::cout << "OK" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
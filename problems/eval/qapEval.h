@@ -36,6 +36,7 @@ Contact: paradiseo-help@lists.gforge.inria.fr
  * Full evaluation Function for QAP problem
  *
  * ElemType is the type of elements in the matrix. This type must be signed and not unsigned.
+ * Each matrix is stored in one contiguous block, row by row: A[0] is the whole matrix A.
  */
 template< class EOT, typename ElemType = long int >
 class QAPeval : public eoEvalFunc<EOT>
@@ -61,16 +62,18 @@ public:
     file >> n;
     A = new ElemType *[n];
     B = new ElemType *[n];
+    A[0] = new ElemType[n * n];
+    B[0] = new ElemType[n * n];
     
     for(i = 0; i < n; i++) {
-      A[i] = new ElemType[n];
+      A[i] = A[0] + i * n;
       for(j = 0; j < n; j++) {
 	file >> A[i][j];
       }
     }
     
     for(i = 0; i < n; i++) {
-      B[i] = new ElemType[n];
+      B[i] = B[0] + i * n;
       for(j = 0; j < n; j++) 
 	file >> B[i][j];
     }
@@ -82,17 +85,13 @@ public:
    *  default destructor
    */
   ~QAPeval() {
-    unsigned i;
-    
     if (A != NULL) {
-      for(i = 0; i < n; i++) 
-	delete[] A[i];
+      delete[] A[0];
       delete[] A;
     }
     
     if (B != NULL) {
-      for(i = 0; i < n; i++) 
-	delete[] B[i];
+      delete[] B[0];
       delete[] B;
     }
   }
@@ -105,9 +104,12 @@ public:
   void operator()(EOT & _solution) { 
     ElemType cost = 0;
     
-    for (int i = 0; i < n; i++)
+    for (int i = 0; i < n; i++) {
+      const ElemType * a = A[i];
+      const ElemType * b = B[_solution[i]];
       for (int j = 0; j < n; j++)
-	cost += A[i][j] * B[_solution[i]][_solution[j]]; 
+	cost += a[j] * b[_solution[j]]; 
+    }
     
     _solution.fitness(cost);
   }
@@ -0,0 +1,160 @@
+/*
+ * Time of an island model of eoEasyEA on OneMax (bit strings of 1000 bits), with
+ * 2 to 8 islands of 100 individuals on a complete topology and a ring, which
+ * exchange their 3 best individuals every 10 generations, compared to the same
+ * evolutionary algorithms run one after the other, without migration.
+ * The wall time of the whole run and the best fitness are reported.
+ *
+ * Usage: b-smpIslandModel [maxIslands] [generations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <smp>
+#include <eo>
+#include <ga/eoBit.h>
+#include <ga/eoBitOp.h>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+using namespace paradiseo::smp;
+
+typedef eoBit<double> Indi;
+
+const unsigned POP_SIZE = 100;
+const unsigned CHROM_SIZE = 1000;
+
+/** The number of ones */
+class OneMax : public eoEvalFunc<Indi>
+{
+public:
+    void operator()(Indi & indi)
+    {
+        if(indi.invalid())
+            indi.fitness(std::count(indi.begin(), indi.end(), true));
+    }
+};
+
+/** The components of an island */
+struct Components
+{
+    Components(unsigned generations) :
+        continuator(generations), selectOne(2), select(selectOne), mutation(1.0 / CHROM_SIZE),
+        transform(xover, 0.8, mutation, 1.0), criteria(10), selectBest(5), who(selectBest, 3)
+    {
+        migPolicy.push_back(PolicyElement<Indi>(who, criteria));
+    }
+
+    eoGenContinue<Indi> continuator;
+    OneMax eval;
+    eoDetTournamentSelect<Indi> selectOne;
+    eoSelectPerc<Indi> select;
+    eo1PtBitXover<Indi> xover;
+    eoBitMutation<Indi> mutation;
+    eoSGATransform<Indi> transform;
+    eoPlusReplacement<Indi> replace;
+    eoPeriodicContinue<Indi> criteria;
+    eoDetTournamentSelect<Indi> selectBest;
+    eoSelectNumber<Indi> who;
+    MigPolicy<Indi> migPolicy;
+    eoPlusReplacement<Indi> intPolicy;
+};
+
+/** The initial populations, the same for every run */
+vector< eoPop<Indi> > populations(unsigned islands)
+{
+    rng.reseed(42);
+    eoUniformGenerator<bool> uniform;
+    eoInitFixedLength<Indi> init(CHROM_SIZE, uniform);
+    OneMax eval;
+    vector< eoPop<Indi> > pops(islands);
+    for(unsigned i = 0; i < islands; ++i)
+    {
+        pops[i] = eoPop<Indi>(POP_SIZE, init);
+        apply<Indi>(eval, pops[i]);
+    }
+    return pops;
+}
+
+/** Time of the island model, in milliseconds */
+template <class TopologyType>
+double timeModel(unsigned islands, unsigned generations, double & best)
+{
+    vector< eoPop<Indi> > pops = populations(islands);
+    vector< unique_ptr<Components> > components;
+    vector< unique_ptr< Island<eoEasyEA, Indi> > > models;
+    Topology<TopologyType> topology;
+    IslandModel<Indi> model(topology);
+    for(unsigned i = 0; i < islands; ++i)
+    {
+        components.emplace_back(new Components(generations));
+        Components & c = *components.back();
+        models.emplace_back(new Island<eoEasyEA, Indi>(pops[i], c.intPolicy, c.migPolicy, c.continuator,
+                                                       c.eval, c.select, c.transform, c.replace));
+        model.add(*models.back());
+    }
+
+    auto start = chrono::steady_clock::now();
+    model();
+    auto stop = chrono::steady_clock::now();
+
+    best = 0;
+    for(unsigned i = 0; i < islands; ++i)
+        best = max(best, (double) models[i]->getPop().best_element().fitness());
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+/** Time of the algorithms run one after the other, in milliseconds */
+double timeSequential(unsigned islands, unsigned generations, double & best)
+{
+    vector< eoPop<Indi> > pops = populations(islands);
+    best = 0;
+    auto start = chrono::steady_clock::now();
+    for(unsigned i = 0; i < islands; ++i)
+    {
+        Components c(generations);
+        eoEasyEA<Indi> ea(c.continuator, c.eval, c.select, c.transform, c.replace);
+        ea(pops[i]);
+        best = max(best, (double) pops[i].best_element().fitness());
+    }
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    unsigned maxIslands = argc > 1 ? atoi(argv[1]) : 8;
+    unsigned generations = argc > 2 ? atoi(argv[2]) : 100;
+    eoBenchReport report("b-smpIslandModel");
+
+    cout << "maxIslands=" << maxIslands << " generations=" << generations
+         << " popSize=" << POP_SIZE << " chromSize=" << CHROM_SIZE << endl;
+    cout << "wall time (ms) and best fitness" << endl;
+    cout << setw(8) << "islands" << setw(24) << "sequential" << setw(24) << "complete" << setw(24) << "ring" << endl;
+
+    for(unsigned islands = 2; islands <= maxIslands; islands *= 2)
+    {
+        double best[3], times[3];
+        times[0] = timeSequential(islands, generations, best[0]);
+        times[1] = timeModel<Complete>(islands, generations, best[1]);
+        times[2] = timeModel<Ring>(islands, generations, best[2]);
+
+        const char* names[] = {"sequential", "complete", "ring"};
+        cout << setw(8) << islands;
+        for(unsigned m = 0; m < 3; ++m)
+        {
+            cout << setw(12) << times[m] << setw(12) << best[m];
+            report.record(names[m]).param("islands", islands).param("generations", generations)
+                .value("time", times[m], "ms").value("best", best[m]);
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
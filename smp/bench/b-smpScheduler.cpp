@@ -0,0 +1,91 @@
+/*
+ * Compare the scheduling policies of smp::Scheduler on a population whose
+ * evaluation cost per individual ranges from almost nothing to a few milliseconds.
+ *
+ * Usage: b-smpScheduler [workers] [popSize] [generations]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include <smp>
+#include <eo>
+
+#include "eoBenchReport.h"
+
+using namespace std;
+using namespace paradiseo::smp;
+
+typedef EO<double> Indi;
+
+/** Evaluation whose cost is a number of floating point operations */
+class CostEval : public eoEvalFunc<Indi>
+{
+public:
+    CostEval(unsigned _cost) : cost(_cost) {}
+
+    void operator()(Indi& indi)
+    {
+        double x = 1.0;
+        for(unsigned i = 0; i < cost; i++)
+            x = std::sqrt(x + i);
+        indi.fitness(x);
+    }
+
+protected:
+    unsigned cost;
+};
+
+template<class Policy>
+double timeIt(unsigned workers, unsigned popSize, unsigned generations, unsigned cost)
+{
+    CostEval eval(cost);
+    eoPop<Indi> pop;
+    pop.resize(popSize);
+    Scheduler<Indi,Policy> sched(workers);
+
+    auto start = chrono::steady_clock::now();
+    for(unsigned g = 0; g < generations; g++)
+        sched(eval, pop);
+    auto stop = chrono::steady_clock::now();
+
+    // Time per generation, in microseconds
+    return chrono::duration<double, micro>(stop - start).count() / generations;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned workers = argc > 1 ? atoi(argv[1]) : std::max(2u, thread::hardware_concurrency());
+    unsigned popSize = argc > 2 ? atoi(argv[2]) : 1000;
+    unsigned generations = argc > 3 ? atoi(argv[3]) : 200;
+    eoBenchReport report("b-smpScheduler");
+
+    cout << "workers=" << workers << " popSize=" << popSize << " generations=" << generations << endl;
+    cout << "time per generation (us)" << endl;
+    cout << setw(10) << "cost" << setw(14) << "linear" << setw(14) << "progressive" << setw(14) << "stealing" << endl;
+
+    unsigned costs[] = {0, 100, 1000, 10000};
+    for(unsigned cost : costs)
+    {
+        // Keep the run time of expensive evaluations reasonable
+        unsigned gens = std::max(1u, generations * 100 / (100 + cost / 10));
+        double times[] = {timeIt<LinearPolicy>(workers, popSize, gens, cost),
+                          timeIt<ProgressivePolicy>(workers, popSize, gens, cost),
+                          timeIt<WorkStealingPolicy>(workers, popSize, gens, cost)};
+        const char* names[] = {"linear", "progressive", "stealing"};
+        cout << setw(10) << cost;
+        for(unsigned p = 0; p < 3; p++)
+        {
+            cout << setw(14) << times[p];
+            report.record(names[p]).param("cost", cost).param("workers", workers).param("popSize", popSize)
+                .value("time", times[p], "us");
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
@@ -43,7 +43,8 @@ paradiseo::smp::Island<EOAlgo,EOT,bEOT>::Island(std::function<EOT(bEOT&)> _conve
     stopped(false),
     model(nullptr),
     convertFromBase(_convertFromBase),
-    convertToBase(_convertToBase)
+    convertToBase(_convertToBase),
+    stream(eo::streamSeed())
 {
     // Check in compile time the inheritance thanks to type_trait.
     static_assert(std::is_base_of<eoAlgo<EOT>,EOAlgo<EOT>>::value, "Algorithm must inherit from eoAlgo<EOT>");
@@ -62,6 +63,9 @@ paradiseo::smp::Island<EOAlgo,EOT,bEOT>::Island(eoPop<EOT>& _pop, IntPolicy<EOT>
 template<template <class> class EOAlgo, class EOT, class bEOT>
 void paradiseo::smp::Island<EOAlgo,EOT,bEOT>::operator()()
 {
+    // Draws of the algorithm on eo::rng come from the island stream
+    eoRngStreamScope scope(stream);
+
     stopped = false;
     algo(pop);
     stopped = true;
@@ -42,6 +42,7 @@ Contact: paradiseo-help@lists.gforge.inria.fr
 #include <eoSelect.h>
 #include <eoAlgo.h>
 #include <eoPop.h>
+#include <utils/eoRNG.h>
 
 #include <abstractIsland.h>
 #include <islandModel.h>
@@ -153,6 +154,8 @@ protected:
     IslandModel<bEOT>* model;
     std::function<EOT(bEOT&)> convertFromBase; 
     std::function<bEOT(EOT&)> convertToBase;
+    // Own random stream, bound to the thread running the island
+    eoRngStream stream;
 };
 
 #include <island.cpp>
@@ -42,6 +42,7 @@ The Policies Dispatching enables to choose the policy to call at compile time by
 
 struct LinearPolicy {};
 struct ProgressivePolicy {};
+struct WorkStealingPolicy {};
  
 template<class B>
 struct policyTraits {
@@ -53,6 +54,11 @@ struct policyTraits<ProgressivePolicy> {
     typedef ProgressivePolicy type;
 };
 
+template<>
+struct policyTraits<WorkStealingPolicy> {
+    typedef WorkStealingPolicy type;
+};
+
 
 }
 
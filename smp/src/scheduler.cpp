@@ -126,6 +126,19 @@ void paradiseo::smp::Scheduler<EOT,Policy>::operator()(eoUF<EOT&, void>& func, e
         workers[i].join();
 }
 
+template<class EOT, class Policy>
+void paradiseo::smp::Scheduler<EOT,Policy>::operator()(eoUF<EOT&, void>& func, eoPop<EOT>& pop, const WorkStealingPolicy&)
+{
+    if(!pool)
+        pool.reset(new ThreadPool(workers.size()));
+
+    pool->run(pop.size(), [&func, &pop](std::size_t begin, std::size_t end)
+    {
+        for(std::size_t i = begin; i < end; i++)
+            func(pop[i]);
+    });
+}
+
 template<class EOT, class Policy>
 void paradiseo::smp::Scheduler<EOT,Policy>::applyLinearPolicy(eoUF<EOT&, void>& func, std::vector<EOT*>& pop)
 { 
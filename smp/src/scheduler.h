@@ -33,9 +33,11 @@ Contact: paradiseo-help@lists.gforge.inria.fr
 #include <iostream>
 #include <vector>
 #include <atomic>
+#include <memory>
 #include <mutex>
 
 #include <policiesDispatching.h>
+#include <threadPool.h>
 
 #include <eoEvalFunc.h>
 #include <eoPop.h>
@@ -48,6 +50,8 @@ namespace smp
 /** Scheduler : Dispatch load between workers according to a policy.
 
 Dispatch load between the specified number of workers according to a policy.
+LinearPolicy and ProgressivePolicy start new threads on each call, whereas
+WorkStealingPolicy keeps a ThreadPool alive for the whole life of the scheduler.
 
 */
 
@@ -80,10 +84,15 @@ protected:
     void operator()(eoUF<EOT&, void>& func, eoPop<EOT>& pop, const LinearPolicy&);
     
     /**
-     * Perform scheduling with a linear policy
+     * Perform scheduling with a progressive policy
      */
     void operator()(eoUF<EOT&, void>& func, eoPop<EOT>& pop, const ProgressivePolicy&);
 
+    /**
+     * Perform scheduling with a work stealing policy on a persistent thread pool
+     */
+    void operator()(eoUF<EOT&, void>& func, eoPop<EOT>& pop, const WorkStealingPolicy&);
+
     /**
      * Apply an unary functor on a sub-group of population
      * @param func unary functor
@@ -112,6 +121,9 @@ protected:
     std::vector<unsigned> planning;
     std::vector<std::atomic<int>> isWorking;
     std::vector<std::mutex> m;
+
+    // Created on the first call with the work stealing policy, then reused
+    std::unique_ptr<ThreadPool> pool;
 };
 
 #include <scheduler.cpp>
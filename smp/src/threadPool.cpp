@@ -0,0 +1,177 @@
+/*
+<threadPool.cpp>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2012
+
+Alexandre Quemy, Thibault Lasnier - INSA Rouen
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#include <algorithm>
+
+#include <threadPool.h>
+
+paradiseo::smp::ThreadPool::ThreadPool(unsigned workersNb) :
+    task(nullptr),
+    remaining(0),
+    generation(0),
+    stop(false)
+{
+    workersNb = std::max(workersNb, 1u);
+
+    for(unsigned i = 0; i < workersNb; i++)
+        queues.emplace_back(new WorkerQueue);
+
+    // The calling thread is the worker 0
+    for(unsigned i = 1; i < workersNb; i++)
+        threads.emplace_back(&ThreadPool::work, this, i);
+}
+
+paradiseo::smp::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m);
+        stop = true;
+    }
+    wakeUp.notify_all();
+
+    for(auto& thread : threads)
+        thread.join();
+}
+
+void paradiseo::smp::ThreadPool::run(std::size_t size, const Task& _task, std::size_t grain)
+{
+    if(size == 0)
+        return;
+
+    // By default, several chunks per worker so that stealing can balance the load
+    if(grain == 0)
+        grain = std::max<std::size_t>(1, size / (4 * queues.size()));
+
+    {
+        std::lock_guard<std::mutex> lock(m);
+        task = &_task;
+        error = nullptr;
+        remaining = size;
+
+        unsigned id = 0;
+        for(std::size_t begin = 0; begin < size; begin += grain)
+        {
+            std::lock_guard<std::mutex> queueLock(queues[id]->m);
+            queues[id]->ranges.push_back({begin, std::min(begin + grain, size)});
+            id = (id + 1) % queues.size();
+        }
+
+        generation++;
+    }
+    wakeUp.notify_all();
+
+    execute(0);
+
+    std::unique_lock<std::mutex> lock(m);
+    finished.wait(lock, [this] { return remaining == 0; });
+    task = nullptr;
+
+    if(error)
+        std::rethrow_exception(error);
+}
+
+unsigned paradiseo::smp::ThreadPool::size() const
+{
+    return queues.size();
+}
+
+void paradiseo::smp::ThreadPool::work(unsigned id)
+{
+    unsigned long seen = 0;
+
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m);
+            wakeUp.wait(lock, [this, seen] { return stop || generation != seen; });
+            if(stop)
+                return;
+            seen = generation;
+        }
+
+        execute(id);
+    }
+}
+
+void paradiseo::smp::ThreadPool::execute(unsigned id)
+{
+    Range range;
+
+    while(next(id, range))
+    {
+        try
+        {
+            (*task)(range.begin, range.end);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(m);
+            if(!error)
+                error = std::current_exception();
+        }
+
+        std::size_t length = range.end - range.begin;
+        if(remaining.fetch_sub(length) == length)
+        {
+            // Last chunk of the generation: wake up the calling thread
+            std::lock_guard<std::mutex> lock(m);
+            finished.notify_all();
+        }
+    }
+}
+
+bool paradiseo::smp::ThreadPool::next(unsigned id, Range& range)
+{
+    // Own deque first, from the back
+    {
+        WorkerQueue& own = *queues[id];
+        std::lock_guard<std::mutex> lock(own.m);
+        if(!own.ranges.empty())
+        {
+            range = own.ranges.back();
+            own.ranges.pop_back();
+            return true;
+        }
+    }
+
+    // Then steal from the front of the others
+    for(unsigned i = 1; i < queues.size(); i++)
+    {
+        WorkerQueue& victim = *queues[(id + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.m);
+        if(!victim.ranges.empty())
+        {
+            range = victim.ranges.front();
+            victim.ranges.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
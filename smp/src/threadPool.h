@@ -0,0 +1,144 @@
+/*
+<threadPool.h>
+Copyright (C) DOLPHIN Project-Team, INRIA Lille - Nord Europe, 2006-2012
+
+Alexandre Quemy, Thibault Lasnier - INSA Rouen
+
+This software is governed by the CeCILL license under French law and
+abiding by the rules of distribution of free software.  You can  ue,
+modify and/ or redistribute the software under the terms of the CeCILL
+license as circulated by CEA, CNRS and INRIA at the following URL
+"http://www.cecill.info".
+
+In this respect, the user's attention is drawn to the risks associated
+with loading,  using,  modifying and/or developing or reproducing the
+software by the user in light of its specific status of free software,
+that may mean  that it is complicated to manipulate,  and  that  also
+therefore means  that it is reserved for developers  and  experienced
+professionals having in-depth computer knowledge. Users are therefore
+encouraged to load and test the software's suitability as regards their
+requirements in conditions enabling the security of their systems and/or
+data to be ensured and,  more generally, to use and operate it in the
+same conditions as regards security.
+The fact that you are presently reading this means that you have had
+knowledge of the CeCILL license and that you accept its terms.
+
+ParadisEO WebSite : http://paradiseo.gforge.inria.fr
+Contact: paradiseo-help@lists.gforge.inria.fr
+*/
+
+#ifndef SMP_THREAD_POOL_H_
+#define SMP_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace paradiseo
+{
+namespace smp
+{
+
+/** ThreadPool: long-lived workers with per-worker deques and work stealing.
+
+Threads are created once, in the constructor, and sleep on a condition variable
+between two calls to run(). Each call splits the index range [0, size) in chunks
+which are spread over the per-worker deques. A worker pops its own chunks from the
+back of its deque and, once it is empty, steals chunks from the front of the others.
+The calling thread takes part in the work as worker 0, so a pool of n workers owns
+n-1 threads.
+
+@see smp::Scheduler, smp::WorkStealingPolicy
+*/
+class ThreadPool
+{
+public:
+    /**
+     * Task applied on the half-open range of indexes [begin, end)
+     */
+    typedef std::function<void(std::size_t, std::size_t)> Task;
+
+    /**
+     * Constructor
+     * @param workersNb number of workers, including the calling thread
+     */
+    ThreadPool(unsigned workersNb);
+
+    /**
+     * Destructor: wake up and join all threads
+     */
+    ~ThreadPool();
+
+    /**
+     * Apply a task on [0, size) and wait for its completion. If the task throws,
+     * the first exception caught is rethrown in the calling thread once all chunks are done.
+     * @param size number of indexes to process
+     * @param task task to apply on each chunk
+     * @param grain chunk size, 0 to let the pool choose it
+     */
+    void run(std::size_t size, const Task& task, std::size_t grain = 0);
+
+    /**
+     * @return the number of workers, including the calling thread
+     */
+    unsigned size() const;
+
+protected:
+    struct Range
+    {
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    struct WorkerQueue
+    {
+        std::mutex m;
+        std::deque<Range> ranges;
+    };
+
+    /**
+     * Main loop of the threads of the pool
+     * @param id id of the worker
+     */
+    void work(unsigned id);
+
+    /**
+     * Process chunks until no one is left, neither in the own deque nor in the others
+     * @param id id of the worker
+     */
+    void execute(unsigned id);
+
+    /**
+     * Get a chunk, from the back of the own deque or from the front of another one
+     * @param id id of the worker
+     * @param range chunk to fill
+     * @return false if all deques are empty
+     */
+    bool next(unsigned id, Range& range);
+
+    std::vector<std::thread> threads;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+    const Task* task;
+    std::exception_ptr error;
+    std::atomic<std::size_t> remaining;
+
+    std::mutex m;
+    std::condition_variable wakeUp;
+    std::condition_variable finished;
+    unsigned long generation;
+    bool stop;
+};
+
+}
+
+}
+
+#endif
@@ -34,6 +34,15 @@ int main(void)
     // All indi would be evaluate once
     for( unsigned i = 0; i < pop.size(); i++)
         assert(pop[i].evalNb == 1);
+
+    // The work stealing scheduler reuses its threads from one call to another
+    Scheduler<Indi,WorkStealingPolicy> stealingSched(nbWorkers);
+
+    for(unsigned k = 0; k < 10; k++)
+        stealingSched(plainEval, pop);
+
+    for( unsigned i = 0; i < pop.size(); i++)
+        assert(pop[i].evalNb == 11);
   
     return 0;
 }
@@ -0,0 +1,63 @@
+#include <cassert>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+#include <smp>
+
+using namespace std;
+using namespace paradiseo::smp;
+
+int main(void)
+{
+    ThreadPool pool(4);
+    assert(pool.size() == 4);
+
+    // Each index is processed exactly once, on several successive runs
+    vector<int> counts(1000, 0);
+    for(unsigned k = 0; k < 50; k++)
+        pool.run(counts.size(), [&counts](size_t begin, size_t end)
+        {
+            for(size_t i = begin; i < end; i++)
+                counts[i]++;
+        });
+
+    for(unsigned i = 0; i < counts.size(); i++)
+        assert(counts[i] == 50);
+
+    // Less indexes than workers, and explicit grain
+    atomic<unsigned> total(0);
+    pool.run(3, [&total](size_t begin, size_t end) { total += end - begin; }, 1);
+    assert(total == 3);
+
+    // Nothing to do
+    pool.run(0, [](size_t, size_t) { assert(false); });
+
+    // An exception thrown by a worker is rethrown by run, and the pool stays usable
+    bool caught = false;
+    try
+    {
+        pool.run(100, [](size_t begin, size_t end)
+        {
+            if(begin <= 42 && 42 < end)
+                throw runtime_error("42");
+        }, 1);
+    }
+    catch(runtime_error& e)
+    {
+        caught = true;
+    }
+    assert(caught);
+
+    total = 0;
+    pool.run(100, [&total](size_t begin, size_t end) { total += end - begin; });
+    assert(total == 100);
+
+    // A single worker runs everything in the calling thread
+    ThreadPool single(1);
+    total = 0;
+    single.run(10, [&total](size_t begin, size_t end) { total += end - begin; });
+    assert(total == 10);
+
+    return 0;
+}